@@ -2,6 +2,8 @@
 
 #version 450
 
+#include "texture_arrays.glsl"
+
 layout(location = 0) in vec4 v_color;
 layout(location = 1) in vec2 v_tex_coords;
 layout(location = 2) in float v_tex_index;
@@ -9,12 +11,8 @@ layout(location = 3) in vec2 v_tex_tiling;
 
 layout(location = 0) out vec4 o_color;
 
-uniform sampler2D u_textures[32];
-
 void main() {
-  int index = int(v_tex_index);
-
-  vec4 texture = texture(u_textures[index], v_tex_coords * v_tex_tiling);
+  vec4 texture = SampleTexture(v_tex_index, v_tex_coords * v_tex_tiling);
 
   vec4 color = texture * v_color;
 
@@ -0,0 +1,31 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#ifndef TEXTURE_ARRAYS_GLSL_
+#define TEXTURE_ARRAYS_GLSL_
+
+// must match texture_residency.h
+#define MAX_TEXTURE_ARRAYS 24
+#define MAX_TEXTURE_ARRAY_LAYERS 256
+#define MAX_TEXTURE_SLOTS 8
+
+#define TEXTURE_SLOT_INDEX_BASE (MAX_TEXTURE_ARRAYS * MAX_TEXTURE_ARRAY_LAYERS)
+
+uniform sampler2DArray u_texture_arrays[MAX_TEXTURE_ARRAYS];
+uniform sampler2D u_texture_slots[MAX_TEXTURE_SLOTS];
+
+// index is packed as `array * MAX_TEXTURE_ARRAY_LAYERS + layer`, textures
+// which are not resident are at `TEXTURE_SLOT_INDEX_BASE + slot`
+vec4 SampleTexture(float index, vec2 tex_coords) {
+  int packed_index = int(round(index));
+  if (packed_index >= TEXTURE_SLOT_INDEX_BASE) {
+    return texture(u_texture_slots[packed_index - TEXTURE_SLOT_INDEX_BASE],
+                   tex_coords);
+  }
+
+  int array_index = packed_index / MAX_TEXTURE_ARRAY_LAYERS;
+  int layer = packed_index % MAX_TEXTURE_ARRAY_LAYERS;
+
+  return texture(u_texture_arrays[array_index], vec3(tex_coords, layer));
+}
+
+#endif  // TEXTURE_ARRAYS_GLSL_
@@ -1,6 +1,12 @@
 option(ENABLE_TESTING "Should cmake build tests too?" ON)
 set(ENABLE_TESTING ${ENABLE_TESTING})
 
+option(ENABLE_MODEL_IMPORTER "Should models be importable through Assimp? Cooked models are loaded without it." ON)
+set(ENABLE_MODEL_IMPORTER ${ENABLE_MODEL_IMPORTER})
+
+set(GRAPHICS_API "OpenGL" CACHE STRING "Graphics backend to render with (OpenGL, Null)")
+set_property(CACHE GRAPHICS_API PROPERTY STRINGS OpenGL Null)
+
 # Set the output directories
 set(CMAKE_RUNTIME_OUTPUT_DIRECTORY "${CMAKE_SOURCE_DIR}/bin")
 set(CMAKE_RUNTIME_OUTPUT_DIRECTORY_DEBUG "${CMAKE_SOURCE_DIR}/bin")
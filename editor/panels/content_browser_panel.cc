@@ -5,8 +5,10 @@
 #include <IconsFontAwesome4.h>
 #include <imgui.h>
 
+#include "graphics/cooked_texture.h"
 #include "panels/asset_registry_panel.h"
 #include "project/project.h"
+#include "scene/cooked_model.h"
 #include "scene/scene_manager.h"
 #include "ui/imgui_utils.h"
 
@@ -107,6 +109,13 @@ void ContentBrowserPanel::Draw() {
   static int selected_idx = -1;
   for (auto& directory_entry : fs::directory_iterator(current_directory_)) {
     const fs::path& path = directory_entry.path();
+
+    // cooked files are build products of their sources, not assets
+    if (path.extension() == kCookedTextureExtension ||
+        path.extension() == kCookedModelExtension) {
+      continue;
+    }
+
     std::string filename_str = path.filename().string();
 
     ImGui::PushID(filename_str.c_str());
@@ -52,5 +52,7 @@ void DebugInfoPanel::Draw() {
   ImGui::Text("Draw Calls: %d", stats.draw_calls);
   ImGui::Text("Vertex Count: %d", stats.vertex_count);
   ImGui::Text("Index Count: %d", stats.index_count);
+  ImGui::Text("Culled Models: %d", stats.culled_models);
+  ImGui::Text("Culled Quads: %d", stats.culled_quads);
 }
 }  // namespace eve
@@ -110,11 +110,14 @@ void InspectorPanel::RenderEntityHeader(Entity selected_entity) {
                                  2 * ImGui::GetStyle().FramePadding.x;
 
   if (selected_entity.HasComponent<TagComponent>()) {
-    auto& tag_comp = selected_entity.GetComponent<TagComponent>();
+    // renamed through the entity so the scene can keep its name index
+    std::string tag = selected_entity.GetName();
 
     ImGui::PushItemWidth(ImGui::GetContentRegionMax().x - kPlusButtonWidth);
 
-    ImGui::InputText("##tag", &tag_comp.tag);
+    if (ImGui::InputText("##tag", &tag)) {
+      selected_entity.SetName(tag);
+    }
 
     ImGui::PopItemWidth();
   }
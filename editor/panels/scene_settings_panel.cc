@@ -58,6 +58,10 @@ void SceneSettingsPanel::Draw() {
                         &settings.render_physics_bounds)) {
       modify_info.SetModified();
     }
+
+    if (ImGui::Checkbox("Frustum Culling", &settings.frustum_culling)) {
+      modify_info.SetModified();
+    }
   });
 
   // TODO skybox
@@ -37,6 +37,11 @@ struct Asset {
   std::string path = "";
 
   virtual constexpr AssetType GetType() const = 0;
+
+  /**
+   * @brief Estimated memory held by the asset in bytes.
+   */
+  virtual size_t GetMemoryUsage() const { return 0; }
 };
 
 }  // namespace eve
\ No newline at end of file
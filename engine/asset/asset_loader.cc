@@ -2,21 +2,30 @@
 
 #include "asset/asset_loader.h"
 
+#include "graphics/cooked_texture.h"
+#include "scene/cooked_model.h"
+
 namespace eve {
 
 namespace asset_loader {
 
 Ref<Texture> LoadTexture(const fs::path& path) {
-  if (!fs::exists(path)) {
+  // shipped projects may only contain the cooked texture
+  if (!fs::exists(path) && !fs::exists(GetCookedTexturePath(path))) {
+    return nullptr;
+  }
+
+  TextureImage image;
+  if (!LoadTextureImage(path, image, TextureType::kDiffuse, true)) {
     return nullptr;
   }
 
-  Ref<Texture> texture = Texture::Create(path);
-  return texture;
+  return Texture::Create(image);
 }
 
 Ref<Model> LoadModel(const fs::path& path) {
-  if (!fs::exists(path)) {
+  // shipped projects may only contain the cooked model
+  if (!fs::exists(path) && !fs::exists(GetCookedModelPath(path))) {
     return nullptr;
   }
 
@@ -33,6 +42,37 @@ Ref<ShaderInstance> LoadShader(const fs::path& path) {
   return shader;
 }
 
+AssetUploader PrepareAsset(const fs::path& path, AssetType type) {
+  switch (type) {
+    case AssetType::kTexture: {
+      TextureImage image;
+      if ((!fs::exists(path) && !fs::exists(GetCookedTexturePath(path))) ||
+          !LoadTextureImage(path, image, TextureType::kDiffuse, true)) {
+        return nullptr;
+      }
+
+      return [image]() -> Ref<Asset> { return Texture::Create(image); };
+    }
+    case AssetType::kStaticMesh: {
+      if (!fs::exists(path) && !fs::exists(GetCookedModelPath(path))) {
+        return nullptr;
+      }
+
+      Ref<Model> model = Model::CreateWithoutTextures(path);
+      if (!model) {
+        return nullptr;
+      }
+
+      return [model, images = model->DecodeTextures()]() -> Ref<Asset> {
+        model->LoadTextures(images);
+        return model;
+      };
+    }
+    default:
+      return nullptr;
+  }
+}
+
 }  // namespace asset_loader
 
 }  // namespace eve
\ No newline at end of file
@@ -19,6 +19,20 @@ Ref<Model> LoadModel(const fs::path& path);
 
 Ref<ShaderInstance> LoadShader(const fs::path& path);
 
+/**
+ * @brief Function finishing an asset load on the main thread.
+ */
+using AssetUploader = std::function<Ref<Asset>()>;
+
+/**
+ * @brief Does the file io and decoding of a texture or a model without
+ * touching the graphics API, could be called from worker threads.
+ *
+ * @return AssetUploader creating the asset, @c nullptr if the asset could not
+ * be loaded.
+ */
+[[nodiscard]] AssetUploader PrepareAsset(const fs::path& path, AssetType type);
+
 }  // namespace asset_loader
 
 }  // namespace eve
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 #include "asset/asset_loader.h"
 #include "asset_registry.h"
+#include "core/instance.h"
 #include "project/project.h"
 
 using json = nlohmann::json;
@@ -20,12 +21,6 @@ NLOHMANN_JSON_SERIALIZE_ENUM(AssetType, {{AssetType::kNone, nullptr},
                                          {AssetType::kMaterial, "Material"},
                                          {AssetType::kShader, "Shader"}});
 
-struct AssetMetadata {
-  std::string name;
-  std::string path;
-  AssetType type = AssetType::kNone;
-};
-
 AssetMetadata GetMetadata(const fs::path& path) {
   AssetMetadata metadata;
   metadata.name = path.stem().string();
@@ -36,38 +31,93 @@ AssetMetadata GetMetadata(const fs::path& path) {
 }
 
 std::unordered_map<AssetHandle, Ref<Asset>> AssetRegistry::assets_ = {};
+std::unordered_map<AssetHandle, AssetRegistry::LoadingAsset>
+    AssetRegistry::loading_assets_ = {};
+std::unordered_map<AssetHandle, AssetMetadata>
+    AssetRegistry::unloaded_assets_ = {};
+std::unordered_set<AssetHandle> AssetRegistry::failed_assets_ = {};
+uint32_t AssetRegistry::next_ticket_ = 0;
+
+std::unordered_map<std::string, AssetHandle> AssetRegistry::path_index_ = {};
+std::unordered_map<AssetHandle, std::string> AssetRegistry::asset_paths_ =
+    {};
+
+std::unordered_map<AssetHandle, uint32_t> AssetRegistry::reference_counts_ =
+    {};
+std::unordered_set<AssetHandle> AssetRegistry::retrieved_assets_ = {};
+std::list<AssetHandle> AssetRegistry::unused_assets_ = {};
+std::unordered_map<AssetHandle, std::list<AssetHandle>::iterator>
+    AssetRegistry::unused_asset_positions_ = {};
+bool AssetRegistry::load_on_demand_ = false;
+size_t AssetRegistry::memory_budget_ = kDefaultAssetMemoryBudget;
 
 Ref<Asset> AssetRegistry::Get(const AssetHandle& handle) {
   const auto it = assets_.find(handle);
   if (it == assets_.end()) {
+    if (const auto loading_it = loading_assets_.find(handle);
+        loading_it != loading_assets_.end()) {
+      const AssetType type = loading_it->second.metadata.type;
+      AcquireRetrieved(handle);
+      return GetPlaceholder(type);
+    }
+
+    // not referenced by the scene but requested, e.g. by a script
+    if (const auto unloaded_it = unloaded_assets_.find(handle);
+        unloaded_it != unloaded_assets_.end()) {
+      const AssetMetadata metadata = unloaded_it->second;
+
+      // acquiring starts loading the asset
+      AcquireRetrieved(handle);
+      if (unloaded_assets_.contains(handle)) {
+        LoadAsync(metadata.path, metadata.type, metadata.name, handle);
+      }
+
+      // might be loaded in place
+      if (const auto loaded_it = assets_.find(handle);
+          loaded_it != assets_.end()) {
+        return loaded_it->second;
+      }
+
+      return GetPlaceholder(metadata.type);
+    }
+
     EVE_LOG_ENGINE_WARNING("Asset of handle: {} not found thus cannot load!",
                            (uint64_t)handle);
     return nullptr;
   }
 
+  AcquireRetrieved(handle);
+
   return it->second;
 }
 
 AssetHandle AssetRegistry::GetFromPath(const std::string& path) {
-  const AssetRegistryMap::const_iterator it = std::find_if(
-      assets_.begin(), assets_.end(),
-      [path](const auto& pair) { return path == pair.second->path; });
-
-  // If not exists try to add
-  if (it == assets_.end()) {
+  const auto it = path_index_.find(NormalizePath(path));
+  if (it == path_index_.end()) {
     EVE_LOG_ENGINE_ERROR("Unable to get asset from path: {}", path);
     return 0;
   }
 
-  return it->first;
+  return it->second;
 }
 
 void AssetRegistry::Register(Ref<Asset> asset) {
   assets_[asset->handle] = asset;
+  unloaded_assets_.erase(asset->handle);
+
+  IndexPath(asset->handle, asset->path);
+
+  if (!reference_counts_.contains(asset->handle)) {
+    MarkUnused(asset->handle);
+  }
 }
 
 AssetHandle AssetRegistry::Load(const std::string& path, AssetType type,
                                 const std::string& name, AssetHandle handle) {
+  // cancels an asynchronous load of the same handle
+  loading_assets_.erase(handle);
+  unloaded_assets_.erase(handle);
+
   const fs::path path_abs = GetAssetPath(path);
 
   Ref<Asset> asset = nullptr;
@@ -87,6 +137,13 @@ AssetHandle AssetRegistry::Load(const std::string& path, AssetType type,
 
   if (!asset) {
     EVE_LOG_ENGINE_ERROR("Unable to load asset from: {}", path);
+    failed_assets_.insert(handle);
+    MarkUsed(handle);
+
+    if (!assets_.contains(handle)) {
+      RemovePath(handle);
+    }
+
     return 0;
   }
 
@@ -95,6 +152,74 @@ AssetHandle AssetRegistry::Load(const std::string& path, AssetType type,
   asset->path = path;
 
   assets_[asset->handle] = asset;
+  failed_assets_.erase(handle);
+
+  IndexPath(handle, path);
+
+  if (!reference_counts_.contains(handle)) {
+    MarkUnused(handle);
+  }
+
+  EvictUnused(handle);
+
+  return handle;
+}
+
+AssetHandle AssetRegistry::LoadAsync(const std::string& path, AssetType type,
+                                     const std::string& name,
+                                     AssetHandle handle) {
+  if ((type != AssetType::kTexture && type != AssetType::kStaticMesh) ||
+      !Instance::IsCreated()) {
+    return Load(path, type, name, handle);
+  }
+
+  const uint32_t ticket = next_ticket_++;
+  loading_assets_[handle] = {{name, path, type}, ticket};
+  unloaded_assets_.erase(handle);
+  failed_assets_.erase(handle);
+
+  IndexPath(handle, path);
+
+  if (!reference_counts_.contains(handle)) {
+    MarkUnused(handle);
+  }
+
+  Instance& instance = Instance::Get();
+  const fs::path path_abs = GetAssetPath(path);
+
+  instance.GetJobSystem().Submit([&instance, path_abs, type, handle,
+                                  ticket]() {
+    asset_loader::AssetUploader uploader =
+        asset_loader::PrepareAsset(path_abs, type);
+
+    instance.EnqueueMain([uploader, handle, ticket]() {
+      // unloaded or loaded again in the meantime
+      const auto it = loading_assets_.find(handle);
+      if (it == loading_assets_.end() || it->second.ticket != ticket) {
+        return;
+      }
+
+      const AssetMetadata metadata = it->second.metadata;
+      loading_assets_.erase(it);
+
+      Ref<Asset> asset = uploader ? uploader() : nullptr;
+      if (!asset) {
+        EVE_LOG_ENGINE_ERROR("Unable to load asset from: {}", metadata.path);
+        failed_assets_.insert(handle);
+        MarkUsed(handle);
+        RemovePath(handle);
+        return;
+      }
+
+      asset->handle = handle;
+      asset->name = metadata.name;
+      asset->path = metadata.path;
+
+      assets_[handle] = asset;
+
+      EvictUnused(handle);
+    });
+  });
 
   return handle;
 }
@@ -117,6 +242,15 @@ AssetHandle AssetRegistry::Load(const std::string& path) {
 }
 
 bool AssetRegistry::Unload(const AssetHandle& handle) {
+  failed_assets_.erase(handle);
+  MarkUsed(handle);
+  RemovePath(handle);
+
+  if (loading_assets_.erase(handle) > 0 ||
+      unloaded_assets_.erase(handle) > 0) {
+    return true;
+  }
+
   const auto it = assets_.find(handle);
   if (it == assets_.end()) {
     EVE_LOG_ENGINE_WARNING("Asset of handle: {} not found thus cannot remove!",
@@ -152,7 +286,213 @@ bool AssetRegistry::Reload(Ref<Asset>& asset) {
 }
 
 bool AssetRegistry::Exists(const AssetHandle& handle) {
-  return assets_.find(handle) != assets_.end();
+  return assets_.find(handle) != assets_.end() ||
+         loading_assets_.find(handle) != loading_assets_.end() ||
+         unloaded_assets_.find(handle) != unloaded_assets_.end();
+}
+
+AssetStatus AssetRegistry::GetStatus(const AssetHandle& handle) {
+  if (loading_assets_.find(handle) != loading_assets_.end()) {
+    return AssetStatus::kLoading;
+  } else if (assets_.find(handle) != assets_.end()) {
+    return AssetStatus::kLoaded;
+  } else if (failed_assets_.find(handle) != failed_assets_.end()) {
+    return AssetStatus::kFailed;
+  } else if (unloaded_assets_.find(handle) != unloaded_assets_.end()) {
+    return AssetStatus::kUnloaded;
+  }
+
+  return AssetStatus::kNone;
+}
+
+void AssetRegistry::Acquire(const AssetHandle& handle) {
+  if (handle == 0 || reference_counts_[handle]++ > 0) {
+    return;
+  }
+
+  MarkUsed(handle);
+
+  if (const auto it = unloaded_assets_.find(handle);
+      it != unloaded_assets_.end()) {
+    const AssetMetadata metadata = it->second;
+    LoadAsync(metadata.path, metadata.type, metadata.name, handle);
+  }
+}
+
+void AssetRegistry::Release(const AssetHandle& handle) {
+  const auto it = reference_counts_.find(handle);
+  if (it == reference_counts_.end() || --it->second > 0) {
+    return;
+  }
+
+  reference_counts_.erase(it);
+
+  if (assets_.contains(handle) || loading_assets_.contains(handle)) {
+    MarkUnused(handle);
+    EvictUnused();
+  }
+}
+
+uint32_t AssetRegistry::GetReferenceCount(const AssetHandle& handle) {
+  const auto it = reference_counts_.find(handle);
+  return it != reference_counts_.end() ? it->second : 0;
+}
+
+void AssetRegistry::ReleaseRetrieved() {
+  const std::unordered_set<AssetHandle> handles =
+      std::move(retrieved_assets_);
+  retrieved_assets_.clear();
+
+  for (const AssetHandle& handle : handles) {
+    Release(handle);
+  }
+}
+
+void AssetRegistry::SetLoadOnDemand(bool load_on_demand) {
+  load_on_demand_ = load_on_demand;
+  EvictUnused();
+}
+
+void AssetRegistry::SetMemoryBudget(size_t budget) {
+  memory_budget_ = budget;
+  EvictUnused();
+}
+
+size_t AssetRegistry::GetMemoryUsage() {
+  size_t usage = 0;
+  for (const auto& [handle, asset] : assets_) {
+    usage += asset->GetMemoryUsage();
+  }
+  return usage;
+}
+
+void AssetRegistry::AcquireRetrieved(const AssetHandle& handle) {
+  // the editor keeps every asset loaded anyway
+  if (load_on_demand_ && retrieved_assets_.insert(handle).second) {
+    Acquire(handle);
+  }
+}
+
+void AssetRegistry::MarkUsed(const AssetHandle& handle) {
+  const auto it = unused_asset_positions_.find(handle);
+  if (it == unused_asset_positions_.end()) {
+    return;
+  }
+
+  unused_assets_.erase(it->second);
+  unused_asset_positions_.erase(it);
+}
+
+void AssetRegistry::MarkUnused(const AssetHandle& handle) {
+  if (unused_asset_positions_.contains(handle)) {
+    return;
+  }
+
+  unused_asset_positions_[handle] =
+      unused_assets_.insert(unused_assets_.end(), handle);
+}
+
+void AssetRegistry::Evict(const AssetHandle& handle) {
+  MarkUsed(handle);
+
+  if (const auto it = loading_assets_.find(handle);
+      it != loading_assets_.end()) {
+    unloaded_assets_[handle] = it->second.metadata;
+    loading_assets_.erase(it);
+    return;
+  }
+
+  const auto it = assets_.find(handle);
+  if (it == assets_.end()) {
+    return;
+  }
+
+  const Ref<Asset>& asset = it->second;
+  unloaded_assets_[handle] = {asset->name, asset->path, asset->GetType()};
+
+  assets_.erase(it);
+}
+
+void AssetRegistry::EvictUnused(const AssetHandle& loaded_handle) {
+  if (!load_on_demand_ || unused_assets_.empty()) {
+    return;
+  }
+
+  size_t usage = GetMemoryUsage();
+  auto unused_it = unused_assets_.begin();
+  while (usage > memory_budget_ && unused_it != unused_assets_.end()) {
+    // advance first, evicting removes the asset from the list
+    const AssetHandle handle = *unused_it++;
+    if (handle == loaded_handle) {
+      continue;
+    }
+
+    if (const auto it = assets_.find(handle); it != assets_.end()) {
+      usage -= std::min(usage, it->second->GetMemoryUsage());
+    }
+
+    Evict(handle);
+  }
+}
+
+void AssetRegistry::IndexPath(const AssetHandle& handle,
+                              const std::string& path) {
+  RemovePath(handle);
+
+  if (path.empty()) {
+    return;
+  }
+
+  std::string normalized_path = NormalizePath(path);
+  path_index_[normalized_path] = handle;
+  asset_paths_[handle] = std::move(normalized_path);
+}
+
+void AssetRegistry::RemovePath(const AssetHandle& handle) {
+  const auto it = asset_paths_.find(handle);
+  if (it == asset_paths_.end()) {
+    return;
+  }
+
+  // the path could be taken over by another asset in the meantime
+  if (const auto index_it = path_index_.find(it->second);
+      index_it != path_index_.end() && index_it->second == handle) {
+    path_index_.erase(index_it);
+  }
+
+  asset_paths_.erase(it);
+}
+
+Ref<Asset> AssetRegistry::GetPlaceholder(AssetType type) {
+  static std::unordered_map<AssetType, Ref<Asset>> placeholders;
+
+  const auto it = placeholders.find(type);
+  if (it != placeholders.end()) {
+    return it->second;
+  }
+
+  Ref<Asset> placeholder = nullptr;
+  switch (type) {
+    case AssetType::kTexture: {
+      TextureMetadata metadata;
+      metadata.generate_mipmaps = false;
+
+      const uint32_t white = 0xffffffff;
+      placeholder = Texture::Create(metadata, &white);
+      break;
+    }
+    case AssetType::kStaticMesh:
+      placeholder = Model::CreateCube();
+      break;
+    default:
+      return nullptr;
+  }
+
+  placeholder->name = "Loading";
+
+  placeholders[type] = placeholder;
+
+  return placeholder;
 }
 
 fs::path AssetRegistry::GetAssetPath(std::string relative_path) {
@@ -199,6 +539,19 @@ fs::path AssetRegistry::GetAssetPathTrimmed(std::string relative_path) {
   return relative_path;
 }
 
+std::string AssetRegistry::NormalizePath(const std::string& path) {
+  for (const std::string_view specifier : {"res://", "prj://"}) {
+    if (path.starts_with(specifier)) {
+      return std::string(specifier) +
+             fs::path(path.substr(specifier.size()))
+                 .lexically_normal()
+                 .generic_string();
+    }
+  }
+
+  return fs::path(path).lexically_normal().generic_string();
+}
+
 std::string AssetRegistry::GetRelativePath(const std::string& path) {
   auto project_dir = Project::GetProjectDirectory();
   auto asset_dir = Project::GetAssetDirectory();
@@ -232,6 +585,22 @@ bool AssetRegistry::Serialize(const fs::path& path) {
                      {"type", asset->GetType()}});
   }
 
+  const auto push_metadata = [&j](const AssetHandle& handle,
+                                  const AssetMetadata& metadata) {
+    j.push_back(json{{"handle", (uint64_t)handle},
+                     {"name", metadata.name},
+                     {"path", metadata.path},
+                     {"type", metadata.type}});
+  };
+
+  for (const auto& [handle, asset] : loading_assets_) {
+    push_metadata(handle, asset.metadata);
+  }
+
+  for (const auto& [handle, metadata] : unloaded_assets_) {
+    push_metadata(handle, metadata);
+  }
+
   std::ofstream fout(path);
   fout << j.dump(2);
 
@@ -240,6 +609,15 @@ bool AssetRegistry::Serialize(const fs::path& path) {
 
 bool AssetRegistry::Deserialize(const fs::path& path) {
   assets_.clear();
+  loading_assets_.clear();
+  unloaded_assets_.clear();
+  failed_assets_.clear();
+  reference_counts_.clear();
+  retrieved_assets_.clear();
+  unused_assets_.clear();
+  unused_asset_positions_.clear();
+  path_index_.clear();
+  asset_paths_.clear();
 
   std::ifstream file(path);
   if (!file.is_open()) {
@@ -263,7 +641,12 @@ bool AssetRegistry::Deserialize(const fs::path& path) {
     const std::string path = asset_json["path"].get<std::string>();
     const AssetType type = asset_json["type"].get<AssetType>();
 
-    Load(path, type, name, id);
+    if (load_on_demand_) {
+      unloaded_assets_[id] = {name, path, type};
+      IndexPath(id, path);
+    } else {
+      LoadAsync(path, type, name, id);
+    }
   }
 
   return true;
@@ -10,6 +10,24 @@ namespace eve {
 
 using AssetRegistryMap = std::unordered_map<AssetHandle, Ref<Asset>>;
 
+enum class AssetStatus : uint8_t {
+  kNone = 0,
+  // known by the registry but not resident in memory
+  kUnloaded,
+  kLoading,
+  kLoaded,
+  kFailed,
+};
+
+struct AssetMetadata {
+  std::string name;
+  std::string path;
+  AssetType type = AssetType::kNone;
+};
+
+// unused assets are kept in memory until this is exceeded
+constexpr size_t kDefaultAssetMemoryBudget = 512 * 1024 * 1024;
+
 class AssetRegistry {
  public:
   AssetRegistry() = default;
@@ -37,12 +55,15 @@ class AssetRegistry {
    * @brief Get base asset from id.
    * 
    * @param id Id of the asset to retrieve
-   * @return Ref<Asset> @c Asset if exists @c nullptr otherwise.
+   * @return Ref<Asset> @c Asset if exists, a placeholder of the same type if
+   * it is still loading, @c nullptr otherwise. Assets are acquired when
+   * loaded on demand so they stay resident until @c ReleaseRetrieved.
    */
   [[nodiscard]] static Ref<Asset> Get(const AssetHandle& id);
 
   /**
-   * @brief Get base asset from path.
+   * @brief Get base asset from path, looked up through an index of
+   * normalized paths.
    * 
    * @param path Path of the asset to retrieve.
    * @return AssetHandle @c id of the asset if found @c AssetHandle(0) otherwise.
@@ -68,6 +89,21 @@ class AssetRegistry {
   static AssetHandle Load(const std::string& path, AssetType type,
                           const std::string& name, AssetHandle id = {});
 
+  /**
+   * @brief Load and register an asset without blocking. Decoding is done on
+   * the job system and the asset is uploaded and registered on the main
+   * thread, @c Get returns a placeholder until then. Loads in place if there
+   * is no instance or the asset is not worth a job.
+   *
+   * @param path Path of the asset.
+   * @param type Type of the asset.
+   * @param name Name of the asset.
+   * @param id Id of the asset default will create an unique id.
+   * @return AssetHandle Id the asset will be registered with.
+   */
+  static AssetHandle LoadAsync(const std::string& path, AssetType type,
+                               const std::string& name, AssetHandle id = {});
+
   /**
    * @brief Load and register an asset to the registry.
    * This will try to find @b name and @b type from file
@@ -96,8 +132,56 @@ class AssetRegistry {
    */
   static bool Reload(Ref<Asset>& asset);
 
+  /**
+   * @brief Whether the asset is registered or still loading.
+   */
   [[nodiscard]] static bool Exists(const AssetHandle& id);
 
+  [[nodiscard]] static AssetStatus GetStatus(const AssetHandle& id);
+
+  [[nodiscard]] static size_t GetLoadingCount() {
+    return loading_assets_.size();
+  }
+
+  /**
+   * @brief Increases reference count of the asset, loads it if it is not
+   * resident.
+   */
+  static void Acquire(const AssetHandle& id);
+
+  /**
+   * @brief Decreases reference count of the asset. Assets without references
+   * are unloaded once memory usage exceeds the budget, least recently
+   * released ones first.
+   */
+  static void Release(const AssetHandle& id);
+
+  [[nodiscard]] static uint32_t GetReferenceCount(const AssetHandle& id);
+
+  /**
+   * @brief Releases the assets acquired by @c Get, called once the ones
+   * using them, e.g. scripts of the previous scene, are gone.
+   */
+  static void ReleaseRetrieved();
+
+  /**
+   * @brief If set assets are only loaded once they are acquired or
+   * retrieved and unused ones could be unloaded. Otherwise every asset is
+   * loaded on deserialization and kept, as the editor needs.
+   */
+  static void SetLoadOnDemand(bool load_on_demand);
+
+  [[nodiscard]] static bool IsLoadOnDemand() { return load_on_demand_; }
+
+  static void SetMemoryBudget(size_t budget);
+
+  [[nodiscard]] static size_t GetMemoryBudget() { return memory_budget_; }
+
+  /**
+   * @brief Estimated memory used by the resident assets in bytes.
+   */
+  [[nodiscard]] static size_t GetMemoryUsage();
+
   /**
    * @brief Get the path with some predefined substrings.
    * Use @c res:// to get asset directory.
@@ -129,14 +213,73 @@ class AssetRegistry {
    */
   [[nodiscard]] static std::string GetRelativePath(const std::string& path);
 
+  /**
+   * @brief Normalizes @p path lexically keeping the @c res:// or @c prj://
+   * specifiers, so different spellings of a path map to the same asset.
+   */
+  [[nodiscard]] static std::string NormalizePath(const std::string& path);
+
   [[nodiscard]] static AssetRegistryMap& GetRegistryMap() { return assets_; }
 
   static bool Serialize(const fs::path& path);
 
+  /**
+   * @brief Deserializes the registry, assets are loaded asynchronously
+   * unless they are loaded on demand.
+   */
   static bool Deserialize(const fs::path& path);
 
  private:
+  [[nodiscard]] static Ref<Asset> GetPlaceholder(AssetType type);
+
+  static void AcquireRetrieved(const AssetHandle& id);
+
+  static void MarkUsed(const AssetHandle& id);
+
+  static void MarkUnused(const AssetHandle& id);
+
+  /**
+   * @brief Unloads the asset but keeps it known so it could be loaded again.
+   */
+  static void Evict(const AssetHandle& id);
+
+  /**
+   * @brief Evicts unused assets until memory usage fits the budget, except
+   * @p loaded_id which is just loaded and about to be used.
+   */
+  static void EvictUnused(const AssetHandle& loaded_id = 0);
+
+  static void IndexPath(const AssetHandle& id, const std::string& path);
+
+  static void RemovePath(const AssetHandle& id);
+
+ private:
+  struct LoadingAsset {
+    AssetMetadata metadata;
+    // identifies the latest load of the handle
+    uint32_t ticket;
+  };
+
   static AssetRegistryMap assets_;
+
+  // only accessed from the main thread
+  static std::unordered_map<AssetHandle, LoadingAsset> loading_assets_;
+  static std::unordered_map<AssetHandle, AssetMetadata> unloaded_assets_;
+  static std::unordered_set<AssetHandle> failed_assets_;
+  static uint32_t next_ticket_;
+
+  // normalized path of every known asset
+  static std::unordered_map<std::string, AssetHandle> path_index_;
+  static std::unordered_map<AssetHandle, std::string> asset_paths_;
+
+  // residency
+  static std::unordered_map<AssetHandle, uint32_t> reference_counts_;
+  static std::unordered_set<AssetHandle> retrieved_assets_;
+  static std::list<AssetHandle> unused_assets_;
+  static std::unordered_map<AssetHandle, std::list<AssetHandle>::iterator>
+      unused_asset_positions_;
+  static bool load_on_demand_;
+  static size_t memory_budget_;
 };
 
 }  // namespace eve
@@ -1,6 +1,8 @@
 #include "catch2/catch_all.hpp"
 
 #include "asset/asset_registry.h"
+#include "core/instance.h"
+#include "graphics/cooked_texture.h"
 #include "project/project.h"
 
 using namespace eve;
@@ -12,6 +14,8 @@ struct DummyAsset : Asset {
     this->name = name;
     this->handle = handle;
   }
+
+  size_t GetMemoryUsage() const override { return 1024; }
 };
 
 void CreateDummyProject() {
@@ -61,4 +65,257 @@ TEST_CASE("Test Path Utils", "[AssetRegistry]") {
 
     REQUIRE(AssetRegistry::GetAssetPathTrimmed(path_untrimmed) == path_trimmed);
   }
-}
\ No newline at end of file
+}
+TEST_CASE("Path Index", "[AssetRegistry]") {
+  CreateDummyProject();
+
+  const AssetHandle handle = 6;
+  Ref<DummyAsset> asset = CreateRef<DummyAsset>("DummyAsset", handle);
+  asset->path = "res://textures/dummy.png";
+  AssetRegistry::Register(asset);
+
+  REQUIRE(AssetRegistry::GetFromPath("res://textures/dummy.png") == handle);
+  REQUIRE(AssetRegistry::GetFromPath(
+              "res://textures/../textures/./dummy.png") == handle);
+
+  AssetRegistry::Unload(handle);
+  REQUIRE(AssetRegistry::GetFromPath("res://textures/dummy.png") == 0);
+}
+
+TEST_CASE("Asset Status", "[AssetRegistry]") {
+  CreateDummyProject();
+
+  AssetHandle dummy_handle = 2;
+  AssetRegistry::Register(CreateRef<DummyAsset>("DummyAsset", dummy_handle));
+
+  REQUIRE(AssetRegistry::GetStatus(dummy_handle) == AssetStatus::kLoaded);
+  REQUIRE(AssetRegistry::GetStatus(3) == AssetStatus::kNone);
+
+  SECTION("Failed loads are reported") {
+    // loads in place without an instance
+    const AssetHandle handle = 4;
+    REQUIRE(AssetRegistry::LoadAsync("res://missing.png", AssetType::kTexture,
+                                     "missing", handle) == 0);
+
+    REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kFailed);
+    REQUIRE_FALSE(AssetRegistry::Exists(handle));
+
+    REQUIRE(AssetRegistry::Unload(handle) == false);
+    REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kNone);
+  }
+}
+
+TEST_CASE("Asset Residency", "[AssetRegistry]") {
+  CreateDummyProject();
+
+  AssetRegistry::SetLoadOnDemand(true);
+  AssetRegistry::SetMemoryBudget(0);
+
+  const AssetHandle handle = 5;
+  AssetRegistry::Register(CreateRef<DummyAsset>("DummyAsset", handle));
+
+  AssetRegistry::Acquire(handle);
+  AssetRegistry::Acquire(handle);
+  REQUIRE(AssetRegistry::GetReferenceCount(handle) == 2);
+
+  AssetRegistry::Release(handle);
+  REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kLoaded);
+
+  // unused assets are unloaded once over budget but stay known
+  AssetRegistry::Release(handle);
+  REQUIRE(AssetRegistry::GetReferenceCount(handle) == 0);
+  REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kUnloaded);
+  REQUIRE(AssetRegistry::Exists(handle));
+
+  AssetRegistry::SetLoadOnDemand(false);
+  AssetRegistry::SetMemoryBudget(kDefaultAssetMemoryBudget);
+}
+
+class TestInstance : public Instance {
+ public:
+  TestInstance() : Instance({.name = "test", .headless = true}) {}
+
+  using Instance::ProcessMainThreadQueue;
+
+  /**
+   * @brief Runs main thread functions until @p handle is no longer loading.
+   */
+  void WaitForLoad(const AssetHandle& handle) {
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (AssetRegistry::GetStatus(handle) == AssetStatus::kLoading &&
+           std::chrono::steady_clock::now() < deadline) {
+      ProcessMainThreadQueue();
+      std::this_thread::yield();
+    }
+  }
+};
+
+// 2x2 uncompressed top-left origin bgra tga
+static void WriteTestTexture(const fs::path& path) {
+  const uint8_t header[18] = {0, 0, 2, 0, 0, 0, 0, 0, 0,
+                              0, 0, 0, 2, 0, 2, 0, 32, 0x28};
+
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(header), sizeof(header));
+  for (uint32_t i = 0; i < 4; i++) {
+    const uint32_t pixel = 0xff0000ff;
+    file.write(reinterpret_cast<const char*>(&pixel), sizeof(pixel));
+  }
+}
+
+TEST_CASE("Asynchronous Loading", "[AssetRegistry]") {
+  CreateDummyProject();
+
+  TestInstance instance;
+
+  const fs::path path = fs::temp_directory_path() / "eve_async_texture.tga";
+  WriteTestTexture(path);
+
+  SECTION("Loads complete on the main thread") {
+    const AssetHandle handle = 7;
+    REQUIRE(AssetRegistry::LoadAsync(path.string(), AssetType::kTexture,
+                                     "async", handle) == handle);
+
+    // decoded on a worker but only registered by the main thread
+    REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kLoading);
+    REQUIRE(AssetRegistry::Exists(handle));
+
+    Ref<Texture> placeholder = AssetRegistry::Get<Texture>(handle);
+    REQUIRE(placeholder);
+    REQUIRE(placeholder->name == "Loading");
+
+    instance.WaitForLoad(handle);
+    REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kLoaded);
+
+    Ref<Texture> texture = AssetRegistry::Get<Texture>(handle);
+    REQUIRE(texture != placeholder);
+    REQUIRE(texture->name == "async");
+    REQUIRE(texture->GetMetadata().size == glm::ivec2(2, 2));
+    REQUIRE(AssetRegistry::GetFromPath(path.string()) == handle);
+
+    AssetRegistry::Unload(handle);
+  }
+
+  SECTION("Unloaded assets are not registered once decoded") {
+    const AssetHandle handle = 8;
+    AssetRegistry::LoadAsync(path.string(), AssetType::kTexture, "cancelled",
+                             handle);
+    REQUIRE(AssetRegistry::Unload(handle));
+    REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kNone);
+
+    // a later load of the same file finishes after or with the cancelled one
+    const AssetHandle other_handle = 9;
+    AssetRegistry::LoadAsync(path.string(), AssetType::kTexture, "other",
+                             other_handle);
+    instance.WaitForLoad(other_handle);
+    instance.ProcessMainThreadQueue();
+
+    REQUIRE(AssetRegistry::GetStatus(other_handle) == AssetStatus::kLoaded);
+    REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kNone);
+    REQUIRE_FALSE(AssetRegistry::GetRegistryMap().contains(handle));
+
+    AssetRegistry::Unload(other_handle);
+  }
+
+  SECTION("Loading a handle again discards the previous load") {
+    const AssetHandle handle = 10;
+    AssetRegistry::LoadAsync("res://missing.png", AssetType::kTexture,
+                             "missing", handle);
+    AssetRegistry::LoadAsync(path.string(), AssetType::kTexture, "reloaded",
+                             handle);
+
+    // failure of the first load must not finish the second one
+    instance.WaitForLoad(handle);
+    instance.ProcessMainThreadQueue();
+
+    REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kLoaded);
+    REQUIRE(AssetRegistry::Get(handle)->name == "reloaded");
+
+    AssetRegistry::Unload(handle);
+  }
+
+  SECTION("Unused assets are evicted once loads complete") {
+    AssetRegistry::SetLoadOnDemand(true);
+    AssetRegistry::SetMemoryBudget(0);
+
+    const AssetHandle unused_handle = 11;
+    AssetRegistry::Register(
+        CreateRef<DummyAsset>("DummyAsset", unused_handle));
+
+    const AssetHandle handle = 12;
+    AssetRegistry::LoadAsync(path.string(), AssetType::kTexture, "loaded",
+                             handle);
+    instance.WaitForLoad(handle);
+
+    // the loaded asset itself is kept even though it is over budget
+    REQUIRE(AssetRegistry::GetStatus(unused_handle) ==
+            AssetStatus::kUnloaded);
+    REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kLoaded);
+
+    AssetRegistry::SetLoadOnDemand(false);
+    AssetRegistry::SetMemoryBudget(kDefaultAssetMemoryBudget);
+
+    AssetRegistry::Unload(unused_handle);
+    AssetRegistry::Unload(handle);
+  }
+
+  fs::remove(path);
+  fs::remove(GetCookedTexturePath(path));
+}
+
+TEST_CASE("Retrieved Assets", "[AssetRegistry]") {
+  CreateDummyProject();
+
+  AssetRegistry::SetLoadOnDemand(true);
+  AssetRegistry::SetMemoryBudget(0);
+
+  const AssetHandle handle = 13;
+  AssetRegistry::Register(CreateRef<DummyAsset>("DummyAsset", handle));
+
+  // assets retrieved outside of the scene, e.g. by scripts, are kept
+  REQUIRE(AssetRegistry::Get(handle));
+  REQUIRE(AssetRegistry::Get(handle));
+  REQUIRE(AssetRegistry::GetReferenceCount(handle) == 1);
+
+  AssetRegistry::SetMemoryBudget(0);
+  REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kLoaded);
+
+  AssetRegistry::ReleaseRetrieved();
+  REQUIRE(AssetRegistry::GetReferenceCount(handle) == 0);
+  REQUIRE(AssetRegistry::GetStatus(handle) == AssetStatus::kUnloaded);
+
+  AssetRegistry::SetLoadOnDemand(false);
+  AssetRegistry::SetMemoryBudget(kDefaultAssetMemoryBudget);
+  AssetRegistry::Unload(handle);
+}
+
+TEST_CASE("AssetRegistry path lookup benchmark",
+          "[AssetRegistry][!benchmark]") {
+  CreateDummyProject();
+
+  for (const uint32_t asset_count : {1000, 10000, 100000}) {
+    std::vector<AssetHandle> handles;
+    handles.reserve(asset_count);
+
+    for (uint32_t i = 0; i < asset_count; i++) {
+      const AssetHandle handle = 1000000 + i;
+      Ref<DummyAsset> asset = CreateRef<DummyAsset>("DummyAsset", handle);
+      asset->path = std::format("res://textures/texture_{}.png", i);
+
+      AssetRegistry::Register(asset);
+      handles.push_back(handle);
+    }
+
+    const std::string last_path =
+        std::format("res://textures/texture_{}.png", asset_count - 1);
+
+    BENCHMARK(std::format("GetFromPath {} assets", asset_count)) {
+      return AssetRegistry::GetFromPath(last_path);
+    };
+
+    for (const AssetHandle& handle : handles) {
+      AssetRegistry::Unload(handle);
+    }
+  }
+}
@@ -15,6 +15,12 @@ Instance::Instance(const InstanceSpecifications& specs) : specs_(specs) {
 
   state_ = CreateRef<State>();
 
+  state_->job_system = CreateRef<JobSystem>();
+
+  if (specs_.headless) {
+    return;
+  }
+
   WindowCreateInfo props;
   props.title = specs_.name;
   props.size = {1680, 900};
@@ -33,14 +39,22 @@ Instance::Instance(const InstanceSpecifications& specs) : specs_(specs) {
 }
 
 Instance::~Instance() {
-  if (!ScriptEngine::IsInitialized()) {
-    return;
+  // worker threads attached to the script runtime are detached through the
+  // job system, so it should be shut down first
+  if (ScriptEngine::IsInitialized()) {
+    ScriptEngine::Shutdown();
   }
 
-  ScriptEngine::Shutdown();
+  // jobs could still be enqueuing to the main thread queue
+  state_->job_system.reset();
+
+  instance_ = nullptr;
 }
 
 void Instance::StartEventLoop() {
+  EVE_ASSERT_ENGINE(!specs_.headless,
+                    "Headless instances do not have an event loop.");
+
   Timer timer;
   while (state_->running) {
     float ds = timer.GetDeltaTime();
@@ -70,12 +84,17 @@ void Instance::EnqueueMain(const std::function<void()>& function) {
 }
 
 void Instance::ProcessMainThreadQueue() {
-  std::scoped_lock<std::mutex> lock(main_thread_queue_mutex_);
-  for (auto& func : main_thread_queue_) {
-    func();
+  // run outside of the lock so the functions and worker threads can enqueue
+  // in the meantime
+  std::vector<std::function<void()>> queue;
+  {
+    std::scoped_lock<std::mutex> lock(main_thread_queue_mutex_);
+    queue.swap(main_thread_queue_);
   }
 
-  main_thread_queue_.clear();
+  for (auto& func : queue) {
+    func();
+  }
 }
 
 void Instance::PushLayer(Layer* layer) {
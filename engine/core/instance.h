@@ -16,6 +16,9 @@ struct InstanceSpecifications {
   std::string name;
   std::string description;
   CommandLineArguments args;
+  // creates only the job system and the main thread queue, without a
+  // window, renderer or ui, e.g. for tests
+  bool headless = false;
 };
 
 class Instance {
@@ -30,10 +33,14 @@ class Instance {
   Ref<State> GetState() { return state_; }
   const Ref<State>& GetState() const { return state_; }
 
+  JobSystem& GetJobSystem() { return *state_->job_system; }
+
   void Quit() { state_->running = false; }
 
   static Instance& Get() { return *instance_; };
 
+  static bool IsCreated() { return instance_ != nullptr; }
+
  protected:
   void ProcessMainThreadQueue();
 
@@ -59,7 +66,7 @@ class Instance {
   Ref<State> state_;
 
   LayerStack layers_;
-  ImGuiLayer* imgui_layer_;
+  ImGuiLayer* imgui_layer_ = nullptr;
 
   InstanceSpecifications specs_;
 
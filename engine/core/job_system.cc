@@ -0,0 +1,212 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "core/job_system.h"
+
+namespace eve {
+
+// index of the queue owned by current thread, if it's a worker
+static thread_local const JobSystem* tls_job_system = nullptr;
+static thread_local uint32_t tls_worker_index = 0;
+
+JobSystem::JobSystem(uint32_t worker_count) {
+  if (worker_count == 0) {
+    // leave one cpu for the main thread
+    worker_count = std::max(GetLogicalCpuCount() - 1, 1u);
+  }
+
+  queues_.reserve(worker_count);
+  for (uint32_t i = 0; i < worker_count; i++) {
+    queues_.push_back(CreateScope<WorkerQueue>());
+  }
+
+  workers_.reserve(worker_count);
+  for (uint32_t i = 0; i < worker_count; i++) {
+    workers_.emplace_back(&JobSystem::WorkerLoop, this, i);
+  }
+
+  EVE_LOG_ENGINE_INFO("Job system started with {} workers.", worker_count);
+}
+
+JobSystem::~JobSystem() {
+  {
+    std::scoped_lock<std::mutex> lock(wake_mutex_);
+    running_ = false;
+  }
+  wake_condition_.notify_all();
+
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void JobSystem::Submit(Job job, JobCounter* counter, JobCounter* dependency) {
+  if (counter) {
+    counter->value_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (dependency) {
+    std::scoped_lock<std::mutex> lock(dependency->continuations_mutex_);
+    if (!dependency->IsDone()) {
+      dependency->continuations_.push_back({std::move(job), counter});
+      return;
+    }
+  }
+
+  Schedule({std::move(job), counter});
+}
+
+void JobSystem::Dispatch(uint32_t job_count, uint32_t group_size,
+                         const std::function<void(uint32_t)>& job,
+                         JobCounter* counter) {
+  EVE_ASSERT_ENGINE(group_size > 0, "Dispatch group size must be non zero.");
+
+  if (job_count == 0) {
+    return;
+  }
+
+  // share the function between groups instead of copying it for each
+  auto shared_job = CreateRef<std::function<void(uint32_t)>>(job);
+
+  for (uint32_t begin = 0; begin < job_count; begin += group_size) {
+    const uint32_t end = std::min(begin + group_size, job_count);
+    Submit(
+        [shared_job, begin, end]() {
+          for (uint32_t i = begin; i < end; i++) {
+            (*shared_job)(i);
+          }
+        },
+        counter);
+  }
+}
+
+void JobSystem::Wait(const JobCounter& counter) {
+  const uint32_t queue_index = tls_job_system == this
+                                   ? tls_worker_index
+                                   : static_cast<uint32_t>(queues_.size());
+
+  Entry entry;
+  while (!counter.IsDone()) {
+    if (TryGetJob(queue_index, entry)) {
+      Execute(entry);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  // synchronize with the job which finished the counter
+  std::scoped_lock<std::mutex> lock(counter.continuations_mutex_);
+}
+
+uint32_t JobSystem::GetLogicalCpuCount() {
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void JobSystem::Schedule(Entry entry) {
+  // jobs submitted from workers stay local, others are distributed evenly
+  const uint32_t queue_index =
+      tls_job_system == this
+          ? tls_worker_index
+          : next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                static_cast<uint32_t>(queues_.size());
+
+  // increment before pushing so the counter never underflows
+  pending_jobs_.fetch_add(1);
+
+  {
+    WorkerQueue& queue = *queues_[queue_index];
+    std::scoped_lock<std::mutex> lock(queue.mutex);
+    queue.jobs.push_back(std::move(entry));
+  }
+
+  if (sleeping_workers_.load() > 0) {
+    std::scoped_lock<std::mutex> lock(wake_mutex_);
+    wake_condition_.notify_one();
+  }
+}
+
+void JobSystem::Execute(Entry& entry) {
+  entry.job();
+  entry.job = nullptr;
+
+  JobCounter* counter = entry.counter;
+  if (!counter) {
+    return;
+  }
+
+  // fast path when it's not the last job of the counter
+  uint32_t value = counter->value_.load(std::memory_order_relaxed);
+  while (value > 1) {
+    if (counter->value_.compare_exchange_weak(value, value - 1,
+                                              std::memory_order_acq_rel)) {
+      return;
+    }
+  }
+
+  // last decrement is done under the lock so waiters won't destroy the
+  // counter while continuations are being taken out of it
+  std::vector<JobCounter::Continuation> continuations;
+  {
+    std::scoped_lock<std::mutex> lock(counter->continuations_mutex_);
+    if (counter->value_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      continuations.swap(counter->continuations_);
+    }
+  }
+
+  for (auto& continuation : continuations) {
+    Schedule({std::move(continuation.job), continuation.counter});
+  }
+}
+
+bool JobSystem::TryGetJob(uint32_t queue_index, Entry& out) {
+  const uint32_t queue_count = static_cast<uint32_t>(queues_.size());
+
+  for (uint32_t i = 0; i < queue_count; i++) {
+    const uint32_t index = (queue_index + i) % queue_count;
+    const bool is_own_queue = i == 0 && queue_index < queue_count;
+
+    WorkerQueue& queue = *queues_[index];
+    std::scoped_lock<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) {
+      continue;
+    }
+
+    // pop newest from own queue for cache locality, steal the oldest
+    if (is_own_queue) {
+      out = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+    } else {
+      out = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+    }
+
+    pending_jobs_.fetch_sub(1);
+    return true;
+  }
+
+  return false;
+}
+
+void JobSystem::WorkerLoop(uint32_t worker_index) {
+  tls_job_system = this;
+  tls_worker_index = worker_index;
+
+  Entry entry;
+  while (true) {
+    if (TryGetJob(worker_index, entry)) {
+      Execute(entry);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    if (!running_) {
+      break;
+    }
+
+    sleeping_workers_.fetch_add(1);
+    wake_condition_.wait(
+        lock, [this]() { return pending_jobs_.load() > 0 || !running_; });
+    sleeping_workers_.fetch_sub(1);
+  }
+}
+
+}  // namespace eve
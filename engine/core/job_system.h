@@ -0,0 +1,125 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+
+namespace eve {
+
+using Job = std::function<void()>;
+
+class JobSystem;
+
+/**
+ * @brief Counts unfinished jobs submitted with it, could be waited on or used
+ * as a dependency of another job. Must outlive the jobs referencing it.
+ */
+class JobCounter {
+ public:
+  JobCounter() = default;
+  JobCounter(const JobCounter&) = delete;
+  JobCounter& operator=(const JobCounter&) = delete;
+
+  [[nodiscard]] bool IsDone() const {
+    return value_.load(std::memory_order_acquire) == 0;
+  }
+
+  [[nodiscard]] uint32_t GetValue() const {
+    return value_.load(std::memory_order_acquire);
+  }
+
+ private:
+  struct Continuation {
+    Job job;
+    JobCounter* counter;
+  };
+
+  std::atomic<uint32_t> value_{0};
+
+  // jobs waiting for this counter to reach zero
+  mutable std::mutex continuations_mutex_;
+  std::vector<Continuation> continuations_;
+
+  friend class JobSystem;
+};
+
+/**
+ * @brief Fixed pool of worker threads, each owning a job queue. Idle workers
+ * steal from the other queues so small jobs are balanced across the pool.
+ */
+class JobSystem {
+ public:
+  /**
+   * @param worker_count number of worker threads, zero means one per logical
+   * cpu except the calling thread.
+   */
+  JobSystem(uint32_t worker_count = 0);
+  ~JobSystem();
+
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+
+  /**
+   * @brief Schedules @p job, @p counter is decremented once it is finished.
+   * If @p dependency is given the job won't start until it reaches zero.
+   */
+  void Submit(Job job, JobCounter* counter = nullptr,
+              JobCounter* dependency = nullptr);
+
+  /**
+   * @brief Splits [0, job_count) into groups of @p group_size and runs
+   * @p job for every index of them in parallel.
+   */
+  void Dispatch(uint32_t job_count, uint32_t group_size,
+                const std::function<void(uint32_t)>& job,
+                JobCounter* counter = nullptr);
+
+  /**
+   * @brief Blocks until @p counter reaches zero, executing pending jobs in
+   * the meantime instead of sleeping.
+   */
+  void Wait(const JobCounter& counter);
+
+  [[nodiscard]] uint32_t GetWorkerCount() const {
+    return static_cast<uint32_t>(workers_.size());
+  }
+
+  [[nodiscard]] static uint32_t GetLogicalCpuCount();
+
+ private:
+  struct Entry {
+    Job job;
+    JobCounter* counter;
+  };
+
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Entry> jobs;
+  };
+
+  void Schedule(Entry entry);
+
+  void Execute(Entry& entry);
+
+  [[nodiscard]] bool TryGetJob(uint32_t queue_index, Entry& out);
+
+  void WorkerLoop(uint32_t worker_index);
+
+ private:
+  std::vector<std::thread> workers_;
+  std::vector<Scope<WorkerQueue>> queues_;
+
+  std::atomic<uint32_t> next_queue_{0};
+  std::atomic<uint32_t> pending_jobs_{0};
+
+  std::mutex wake_mutex_;
+  std::condition_variable wake_condition_;
+  std::atomic<uint32_t> sleeping_workers_{0};
+  std::atomic<bool> running_{true};
+};
+
+}  // namespace eve
@@ -0,0 +1,95 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "core/mapped_file.h"
+
+#if _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace eve {
+
+MappedFile::~MappedFile() {
+  if (!data_) {
+    return;
+  }
+
+#if _WIN32
+  UnmapViewOfFile(data_);
+  CloseHandle(mapping_handle_);
+  CloseHandle(file_handle_);
+#else
+  munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+}
+
+Ref<MappedFile> MappedFile::Open(const fs::path& path) {
+  Ref<MappedFile> file = CreateRef<MappedFile>();
+
+#if _WIN32
+  HANDLE file_handle =
+      CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file_handle, &size) || size.QuadPart == 0) {
+    CloseHandle(file_handle);
+    return nullptr;
+  }
+
+  HANDLE mapping_handle =
+      CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping_handle) {
+    CloseHandle(file_handle);
+    return nullptr;
+  }
+
+  void* data = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+  if (!data) {
+    CloseHandle(mapping_handle);
+    CloseHandle(file_handle);
+    return nullptr;
+  }
+
+  file->file_handle_ = file_handle;
+  file->mapping_handle_ = mapping_handle;
+  file->data_ = static_cast<const uint8_t*>(data);
+  file->size_ = static_cast<uint64_t>(size.QuadPart);
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+    close(fd);
+    return nullptr;
+  }
+
+  void* data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  // mapping keeps its own reference to the file
+  close(fd);
+
+  if (data == MAP_FAILED) {
+    return nullptr;
+  }
+
+  file->data_ = static_cast<const uint8_t*>(data);
+  file->size_ = static_cast<uint64_t>(file_stat.st_size);
+#endif
+
+  return file;
+}
+
+}  // namespace eve
@@ -0,0 +1,48 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+namespace eve {
+
+/**
+ * @brief Read only view of a file mapped into memory, pages are loaded by
+ * the operating system on first access instead of being copied upfront.
+ */
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * @brief Maps the whole file at @p path.
+   *
+   * @return Ref<MappedFile> mapped file or @c nullptr if it could not be
+   * opened or is empty.
+   */
+  [[nodiscard]] static Ref<MappedFile> Open(const fs::path& path);
+
+  [[nodiscard]] const uint8_t* GetData() const { return data_; }
+
+  [[nodiscard]] uint64_t GetSize() const { return size_; }
+
+  template <typename T>
+  [[nodiscard]] const T* As(uint64_t offset = 0) const {
+    return reinterpret_cast<const T*>(data_ + offset);
+  }
+
+ private:
+  const uint8_t* data_ = nullptr;
+  uint64_t size_ = 0;
+
+#if _WIN32
+  void* file_handle_ = nullptr;
+  void* mapping_handle_ = nullptr;
+#endif
+};
+
+}  // namespace eve
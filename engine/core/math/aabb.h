@@ -0,0 +1,77 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+namespace eve {
+
+/**
+ * @brief Axis aligned bounding box.
+ */
+struct AABB {
+  glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+  glm::vec3 max = glm::vec3(std::numeric_limits<float>::lowest());
+
+  [[nodiscard]] static AABB FromCenter(const glm::vec3& center,
+                                       const glm::vec3& extents) {
+    return {center - extents, center + extents};
+  }
+
+  [[nodiscard]] bool IsValid() const {
+    return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+  }
+
+  [[nodiscard]] glm::vec3 GetCenter() const { return (min + max) * 0.5f; }
+
+  [[nodiscard]] glm::vec3 GetExtents() const { return (max - min) * 0.5f; }
+
+  [[nodiscard]] float GetSurfaceArea() const {
+    const glm::vec3 d = max - min;
+    return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+  }
+
+  /**
+   * @brief Inclusive overlap test, touching boxes are overlapping.
+   */
+  [[nodiscard]] bool Overlaps(const AABB& other) const {
+    return min.x <= other.max.x && max.x >= other.min.x &&
+           min.y <= other.max.y && max.y >= other.min.y &&
+           min.z <= other.max.z && max.z >= other.min.z;
+  }
+
+  [[nodiscard]] bool Contains(const AABB& other) const {
+    return min.x <= other.min.x && min.y <= other.min.y &&
+           min.z <= other.min.z && max.x >= other.max.x &&
+           max.y >= other.max.y && max.z >= other.max.z;
+  }
+
+  void Expand(const glm::vec3& point) {
+    min = glm::min(min, point);
+    max = glm::max(max, point);
+  }
+
+  void Expand(const AABB& other) {
+    min = glm::min(min, other.min);
+    max = glm::max(max, other.max);
+  }
+
+  [[nodiscard]] static AABB Merge(const AABB& lhs, const AABB& rhs) {
+    return {glm::min(lhs.min, rhs.min), glm::max(lhs.max, rhs.max)};
+  }
+
+  /**
+   * @brief Smallest box containing this box transformed by @p matrix.
+   */
+  [[nodiscard]] AABB Transformed(const glm::mat4& matrix) const {
+    const glm::vec3 center = glm::vec3(matrix * glm::vec4(GetCenter(), 1.0f));
+
+    const glm::mat3 abs_matrix(glm::abs(glm::vec3(matrix[0])),
+                               glm::abs(glm::vec3(matrix[1])),
+                               glm::abs(glm::vec3(matrix[2])));
+
+    return FromCenter(center, abs_matrix * GetExtents());
+  }
+};
+
+}  // namespace eve
@@ -0,0 +1,67 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "core/math/aabb.h"
+
+namespace eve {
+
+/**
+ * @brief View frustum as six inward facing planes in world space.
+ */
+struct Frustum {
+  // xyz: normal, w: distance
+  std::array<glm::vec4, 6> planes;
+
+  /**
+   * @brief Extracts the planes from a combined projection * view matrix.
+   */
+  [[nodiscard]] static Frustum FromMatrix(const glm::mat4& view_proj) {
+    const glm::vec4 row_x(view_proj[0][0], view_proj[1][0], view_proj[2][0],
+                          view_proj[3][0]);
+    const glm::vec4 row_y(view_proj[0][1], view_proj[1][1], view_proj[2][1],
+                          view_proj[3][1]);
+    const glm::vec4 row_z(view_proj[0][2], view_proj[1][2], view_proj[2][2],
+                          view_proj[3][2]);
+    const glm::vec4 row_w(view_proj[0][3], view_proj[1][3], view_proj[2][3],
+                          view_proj[3][3]);
+
+    Frustum frustum;
+    frustum.planes = {
+        row_w + row_x,  // left
+        row_w - row_x,  // right
+        row_w + row_y,  // bottom
+        row_w - row_y,  // top
+        row_w + row_z,  // near
+        row_w - row_z,  // far
+    };
+
+    for (glm::vec4& plane : frustum.planes) {
+      plane /= glm::length(glm::vec3(plane));
+    }
+
+    return frustum;
+  }
+
+  /**
+   * @brief Conservative test, boxes near the corners could be reported as
+   * intersecting while being outside.
+   */
+  [[nodiscard]] bool Intersects(const AABB& aabb) const {
+    for (const glm::vec4& plane : planes) {
+      // the corner furthest along the plane normal
+      const glm::vec3 positive(plane.x >= 0.0f ? aabb.max.x : aabb.min.x,
+                               plane.y >= 0.0f ? aabb.max.y : aabb.min.y,
+                               plane.z >= 0.0f ? aabb.max.z : aabb.min.z);
+
+      if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+}  // namespace eve
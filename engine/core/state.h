@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "core/job_system.h"
 #include "core/window.h"
 #include "graphics/renderer.h"
 
@@ -10,6 +11,7 @@ namespace eve {
 struct State {
   Ref<Window> window;
   Ref<Renderer> renderer;
+  Ref<JobSystem> job_system;
   bool running{true};
 };
 
@@ -0,0 +1,44 @@
+#include "catch2/catch_all.hpp"
+
+#include "core/math/frustum.h"
+
+using namespace eve;
+
+TEST_CASE("Frustum culls bounding boxes", "[Frustum]") {
+  // looking at -z from origin
+  const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), {0.0f, 0.0f, -1.0f},
+                                     {0.0f, 1.0f, 0.0f});
+  const glm::mat4 proj =
+      glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
+
+  const Frustum frustum = Frustum::FromMatrix(proj * view);
+
+  const AABB unit_box = AABB::FromCenter(glm::vec3(0.0f), glm::vec3(0.5f));
+
+  SECTION("Boxes inside or intersecting are visible") {
+    REQUIRE(frustum.Intersects(
+        unit_box.Transformed(glm::translate(glm::mat4(1.0f), {0, 0, -10}))));
+    // intersecting with the near plane
+    REQUIRE(frustum.Intersects(unit_box));
+  }
+
+  SECTION("Boxes outside are culled") {
+    REQUIRE_FALSE(frustum.Intersects(
+        unit_box.Transformed(glm::translate(glm::mat4(1.0f), {0, 0, 10}))));
+    REQUIRE_FALSE(frustum.Intersects(
+        unit_box.Transformed(glm::translate(glm::mat4(1.0f), {50, 0, -10}))));
+    REQUIRE_FALSE(frustum.Intersects(
+        unit_box.Transformed(glm::translate(glm::mat4(1.0f), {0, 0, -200}))));
+  }
+
+  SECTION("Transformed boxes enclose rotated and scaled boxes") {
+    const glm::mat4 transform =
+        glm::rotate(glm::scale(glm::mat4(1.0f), glm::vec3(2.0f)),
+                    glm::radians(45.0f), {0.0f, 1.0f, 0.0f});
+
+    const AABB bounds = unit_box.Transformed(transform);
+    REQUIRE(bounds.max.x == Catch::Approx(std::sqrt(2.0f)));
+    REQUIRE(bounds.max.y == Catch::Approx(1.0f));
+    REQUIRE(bounds.min.z == Catch::Approx(-std::sqrt(2.0f)));
+  }
+}
@@ -0,0 +1,130 @@
+#include "catch2/catch_all.hpp"
+
+#include "core/job_system.h"
+
+using namespace eve;
+
+TEST_CASE("JobSystem executes submitted jobs", "[JobSystem]") {
+  JobSystem job_system(4);
+  REQUIRE(job_system.GetWorkerCount() == 4);
+
+  SECTION("Submit") {
+    std::atomic<uint32_t> sum = 0;
+
+    JobCounter counter;
+    for (uint32_t i = 0; i < 10000; i++) {
+      job_system.Submit([&sum]() { sum++; }, &counter);
+    }
+    job_system.Wait(counter);
+
+    REQUIRE(counter.IsDone());
+    REQUIRE(sum == 10000);
+  }
+
+  SECTION("Dispatch") {
+    std::vector<uint32_t> values(10000, 0);
+
+    JobCounter counter;
+    job_system.Dispatch(
+        values.size(), 64, [&values](uint32_t i) { values[i] = i; }, &counter);
+    job_system.Wait(counter);
+
+    for (uint32_t i = 0; i < values.size(); i++) {
+      REQUIRE(values[i] == i);
+    }
+  }
+
+  SECTION("Jobs waiting for nested jobs") {
+    std::atomic<uint32_t> sum = 0;
+
+    JobCounter counter;
+    for (uint32_t i = 0; i < 16; i++) {
+      job_system.Submit(
+          [&]() {
+            JobCounter nested_counter;
+            for (uint32_t j = 0; j < 100; j++) {
+              job_system.Submit([&sum]() { sum++; }, &nested_counter);
+            }
+            job_system.Wait(nested_counter);
+          },
+          &counter);
+    }
+    job_system.Wait(counter);
+
+    REQUIRE(sum == 1600);
+  }
+}
+
+TEST_CASE("JobSystem dependencies", "[JobSystem]") {
+  JobSystem job_system(4);
+
+  std::atomic<uint32_t> finished_count = 0;
+  std::atomic<bool> started_early = false;
+
+  JobCounter first_counter;
+  for (uint32_t i = 0; i < 100; i++) {
+    job_system.Submit(
+        [&]() {
+          std::this_thread::sleep_for(std::chrono::microseconds(10));
+          finished_count++;
+        },
+        &first_counter);
+  }
+
+  JobCounter second_counter;
+  for (uint32_t i = 0; i < 100; i++) {
+    job_system.Submit(
+        [&]() {
+          if (finished_count != 100) {
+            started_early = true;
+          }
+        },
+        &second_counter, &first_counter);
+  }
+
+  job_system.Wait(second_counter);
+
+  REQUIRE(first_counter.IsDone());
+  REQUIRE_FALSE(started_early);
+}
+
+TEST_CASE("JobSystem benchmark", "[JobSystem][!benchmark]") {
+  constexpr uint32_t kJobCount = 100000;
+
+  JobSystem job_system;
+
+  BENCHMARK("Serial 100k small jobs") {
+    std::atomic<uint32_t> sum = 0;
+    for (uint32_t i = 0; i < kJobCount; i++) {
+      sum.fetch_add(i, std::memory_order_relaxed);
+    }
+    return sum.load();
+  };
+
+  BENCHMARK("Submit 100k small jobs") {
+    std::atomic<uint32_t> sum = 0;
+
+    JobCounter counter;
+    for (uint32_t i = 0; i < kJobCount; i++) {
+      job_system.Submit(
+          [&sum, i]() { sum.fetch_add(i, std::memory_order_relaxed); },
+          &counter);
+    }
+    job_system.Wait(counter);
+
+    return sum.load();
+  };
+
+  BENCHMARK("Dispatch 100k small jobs") {
+    std::atomic<uint32_t> sum = 0;
+
+    JobCounter counter;
+    job_system.Dispatch(
+        kJobCount, 256,
+        [&sum](uint32_t i) { sum.fetch_add(i, std::memory_order_relaxed); },
+        &counter);
+    job_system.Wait(counter);
+
+    return sum.load();
+  };
+}
@@ -0,0 +1,31 @@
+#include "catch2/catch_all.hpp"
+
+#include "core/mapped_file.h"
+
+using namespace eve;
+
+TEST_CASE("MappedFile maps file contents", "[MappedFile]") {
+  const std::string test_file_path = "test_mapped_file.bin";
+
+  const std::string test_content = "Hello, MappedFile!";
+
+  std::ofstream test_file(test_file_path, std::ios::binary);
+  test_file << test_content;
+  test_file.close();
+
+  SECTION("Contents are readable") {
+    Ref<MappedFile> file = MappedFile::Open(test_file_path);
+
+    REQUIRE(file);
+    REQUIRE(file->GetSize() == test_content.size());
+
+    std::string content(file->As<char>(), file->GetSize());
+    REQUIRE(content == test_content);
+  }
+
+  SECTION("Missing files are not mapped") {
+    REQUIRE_FALSE(MappedFile::Open("missing_mapped_file.bin"));
+  }
+
+  std::remove(test_file_path.c_str());
+}
@@ -16,6 +16,9 @@ struct Camera {
   [[nodiscard]] virtual glm::mat4 GetProjectionMatrix() const = 0;
 
   [[nodiscard]] virtual glm::mat4 GetViewMatrix(const Transform& transform) = 0;
+
+  [[nodiscard]] virtual glm::mat4 GetViewMatrix(
+      const WorldTransform& transform) = 0;
 };
 
 }  // namespace eve
\ No newline at end of file
@@ -0,0 +1,289 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/cooked_texture.h"
+
+#include "core/debug/log.h"
+#include "core/uuid.h"
+#include "graphics/texture_compression.h"
+#include "graphics/texture_residency.h"
+
+namespace eve {
+
+// File layout, every blob starts aligned to kCookedTextureAlignment and
+// values are stored in the native (little endian) byte order:
+//   CookedTextureHeader
+//   CookedTextureLevel[level_count]
+//   uint8_t[] for each level, largest first
+
+static constexpr char kCookedTextureMagic[4] = {'E', 'T', 'E', 'X'};
+static constexpr uint64_t kCookedTextureAlignment = 16;
+
+struct CookedTextureHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t format;
+  int32_t width;
+  int32_t height;
+  uint32_t level_count;
+  uint64_t levels_offset;
+};
+
+struct CookedTextureLevel {
+  uint64_t offset;
+  uint64_t size;
+};
+
+static_assert(std::is_trivially_copyable_v<CookedTextureHeader>);
+static_assert(std::is_trivially_copyable_v<CookedTextureLevel>);
+
+[[nodiscard]] static uint64_t Align(uint64_t offset) {
+  return (offset + kCookedTextureAlignment - 1) &
+         ~(kCookedTextureAlignment - 1);
+}
+
+static void WritePadding(std::ofstream& file, uint64_t offset) {
+  static constexpr char kZeros[kCookedTextureAlignment] = {};
+
+  const uint64_t position = static_cast<uint64_t>(file.tellp());
+  file.write(kZeros, offset - position);
+}
+
+[[nodiscard]] static uint32_t GetMipChainLength(const glm::ivec2& size) {
+  return static_cast<uint32_t>(std::floor(std::log2(std::max(size.x, size.y)))) +
+         1;
+}
+
+[[nodiscard]] static std::vector<uint8_t> ConvertToRGBA(
+    const uint8_t* pixels, const TextureMetadata& metadata) {
+  const uint64_t pixel_count =
+      static_cast<uint64_t>(metadata.size.x) * metadata.size.y;
+
+  std::vector<uint8_t> rgba(pixel_count * 4);
+  for (uint64_t i = 0; i < pixel_count; i++) {
+    uint8_t* dst = rgba.data() + i * 4;
+    switch (metadata.format) {
+      case TextureFormat::kRed:
+        dst[0] = dst[1] = dst[2] = pixels[i];
+        dst[3] = 255;
+        break;
+      case TextureFormat::kRG:
+        dst[0] = pixels[i * 2];
+        dst[1] = pixels[i * 2 + 1];
+        dst[2] = 0;
+        dst[3] = 255;
+        break;
+      case TextureFormat::kRGB:
+        std::copy_n(pixels + i * 3, 3, dst);
+        dst[3] = 255;
+        break;
+      case TextureFormat::kBGR:
+        dst[0] = pixels[i * 3 + 2];
+        dst[1] = pixels[i * 3 + 1];
+        dst[2] = pixels[i * 3];
+        dst[3] = 255;
+        break;
+      case TextureFormat::kBGRA:
+        dst[0] = pixels[i * 4 + 2];
+        dst[1] = pixels[i * 4 + 1];
+        dst[2] = pixels[i * 4];
+        dst[3] = pixels[i * 4 + 3];
+        break;
+      default:
+        std::copy_n(pixels + i * 4, 4, dst);
+        break;
+    }
+  }
+
+  return rgba;
+}
+
+fs::path GetCookedTexturePath(const fs::path& source_path) {
+  fs::path cooked_path = source_path;
+  cooked_path += kCookedTextureExtension;
+  return cooked_path;
+}
+
+bool IsCookedTextureUpToDate(const fs::path& source_path,
+                             const fs::path& cooked_path) {
+  std::error_code error;
+  if (!fs::exists(cooked_path, error)) {
+    return false;
+  }
+
+  if (!fs::exists(source_path, error)) {
+    return true;
+  }
+
+  return fs::last_write_time(cooked_path, error) >=
+         fs::last_write_time(source_path, error);
+}
+
+bool CookTexture(const TextureImage& image, const fs::path& path) {
+  const TextureMetadata& metadata = image.metadata;
+  if (!image.pixels || IsCompressedTextureFormat(metadata.format)) {
+    return false;
+  }
+
+  std::vector<uint8_t> pixels = ConvertToRGBA(image.pixels.get(), metadata);
+
+  // layers of texture arrays are copied as they are, so the base level has
+  // to match the array size
+  const glm::ivec2 base_size =
+      TextureResidency::GetArrayMetadata(metadata).size;
+  if (base_size != metadata.size) {
+    pixels = ResizeImage(pixels.data(), metadata.size, base_size);
+  }
+
+  const TextureFormat format =
+      ChooseCompressedFormat(pixels.data(), base_size);
+
+  glm::ivec2 size = base_size;
+
+  std::vector<std::vector<uint8_t>> levels;
+  while (true) {
+    levels.push_back(CompressImage(pixels.data(), size, format));
+
+    if (!metadata.generate_mipmaps || (size.x == 1 && size.y == 1)) {
+      break;
+    }
+
+    pixels = GenerateMipLevel(pixels.data(), size);
+    size = glm::max(size / 2, 1);
+  }
+
+  CookedTextureHeader header = {};
+  std::copy_n(kCookedTextureMagic, 4, header.magic);
+  header.version = kCookedTextureVersion;
+  header.format = static_cast<uint32_t>(format);
+  header.width = base_size.x;
+  header.height = base_size.y;
+  header.level_count = static_cast<uint32_t>(levels.size());
+  header.levels_offset = Align(sizeof(CookedTextureHeader));
+
+  std::vector<CookedTextureLevel> cooked_levels(levels.size());
+
+  uint64_t offset = Align(header.levels_offset +
+                          levels.size() * sizeof(CookedTextureLevel));
+  for (uint32_t i = 0; i < levels.size(); i++) {
+    cooked_levels[i].offset = offset;
+    cooked_levels[i].size = levels[i].size();
+    offset = Align(offset + levels[i].size());
+  }
+
+  // write next to the destination and swap so readers never see a partial
+  // file, unique so loads of the same texture could cook at the same time
+  fs::path temp_path = path;
+  temp_path += std::format(".{}.tmp", (uint64_t)UUID());
+
+  std::error_code error;
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+      return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    WritePadding(file, header.levels_offset);
+    file.write(reinterpret_cast<const char*>(cooked_levels.data()),
+               cooked_levels.size() * sizeof(CookedTextureLevel));
+
+    for (uint32_t i = 0; i < levels.size(); i++) {
+      WritePadding(file, cooked_levels[i].offset);
+      file.write(reinterpret_cast<const char*>(levels[i].data()),
+                 levels[i].size());
+    }
+
+    if (!file.good()) {
+      file.close();
+      fs::remove(temp_path, error);
+      return false;
+    }
+  }
+
+  fs::rename(temp_path, path, error);
+  if (error) {
+    fs::remove(temp_path, error);
+    return false;
+  }
+
+  return true;
+}
+
+bool LoadCookedTexture(const fs::path& path, TextureImage& image) {
+  Ref<MappedFile> file = MappedFile::Open(path);
+  if (!file) {
+    EVE_LOG_ENGINE_ERROR("Unable to open cooked texture: {}", path.string());
+    return false;
+  }
+
+  const uint64_t file_size = file->GetSize();
+
+  const auto is_in_file = [file_size](uint64_t offset, uint64_t count,
+                                      uint64_t element_size) {
+    return offset <= file_size && count <= (file_size - offset) / element_size;
+  };
+
+  if (file_size < sizeof(CookedTextureHeader)) {
+    EVE_LOG_ENGINE_ERROR("Cooked texture is corrupted: {}", path.string());
+    return false;
+  }
+
+  const CookedTextureHeader& header = *file->As<CookedTextureHeader>();
+  if (!std::equal(header.magic, header.magic + 4, kCookedTextureMagic) ||
+      header.version != kCookedTextureVersion) {
+    EVE_LOG_ENGINE_ERROR("Cooked texture is of an unsupported version: {}",
+                         path.string());
+    return false;
+  }
+
+  const TextureFormat format = static_cast<TextureFormat>(header.format);
+  if (!IsCompressedTextureFormat(format) || header.width <= 0 ||
+      header.height <= 0 || header.width > kMaxTextureArraySize ||
+      header.height > kMaxTextureArraySize || header.level_count == 0 ||
+      header.level_count > GetMipChainLength({header.width, header.height}) ||
+      !is_in_file(header.levels_offset, header.level_count,
+                  sizeof(CookedTextureLevel))) {
+    EVE_LOG_ENGINE_ERROR("Cooked texture is corrupted: {}", path.string());
+    return false;
+  }
+
+  const CookedTextureLevel* levels =
+      file->As<CookedTextureLevel>(header.levels_offset);
+
+  const glm::ivec2 size = {header.width, header.height};
+
+  std::vector<TextureLevelData> level_data;
+  level_data.reserve(header.level_count);
+
+  for (uint32_t i = 0; i < header.level_count; i++) {
+    const CookedTextureLevel& level = levels[i];
+
+    const glm::ivec2 level_size = glm::max(size >> int(i), 1);
+    if (level.size != GetTextureLevelSize(format, level_size) ||
+        !is_in_file(level.offset, level.size, 1)) {
+      EVE_LOG_ENGINE_ERROR("Cooked texture is corrupted: {}", path.string());
+      return false;
+    }
+
+    level_data.emplace_back(file->As<uint8_t>(level.offset), level.size);
+  }
+
+  image.metadata.size = size;
+  image.metadata.format = format;
+  image.metadata.min_filter = TextureFilteringMode::kLinear;
+  image.metadata.mag_filter = TextureFilteringMode::kLinear;
+  image.metadata.wrap_s = TextureWrappingMode::kRepeat;
+  image.metadata.wrap_t = TextureWrappingMode::kRepeat;
+  // levels are already there, nothing left to generate
+  image.metadata.generate_mipmaps = false;
+  image.metadata.mip_count = header.level_count;
+
+  image.pixels = nullptr;
+  image.levels = std::move(level_data);
+  image.mapped_file = file;
+
+  return true;
+}
+
+}  // namespace eve
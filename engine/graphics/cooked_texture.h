@@ -0,0 +1,45 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "graphics/texture.h"
+
+namespace eve {
+
+constexpr uint32_t kCookedTextureVersion = 1;
+constexpr const char* kCookedTextureExtension = ".etex";
+
+/**
+ * @brief Cooked texture of @p source_path lives next to it, `albedo.png` is
+ * cooked into `albedo.png.etex`.
+ */
+[[nodiscard]] fs::path GetCookedTexturePath(const fs::path& source_path);
+
+/**
+ * @brief Cooked texture is up to date if it is newer than its source, or if
+ * the source is not shipped at all.
+ */
+[[nodiscard]] bool IsCookedTextureUpToDate(const fs::path& source_path,
+                                           const fs::path& cooked_path);
+
+/**
+ * @brief Block compresses decoded pixels of @p image into a versioned
+ * binary file with its whole mip chain. Images are scaled to the size of
+ * their texture array so layers can be copied without decompressing.
+ *
+ * @return true if the file is written successfully.
+ */
+bool CookTexture(const TextureImage& image, const fs::path& path);
+
+/**
+ * @brief Maps a cooked texture file, levels of @p image point into the
+ * mapped memory and are uploaded as they are.
+ *
+ * @return false if the file is missing, corrupted or of an other version.
+ */
+[[nodiscard]] bool LoadCookedTexture(const fs::path& path,
+                                     TextureImage& image);
+
+}  // namespace eve
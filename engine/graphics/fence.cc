@@ -0,0 +1,24 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/fence.h"
+
+#include "graphics/graphics.h"
+#include "graphics/platforms/null/null_fence.h"
+#include "graphics/platforms/opengl/opengl_fence.h"
+
+namespace eve {
+Ref<Fence> Fence::Create() {
+  switch (GetGraphicsAPI()) {
+    case GraphicsAPI::kOpenGL:
+      return CreateRef<OpenGLFence>();
+    case GraphicsAPI::kNull:
+      return CreateRef<NullFence>();
+    case GraphicsAPI::kVulkan:
+      EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
+      return nullptr;
+    default:
+      EVE_ASSERT_ENGINE(false, "Unknown graphics API");
+      return nullptr;
+  }
+}
+}  // namespace eve
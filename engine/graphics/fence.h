@@ -0,0 +1,25 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+namespace eve {
+/**
+ * @brief GPU synchronization point inserted into the command stream on
+ * creation, signaled once the device has executed every command before it.
+ */
+class Fence {
+ public:
+  virtual ~Fence() = default;
+
+  [[nodiscard]] virtual bool IsSignaled() = 0;
+
+  /**
+   * @brief Blocks the calling thread until the fence is signaled.
+   */
+  virtual void Wait() = 0;
+
+  [[nodiscard]] static Ref<Fence> Create();
+};
+}  // namespace eve
@@ -3,6 +3,7 @@
 #include "graphics/frame_buffer.h"
 
 #include "graphics/graphics.h"
+#include "graphics/platforms/null/null_frame_buffer.h"
 #include "graphics/platforms/opengl/opengl_frame_buffer.h"
 
 namespace eve {
@@ -10,6 +11,8 @@ Ref<FrameBuffer> FrameBuffer::Create(const glm::ivec2 size) {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLFrameBuffer>(size);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullFrameBuffer>(size);
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -9,6 +9,10 @@
 
 namespace eve {
 constexpr GraphicsAPI GetGraphicsAPI() {
+#ifdef EVE_GRAPHICS_API_NULL
+  return GraphicsAPI::kNull;
+#else
   return GraphicsAPI::kOpenGL;
+#endif
 }
 }  // namespace eve
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "graphics/graphics_context.h"
 
 #include "graphics/graphics.h"
+#include "graphics/platforms/null/null_context.h"
 #include "graphics/platforms/opengl/opengl_context.h"
 
 namespace eve {
@@ -10,6 +11,8 @@ Ref<GraphicsContext> GraphicsContext::Create() {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLContext>();
+    case GraphicsAPI::kNull:
+      return CreateRef<NullContext>();
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
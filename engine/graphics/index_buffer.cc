@@ -3,6 +3,7 @@
 #include "graphics/index_buffer.h"
 
 #include "graphics/graphics.h"
+#include "graphics/platforms/null/null_index_buffer.h"
 #include "graphics/platforms/opengl/opengl_index_buffer.h"
 
 namespace eve {
@@ -11,6 +12,8 @@ Ref<IndexBuffer> IndexBuffer::Create(uint32_t size) {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLIndexBuffer>(size);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullIndexBuffer>(size);
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -24,6 +27,8 @@ Ref<IndexBuffer> IndexBuffer::Create(const uint32_t* indices, uint32_t count) {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLIndexBuffer>(indices, count);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullIndexBuffer>(indices, count);
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -15,4 +15,8 @@ glm::mat4 OrthographicCamera::GetViewMatrix(const Transform& transform) {
   return glm::inverse(transform.GetTransformMatrix());
 }
 
+glm::mat4 OrthographicCamera::GetViewMatrix(const WorldTransform& transform) {
+  return glm::inverse(transform.matrix);
+}
+
 }  // namespace eve
\ No newline at end of file
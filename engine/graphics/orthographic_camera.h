@@ -16,6 +16,9 @@ struct OrthographicCamera : Camera {
   [[nodiscard]] glm::mat4 GetProjectionMatrix() const override;
 
   [[nodiscard]] glm::mat4 GetViewMatrix(const Transform& transform) override;
+
+  [[nodiscard]] glm::mat4 GetViewMatrix(
+      const WorldTransform& transform) override;
 };
 
 }  // namespace eve
\ No newline at end of file
@@ -8,6 +8,12 @@ glm::mat4 PerspectiveCamera::GetViewMatrix(const Transform& transform) {
                      transform.GetUp());
 }
 
+glm::mat4 PerspectiveCamera::GetViewMatrix(const WorldTransform& transform) {
+  return glm::lookAt(transform.position,
+                     transform.position + transform.GetForward(),
+                     transform.GetUp());
+}
+
 glm::mat4 PerspectiveCamera::GetProjectionMatrix() const {
   return glm::perspective(glm::radians(fov), aspect_ratio, near_clip, far_clip);
 }
@@ -15,6 +15,9 @@ struct PerspectiveCamera : Camera {
 
   [[nodiscard]] glm::mat4 GetViewMatrix(const Transform& transform) override;
 
+  [[nodiscard]] glm::mat4 GetViewMatrix(
+      const WorldTransform& transform) override;
+
   [[nodiscard]] glm::mat4 GetProjectionMatrix() const override;
 };
 
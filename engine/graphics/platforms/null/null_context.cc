@@ -0,0 +1,18 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_context.h"
+
+#include "graphics/platforms/null/null_device.h"
+
+namespace eve {
+void NullContext::Init() {
+  GetNullDeviceRecord() = NullDeviceRecord();
+}
+
+DeviceInformation NullContext::GetDeviceInfo() const {
+  DeviceInformation info;
+  info.vendor = "eve";
+  info.renderer = "Null Device";
+  return info;
+}
+}  // namespace eve
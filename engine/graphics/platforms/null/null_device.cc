@@ -0,0 +1,38 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_device.h"
+
+namespace eve {
+
+static NullDeviceRecord s_record;
+static std::atomic_uint32_t s_next_resource_id = 1;
+
+void NullDeviceRecord::Reset() {
+  uploaded_bytes = 0;
+  clear_count = 0;
+  fence_wait_count = 0;
+  layer_copy_count = 0;
+  draw_commands.clear();
+}
+
+uint32_t NullDeviceRecord::GetDrawCount() const {
+  return draw_commands.size();
+}
+
+uint64_t NullDeviceRecord::GetVertexCount() const {
+  uint64_t vertex_count = 0;
+  for (const auto& command : draw_commands) {
+    vertex_count += (uint64_t)command.count * command.instance_count;
+  }
+  return vertex_count;
+}
+
+NullDeviceRecord& GetNullDeviceRecord() {
+  return s_record;
+}
+
+uint32_t GenerateNullResourceID() {
+  return s_next_resource_id++;
+}
+
+}  // namespace eve
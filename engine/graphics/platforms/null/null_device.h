@@ -0,0 +1,59 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+namespace eve {
+
+class VertexArray;
+
+enum class NullDrawType {
+  kArrays,
+  kIndexed,
+  kLines,
+  kArraysInstanced,
+  kIndexedInstanced,
+};
+
+struct NullDrawCommand final {
+  NullDrawType type;
+  const VertexArray* vertex_array;
+  uint32_t count;
+  uint32_t instance_count = 1;
+  // first vertex of arrays or base vertex of indexed draws
+  uint32_t first_vertex = 0;
+};
+
+/**
+ * @brief Records every call the null backend receives instead of sending it
+ * to a device, so the CPU side of the renderer can be measured headless.
+ */
+struct NullDeviceRecord final {
+  uint64_t uploaded_bytes = 0;
+  uint32_t buffer_count = 0;
+  uint32_t texture_count = 0;
+  uint32_t clear_count = 0;
+  uint32_t fence_count = 0;
+  uint32_t fence_wait_count = 0;
+  uint32_t layer_copy_count = 0;
+  std::vector<NullDrawCommand> draw_commands;
+
+  /**
+   * @brief Clears per frame counters, live resource counts are preserved.
+   */
+  void Reset();
+
+  [[nodiscard]] uint32_t GetDrawCount() const;
+  [[nodiscard]] uint64_t GetVertexCount() const;
+};
+
+[[nodiscard]] NullDeviceRecord& GetNullDeviceRecord();
+
+/**
+ * @brief Generates unique resource ids so that textures and buffers can
+ * still be compared like their device backed counterparts.
+ */
+[[nodiscard]] uint32_t GenerateNullResourceID();
+
+}  // namespace eve
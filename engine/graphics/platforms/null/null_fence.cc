@@ -0,0 +1,23 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_fence.h"
+
+#include "graphics/platforms/null/null_device.h"
+
+namespace eve {
+NullFence::NullFence() {
+  GetNullDeviceRecord().fence_count++;
+}
+
+NullFence::~NullFence() {
+  GetNullDeviceRecord().fence_count--;
+}
+
+bool NullFence::IsSignaled() {
+  return true;
+}
+
+void NullFence::Wait() {
+  GetNullDeviceRecord().fence_wait_count++;
+}
+}  // namespace eve
@@ -0,0 +1,20 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/fence.h"
+
+namespace eve {
+/**
+ * @brief There is no device to wait for, so fences are always signaled.
+ */
+class NullFence final : public Fence {
+ public:
+  NullFence();
+  ~NullFence();
+
+  bool IsSignaled() override;
+
+  void Wait() override;
+};
+}  // namespace eve
@@ -0,0 +1,36 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_frame_buffer.h"
+
+#include "graphics/platforms/null/null_texture.h"
+
+namespace eve {
+NullFrameBuffer::NullFrameBuffer(const glm::ivec2& size) : size_(size) {
+  Refresh();
+}
+
+void NullFrameBuffer::Bind() const {}
+
+void NullFrameBuffer::Unbind() const {}
+
+void NullFrameBuffer::Refresh() {
+  TextureMetadata metadata;
+  metadata.size = size_;
+  metadata.format = TextureFormat::kRGB;
+  metadata.generate_mipmaps = false;
+
+  texture_ = CreateRef<NullTexture2D>(metadata);
+}
+
+const glm::ivec2& NullFrameBuffer::GetSize() {
+  return size_;
+}
+
+void NullFrameBuffer::SetSize(glm::ivec2 size) {
+  size_ = size;
+}
+
+Ref<Texture> NullFrameBuffer::GetTexture() {
+  return texture_;
+}
+}  // namespace eve
@@ -0,0 +1,28 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/frame_buffer.h"
+
+namespace eve {
+class NullFrameBuffer final : public FrameBuffer {
+ public:
+  NullFrameBuffer(const glm::ivec2& size);
+
+  void Bind() const override;
+
+  void Unbind() const override;
+
+  void Refresh() override;
+
+  [[nodiscard]] const glm::ivec2& GetSize() override;
+  void SetSize(glm::ivec2 size) override;
+
+  Ref<Texture> GetTexture() override;
+
+ private:
+  glm::ivec2 size_;
+
+  Ref<Texture> texture_;
+};
+}  // namespace eve
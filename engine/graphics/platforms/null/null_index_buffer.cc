@@ -0,0 +1,34 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_index_buffer.h"
+
+#include "graphics/platforms/null/null_device.h"
+
+namespace eve {
+NullIndexBuffer::NullIndexBuffer(uint32_t) {
+  GetNullDeviceRecord().buffer_count++;
+}
+
+NullIndexBuffer::NullIndexBuffer(const uint32_t*, uint32_t count)
+    : count_(count) {
+  NullDeviceRecord& record = GetNullDeviceRecord();
+  record.buffer_count++;
+  record.uploaded_bytes += count * sizeof(uint32_t);
+}
+
+NullIndexBuffer::~NullIndexBuffer() {
+  GetNullDeviceRecord().buffer_count--;
+}
+
+void NullIndexBuffer::Bind() {}
+
+void NullIndexBuffer::Unbind() {}
+
+void NullIndexBuffer::SetData(const void*, uint32_t size) {
+  GetNullDeviceRecord().uploaded_bytes += size;
+}
+
+uint32_t NullIndexBuffer::GetCount() {
+  return count_;
+}
+}  // namespace eve
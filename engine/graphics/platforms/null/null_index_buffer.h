@@ -0,0 +1,24 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/index_buffer.h"
+
+namespace eve {
+class NullIndexBuffer final : public IndexBuffer {
+ public:
+  NullIndexBuffer(uint32_t size);
+  NullIndexBuffer(const uint32_t* indices, uint32_t count);
+  ~NullIndexBuffer();
+
+  void Bind() override;
+  void Unbind() override;
+
+  void SetData(const void* data, uint32_t size) override;
+
+  uint32_t GetCount() override;
+
+ private:
+  uint32_t count_ = 0;
+};
+}  // namespace eve
@@ -0,0 +1,66 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_renderer_api.h"
+
+#include "graphics/platforms/null/null_device.h"
+
+namespace eve {
+
+void NullRendererAPI::Init() {}
+
+void NullRendererAPI::SetViewport(uint32_t, uint32_t, uint32_t, uint32_t) {}
+
+void NullRendererAPI::SetClearColor(const Color&) {}
+
+void NullRendererAPI::Clear(uint16_t) {
+  GetNullDeviceRecord().clear_count++;
+}
+
+void NullRendererAPI::DrawArrays(const Ref<VertexArray>& vertex_array,
+                                 uint32_t vertex_count) {
+  GetNullDeviceRecord().draw_commands.push_back(
+      {NullDrawType::kArrays, vertex_array.get(), vertex_count});
+}
+
+void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertex_array,
+                                  uint32_t index_count, uint32_t base_vertex) {
+  uint32_t count =
+      index_count ? index_count : vertex_array->GetIndexBuffer()->GetCount();
+  GetNullDeviceRecord().draw_commands.push_back(
+      {NullDrawType::kIndexed, vertex_array.get(), count, 1, base_vertex});
+}
+
+void NullRendererAPI::DrawLines(const Ref<VertexArray>& vertex_array,
+                                uint32_t vertex_count, uint32_t first_vertex) {
+  GetNullDeviceRecord().draw_commands.push_back(
+      {NullDrawType::kLines, vertex_array.get(), vertex_count, 1,
+       first_vertex});
+}
+
+void NullRendererAPI::DrawArraysInstanced(const Ref<VertexArray>& vertex_array,
+                                          uint32_t vertex_count,
+                                          uint32_t instance_count) {
+  GetNullDeviceRecord().draw_commands.push_back(
+      {NullDrawType::kArraysInstanced, vertex_array.get(), vertex_count,
+       instance_count});
+}
+
+void NullRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertex_array,
+                                           uint32_t index_count,
+                                           uint32_t instance_count) {
+  uint32_t count =
+      index_count ? index_count : vertex_array->GetIndexBuffer()->GetCount();
+  GetNullDeviceRecord().draw_commands.push_back(
+      {NullDrawType::kIndexedInstanced, vertex_array.get(), count,
+       instance_count});
+}
+
+void NullRendererAPI::SetLineWidth(float) {}
+
+void NullRendererAPI::SetPolygonMode(PolygonMode) {}
+
+void NullRendererAPI::SetDepthFunc(DepthFunc) {}
+
+void NullRendererAPI::SetActiveTexture(uint8_t) {}
+
+}  // namespace eve
@@ -0,0 +1,36 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_shader.h"
+
+namespace eve {
+// Shader sources are never read, there is nothing to compile them into.
+NullShader::NullShader(const std::string&, const std::string&,
+                       const std::string&) {}
+
+void NullShader::Recompile(const std::string&, const std::string&,
+                           const std::string&) {}
+
+void NullShader::Bind() const {}
+
+void NullShader::Unbind() const {}
+
+void NullShader::SetUniform(const std::string&, ShaderValueVariant) const {}
+
+void NullShader::SetUniform(const std::string&, int) const {}
+
+void NullShader::SetUniform(const std::string&, float) const {}
+
+void NullShader::SetUniform(const std::string&, glm::vec2) const {}
+
+void NullShader::SetUniform(const std::string&, glm::vec3) const {}
+
+void NullShader::SetUniform(const std::string&, glm::vec4) const {}
+
+void NullShader::SetUniform(const std::string&, const glm::mat3&) const {}
+
+void NullShader::SetUniform(const std::string&, const glm::mat4&) const {}
+
+void NullShader::SetUniform(const std::string&, int, int*) const {}
+
+void NullShader::SetUniform(const std::string&, int, float*) const {}
+}  // namespace eve
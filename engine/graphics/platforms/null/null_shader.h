@@ -0,0 +1,44 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/shader.h"
+
+namespace eve {
+class NullShader final : public Shader {
+ public:
+  NullShader(const std::string& vs_path, const std::string& fs_path,
+             const std::string& custom_shader = "");
+
+  void Recompile(const std::string& vs_path, const std::string& fs_path,
+                 const std::string& custom_shader = "") override;
+
+  void Bind() const override;
+
+  void Unbind() const override;
+
+  void SetUniform(const std::string& name,
+                  ShaderValueVariant value) const override;
+  void SetUniform(const std::string& name, int value) const override;
+  void SetUniform(const std::string& name, float value) const override;
+  void SetUniform(const std::string& name, glm::vec2 value) const override;
+  void SetUniform(const std::string& name, glm::vec3 value) const override;
+  void SetUniform(const std::string& name, glm::vec4 value) const override;
+  void SetUniform(const std::string& name,
+                  const glm::mat3& value) const override;
+  void SetUniform(const std::string& name,
+                  const glm::mat4& value) const override;
+  void SetUniform(const std::string& name, int count,
+                  int* value) const override;
+  void SetUniform(const std::string& name, int count,
+                  float* value) const override;
+
+  [[nodiscard]] const std::vector<ShaderUniform>& GetUniformFields()
+      const override {
+    return custom_uniforms_;
+  };
+
+ private:
+  std::vector<ShaderUniform> custom_uniforms_;
+};
+}  // namespace eve
@@ -0,0 +1,11 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_skybox.h"
+
+namespace eve {
+
+void NullSkyBox::Bind() const {}
+
+void NullSkyBox::UnBind() const {}
+
+}  // namespace eve
@@ -0,0 +1,21 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "graphics/skybox.h"
+
+namespace eve {
+
+class NullSkyBox final : public SkyBox {
+ public:
+  NullSkyBox() = default;
+  virtual ~NullSkyBox() = default;
+
+  void Bind() const override;
+
+  void UnBind() const override;
+};
+
+}  // namespace eve
@@ -0,0 +1,68 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_texture.h"
+
+#include "graphics/platforms/null/null_device.h"
+
+namespace eve {
+NullTexture2D::NullTexture2D(const TextureMetadata& metadata,
+                             const void* pixels)
+    : metadata_(metadata), texture_id_(GenerateNullResourceID()) {
+  NullDeviceRecord& record = GetNullDeviceRecord();
+  record.texture_count++;
+
+  if (pixels) {
+    record.uploaded_bytes +=
+        GetTextureLevelSize(metadata_.format, metadata_.size);
+  }
+}
+
+NullTexture2D::NullTexture2D(const TextureMetadata& metadata,
+                             std::span<const TextureLevelData> levels)
+    : metadata_(metadata), texture_id_(GenerateNullResourceID()) {
+  EVE_ASSERT_ENGINE(IsCompressedTextureFormat(metadata_.format),
+                    "Levels could only be given for compressed formats!");
+  EVE_ASSERT_ENGINE(!levels.empty() && levels.size() == metadata_.mip_count);
+
+  NullDeviceRecord& record = GetNullDeviceRecord();
+  record.texture_count++;
+
+  for (uint32_t level = 0; level < levels.size(); level++) {
+    EVE_ASSERT_ENGINE(
+        levels[level].size() ==
+            GetTextureLevelSize(metadata_.format,
+                                glm::max(metadata_.size >> int(level), 1)),
+        "Level size does not match the texture!");
+
+    record.uploaded_bytes += levels[level].size();
+  }
+}
+
+NullTexture2D::~NullTexture2D() {
+  GetNullDeviceRecord().texture_count--;
+}
+
+const TextureMetadata& NullTexture2D::GetMetadata() const {
+  return metadata_;
+}
+
+uint32_t NullTexture2D::GetTextureID() const {
+  return texture_id_;
+}
+
+void NullTexture2D::SetData(void*, uint32_t size) {
+  EVE_ASSERT_ENGINE(size == GetTextureLevelSize(metadata_.format,
+                                                 metadata_.size),
+                    "Data must be entire texture!");
+
+  GetNullDeviceRecord().uploaded_bytes += size;
+
+  version_++;
+}
+
+void NullTexture2D::Bind(uint16_t) const {}
+
+bool NullTexture2D::operator==(const Texture& other) const {
+  return texture_id_ == other.GetTextureID();
+}
+}  // namespace eve
@@ -0,0 +1,39 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_texture_array.h"
+
+#include "graphics/platforms/null/null_device.h"
+
+namespace eve {
+NullTextureArray::NullTextureArray(const TextureArrayMetadata& metadata,
+                                   uint32_t layer_count)
+    : metadata_(metadata), layer_count_(layer_count) {
+  GetNullDeviceRecord().texture_count++;
+}
+
+NullTextureArray::~NullTextureArray() {
+  GetNullDeviceRecord().texture_count--;
+}
+
+const TextureArrayMetadata& NullTextureArray::GetMetadata() const {
+  return metadata_;
+}
+
+uint32_t NullTextureArray::GetLayerCount() const {
+  return layer_count_;
+}
+
+void NullTextureArray::Resize(uint32_t layer_count) {
+  EVE_ASSERT_ENGINE(layer_count >= layer_count_,
+                    "Texture arrays can not be shrunk!");
+  layer_count_ = layer_count;
+}
+
+void NullTextureArray::SetLayer(uint32_t layer, const Texture&) {
+  EVE_ASSERT_ENGINE(layer < layer_count_, "Texture array layer overflow!");
+
+  GetNullDeviceRecord().layer_copy_count++;
+}
+
+void NullTextureArray::Bind(uint16_t) const {}
+}  // namespace eve
@@ -0,0 +1,27 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/texture_array.h"
+
+namespace eve {
+class NullTextureArray final : public TextureArray {
+ public:
+  NullTextureArray(const TextureArrayMetadata& metadata, uint32_t layer_count);
+  ~NullTextureArray();
+
+  const TextureArrayMetadata& GetMetadata() const override;
+
+  uint32_t GetLayerCount() const override;
+
+  void Resize(uint32_t layer_count) override;
+
+  void SetLayer(uint32_t layer, const Texture& texture) override;
+
+  void Bind(uint16_t slot = 0) const override;
+
+ private:
+  TextureArrayMetadata metadata_;
+  uint32_t layer_count_;
+};
+}  // namespace eve
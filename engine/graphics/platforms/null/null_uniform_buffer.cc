@@ -0,0 +1,20 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_uniform_buffer.h"
+
+#include "graphics/platforms/null/null_device.h"
+
+namespace eve {
+NullUniformBuffer::NullUniformBuffer(uint32_t size, uint32_t) : size_(size) {
+  GetNullDeviceRecord().buffer_count++;
+}
+
+NullUniformBuffer::~NullUniformBuffer() {
+  GetNullDeviceRecord().buffer_count--;
+}
+
+void NullUniformBuffer::SetData(const void*, uint32_t size, uint32_t offset) {
+  EVE_ASSERT_ENGINE(offset + size <= size_, "Uniform buffer overflow!");
+  GetNullDeviceRecord().uploaded_bytes += size;
+}
+}  // namespace eve
@@ -0,0 +1,18 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/uniform_buffer.h"
+
+namespace eve {
+class NullUniformBuffer final : public UniformBuffer {
+ public:
+  NullUniformBuffer(uint32_t size, uint32_t binding);
+  ~NullUniformBuffer();
+
+  void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+ private:
+  uint32_t size_;
+};
+}  // namespace eve
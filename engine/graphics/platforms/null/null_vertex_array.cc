@@ -0,0 +1,28 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_vertex_array.h"
+
+namespace eve {
+void NullVertexArray::Bind() const {}
+
+void NullVertexArray::Unbind() const {}
+
+const std::vector<Ref<VertexBuffer>>& NullVertexArray::GetVertexBuffers()
+    const {
+  return vertex_buffers_;
+}
+
+void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertex_buffer) {
+  EVE_ASSERT_ENGINE(vertex_buffer->GetLayout().GetElements().size(),
+                    "Vertex Buffer has no layout!");
+  vertex_buffers_.push_back(vertex_buffer);
+}
+
+const Ref<IndexBuffer>& NullVertexArray::GetIndexBuffer() const {
+  return index_buffer_;
+}
+
+void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& index_buffer) {
+  index_buffer_ = index_buffer;
+}
+}  // namespace eve
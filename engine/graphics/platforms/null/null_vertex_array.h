@@ -0,0 +1,24 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/vertex_array.h"
+
+namespace eve {
+class NullVertexArray final : public VertexArray {
+ public:
+  void Bind() const override;
+  void Unbind() const override;
+
+  [[nodiscard]] const std::vector<Ref<VertexBuffer>>& GetVertexBuffers()
+      const override;
+  void AddVertexBuffer(const Ref<VertexBuffer>& vertex_buffer) override;
+
+  [[nodiscard]] const Ref<IndexBuffer>& GetIndexBuffer() const override;
+  void SetIndexBuffer(const Ref<IndexBuffer>& index_buffer) override;
+
+ private:
+  std::vector<Ref<VertexBuffer>> vertex_buffers_;
+  Ref<IndexBuffer> index_buffer_;
+};
+}  // namespace eve
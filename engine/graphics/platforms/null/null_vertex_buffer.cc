@@ -0,0 +1,47 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/null/null_vertex_buffer.h"
+
+#include "graphics/platforms/null/null_device.h"
+
+namespace eve {
+NullVertexBuffer::NullVertexBuffer(uint32_t size, VertexBufferUsage usage)
+    : size_(size) {
+  GetNullDeviceRecord().buffer_count++;
+
+  if (usage == VertexBufferUsage::kPersistentMapped) {
+    mapped_data_.resize(size);
+  }
+}
+
+NullVertexBuffer::NullVertexBuffer(const void*, uint32_t size) : size_(size) {
+  NullDeviceRecord& record = GetNullDeviceRecord();
+  record.buffer_count++;
+  record.uploaded_bytes += size;
+}
+
+NullVertexBuffer::~NullVertexBuffer() {
+  GetNullDeviceRecord().buffer_count--;
+}
+
+void NullVertexBuffer::Bind() {}
+
+void NullVertexBuffer::Unbind() {}
+
+void NullVertexBuffer::SetData(const void*, uint32_t size) {
+  EVE_ASSERT_ENGINE(size <= size_, "Vertex buffer overflow!");
+  GetNullDeviceRecord().uploaded_bytes += size;
+}
+
+void* NullVertexBuffer::GetMappedData() {
+  return mapped_data_.empty() ? nullptr : mapped_data_.data();
+}
+
+const BufferLayout& NullVertexBuffer::GetLayout() {
+  return layout_;
+}
+
+void NullVertexBuffer::SetLayout(const BufferLayout& layout) {
+  layout_ = layout;
+}
+}  // namespace eve
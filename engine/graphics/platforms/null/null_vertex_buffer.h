@@ -0,0 +1,31 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/vertex_buffer.h"
+
+namespace eve {
+class NullVertexBuffer final : public VertexBuffer {
+ public:
+  NullVertexBuffer(uint32_t size, VertexBufferUsage usage);
+  NullVertexBuffer(const void* vertices, uint32_t size);
+  ~NullVertexBuffer();
+
+  void Bind() override;
+  void Unbind() override;
+
+  void SetData(const void* data, uint32_t size) override;
+
+  void* GetMappedData() override;
+
+  const BufferLayout& GetLayout() override;
+  void SetLayout(const BufferLayout& layout) override;
+
+ private:
+  uint32_t size_;
+  BufferLayout layout_;
+
+  // stands in for the device memory of mapped buffers
+  std::vector<uint8_t> mapped_data_;
+};
+}  // namespace eve
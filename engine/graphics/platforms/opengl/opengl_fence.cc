@@ -0,0 +1,38 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/opengl/opengl_fence.h"
+
+#include <glad/glad.h>
+
+namespace eve {
+OpenGLFence::OpenGLFence() {
+  sync_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+OpenGLFence::~OpenGLFence() {
+  glDeleteSync(sync_);
+}
+
+bool OpenGLFence::IsSignaled() {
+  GLint status = GL_UNSIGNALED;
+  glGetSynciv(sync_, GL_SYNC_STATUS, sizeof(GLint), nullptr, &status);
+  return status == GL_SIGNALED;
+}
+
+void OpenGLFence::Wait() {
+  // 1 ms at a time so a lost context won't block forever
+  constexpr GLuint64 kTimeout = 1000000;
+
+  GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+  while (true) {
+    const GLenum result = glClientWaitSync(sync_, flags, kTimeout);
+    if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED ||
+        result == GL_WAIT_FAILED) {
+      return;
+    }
+
+    // commands are already flushed by the first call
+    flags = 0;
+  }
+}
+}  // namespace eve
@@ -0,0 +1,22 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/fence.h"
+
+typedef struct __GLsync* GLsync;
+
+namespace eve {
+class OpenGLFence final : public Fence {
+ public:
+  OpenGLFence();
+  ~OpenGLFence();
+
+  bool IsSignaled() override;
+
+  void Wait() override;
+
+ private:
+  GLsync sync_;
+};
+}  // namespace eve
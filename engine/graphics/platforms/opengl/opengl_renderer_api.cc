@@ -49,17 +49,20 @@ void OpenGLRendererAPI::DrawArrays(const Ref<VertexArray>& vertex_array,
 }
 
 void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertex_array,
-                                    uint32_t index_count) {
+                                    uint32_t index_count,
+                                    uint32_t base_vertex) {
   vertex_array->Bind();
   uint32_t count =
       index_count ? index_count : vertex_array->GetIndexBuffer()->GetCount();
-  glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+  glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr,
+                           base_vertex);
 }
 
 void OpenGLRendererAPI::DrawLines(const Ref<VertexArray>& vertex_array,
-                                  uint32_t vertex_count) {
+                                  uint32_t vertex_count,
+                                  uint32_t first_vertex) {
   vertex_array->Bind();
-  glDrawArrays(GL_LINES, 0, vertex_count);
+  glDrawArrays(GL_LINES, first_vertex, vertex_count);
 }
 
 void OpenGLRendererAPI::DrawArraysInstanced(
@@ -69,6 +72,16 @@ void OpenGLRendererAPI::DrawArraysInstanced(
   glDrawArraysInstanced(GL_TRIANGLES, 0, vertex_count, instance_count);
 }
 
+void OpenGLRendererAPI::DrawIndexedInstanced(
+    const Ref<VertexArray>& vertex_array, uint32_t index_count,
+    uint32_t instance_count) {
+  vertex_array->Bind();
+  uint32_t count =
+      index_count ? index_count : vertex_array->GetIndexBuffer()->GetCount();
+  glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr,
+                          instance_count);
+}
+
 void OpenGLRendererAPI::SetLineWidth(float width) {
   glLineWidth(width);
 }
@@ -16,15 +16,20 @@ class OpenGLRendererAPI final : public RendererAPI {
   void DrawArrays(const Ref<VertexArray>& vertex_array,
                   uint32_t vertex_count) override;
   void DrawIndexed(const Ref<VertexArray>& vertex_array,
-                   uint32_t index_Count = 0) override;
+                   uint32_t index_count = 0,
+                   uint32_t base_vertex = 0) override;
 
-  void DrawLines(const Ref<VertexArray>& vertex_array,
-                 uint32_t vertex_count) override;
+  void DrawLines(const Ref<VertexArray>& vertex_array, uint32_t vertex_count,
+                 uint32_t first_vertex = 0) override;
 
   void DrawArraysInstanced(const Ref<VertexArray>& vertex_array,
                            uint32_t vertex_count,
                            uint32_t instance_count) override;
 
+  void DrawIndexedInstanced(const Ref<VertexArray>& vertex_array,
+                            uint32_t index_count,
+                            uint32_t instance_count) override;
+
   void SetLineWidth(float width) override;
 
   void SetPolygonMode(PolygonMode mode = PolygonMode::kFill) override;
@@ -4,6 +4,10 @@
 
 #include <glad/glad.h>
 
+// S3TC is an extension, glad is generated without it
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+
 namespace eve {
 int DeserializeTextureFormat(TextureFormat format) {
   switch (format) {
@@ -19,6 +23,12 @@ int DeserializeTextureFormat(TextureFormat format) {
       return GL_RGBA;
     case TextureFormat::kBGRA:
       return GL_BGRA;
+    case TextureFormat::kBC1:
+      return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    case TextureFormat::kBC3:
+      return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case TextureFormat::kBC7:
+      return GL_COMPRESSED_RGBA_BPTC_UNORM;
     default:
       return -1;
   }
@@ -76,6 +86,45 @@ OpenGLTexture2D::OpenGLTexture2D(const TextureMetadata& metadata,
   }
 }
 
+OpenGLTexture2D::OpenGLTexture2D(const TextureMetadata& metadata,
+                                 std::span<const TextureLevelData> levels)
+    : metadata_(metadata) {
+  EVE_ASSERT_ENGINE(IsCompressedTextureFormat(metadata_.format),
+                    "Levels could only be given for compressed formats!");
+  EVE_ASSERT_ENGINE(!levels.empty() && levels.size() == metadata_.mip_count);
+
+  glCreateTextures(GL_TEXTURE_2D, 1, &texture_id_);
+
+  int min_filter = DeserializeTextureFilteringMode(metadata_.min_filter);
+  if (levels.size() > 1) {
+    min_filter = metadata_.min_filter == TextureFilteringMode::kNearest
+                     ? GL_NEAREST_MIPMAP_NEAREST
+                     : GL_LINEAR_MIPMAP_LINEAR;
+  }
+
+  glTextureParameteri(texture_id_, GL_TEXTURE_MIN_FILTER, min_filter);
+  glTextureParameteri(texture_id_, GL_TEXTURE_MAG_FILTER,
+                      DeserializeTextureFilteringMode(metadata_.mag_filter));
+  glTextureParameteri(texture_id_, GL_TEXTURE_WRAP_S,
+                      DeserializeTextureWrappingMode(metadata_.wrap_s));
+  glTextureParameteri(texture_id_, GL_TEXTURE_WRAP_T,
+                      DeserializeTextureWrappingMode(metadata_.wrap_t));
+
+  const int format = DeserializeTextureFormat(metadata_.format);
+
+  glTextureStorage2D(texture_id_, levels.size(), format, metadata_.size.x,
+                     metadata_.size.y);
+
+  // blocks are uploaded as they are, the driver does not decode anything
+  for (uint32_t level = 0; level < levels.size(); level++) {
+    const glm::ivec2 size = glm::max(metadata_.size >> int(level), 1);
+
+    glCompressedTextureSubImage2D(texture_id_, level, 0, 0, size.x, size.y,
+                                  format, levels[level].size(),
+                                  levels[level].data());
+  }
+}
+
 OpenGLTexture2D::~OpenGLTexture2D() {
   glDeleteTextures(1, &texture_id_);
 }
@@ -98,6 +147,8 @@ void OpenGLTexture2D::SetData(void* data, uint32_t size) {
 
   glTextureSubImage2D(texture_id_, 0, 0, 0, metadata_.size.x, metadata_.size.y,
                       format, GL_UNSIGNED_BYTE, data);
+
+  version_++;
 }
 
 void OpenGLTexture2D::Bind(uint16_t slot) const {
@@ -5,10 +5,18 @@
 #include "graphics/texture.h"
 
 namespace eve {
+int DeserializeTextureFormat(TextureFormat format);
+
+int DeserializeTextureFilteringMode(TextureFilteringMode mode);
+
+int DeserializeTextureWrappingMode(TextureWrappingMode mode);
+
 class OpenGLTexture2D final : public Texture {
  public:
   OpenGLTexture2D(const TextureMetadata& metadata,
                   const void* pixels = nullptr);
+  OpenGLTexture2D(const TextureMetadata& metadata,
+                  std::span<const TextureLevelData> levels);
   ~OpenGLTexture2D();
 
   const TextureMetadata& GetMetadata() const override;
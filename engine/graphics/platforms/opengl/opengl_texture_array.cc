@@ -0,0 +1,151 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/platforms/opengl/opengl_texture_array.h"
+
+#include <glad/glad.h>
+
+#include "graphics/platforms/opengl/opengl_texture.h"
+
+namespace eve {
+OpenGLTextureArray::OpenGLTextureArray(const TextureArrayMetadata& metadata,
+                                       uint32_t layer_count)
+    : metadata_(metadata), layer_count_(layer_count), level_count_(1) {
+  if (metadata_.generate_mipmaps) {
+    const int max_size = std::max(metadata_.size.x, metadata_.size.y);
+    level_count_ = static_cast<uint32_t>(std::floor(std::log2(max_size))) + 1;
+  }
+
+  texture_id_ = CreateStorage(layer_count_);
+}
+
+OpenGLTextureArray::~OpenGLTextureArray() {
+  glDeleteTextures(1, &texture_id_);
+}
+
+const TextureArrayMetadata& OpenGLTextureArray::GetMetadata() const {
+  return metadata_;
+}
+
+uint32_t OpenGLTextureArray::GetLayerCount() const {
+  return layer_count_;
+}
+
+void OpenGLTextureArray::Resize(uint32_t layer_count) {
+  EVE_ASSERT_ENGINE(layer_count >= layer_count_,
+                    "Texture arrays can not be shrunk!");
+
+  const uint32_t new_texture_id = CreateStorage(layer_count);
+
+  // copy every level of the existing layers on the device
+  for (uint32_t level = 0; level < level_count_; level++) {
+    const int width = std::max(metadata_.size.x >> level, 1);
+    const int height = std::max(metadata_.size.y >> level, 1);
+
+    glCopyImageSubData(texture_id_, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+                       new_texture_id, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+                       width, height, layer_count_);
+  }
+
+  glDeleteTextures(1, &texture_id_);
+
+  texture_id_ = new_texture_id;
+  layer_count_ = layer_count;
+}
+
+void OpenGLTextureArray::SetLayer(uint32_t layer, const Texture& texture) {
+  EVE_ASSERT_ENGINE(layer < layer_count_, "Texture array layer overflow!");
+
+  const glm::ivec2& source_size = texture.GetMetadata().size;
+
+  // compressed blocks could not be blitted, copy every level as it is
+  if (IsCompressedTextureFormat(metadata_.format)) {
+    EVE_ASSERT_ENGINE(source_size == metadata_.size &&
+                          texture.GetMetadata().mip_count == level_count_,
+                      "Compressed texture does not match the array!");
+
+    for (uint32_t level = 0; level < level_count_; level++) {
+      const int width = std::max(metadata_.size.x >> level, 1);
+      const int height = std::max(metadata_.size.y >> level, 1);
+
+      glCopyImageSubData(texture.GetTextureID(), GL_TEXTURE_2D, level, 0, 0, 0,
+                         texture_id_, GL_TEXTURE_2D_ARRAY, level, 0, 0, layer,
+                         width, height, 1);
+    }
+    return;
+  }
+
+  const int filter =
+      metadata_.mag_filter == TextureFilteringMode::kNearest ? GL_NEAREST
+                                                             : GL_LINEAR;
+
+  uint32_t framebuffers[2];
+  glCreateFramebuffers(2, framebuffers);
+
+  const uint32_t read_framebuffer = framebuffers[0];
+  const uint32_t draw_framebuffer = framebuffers[1];
+
+  glNamedFramebufferReadBuffer(read_framebuffer, GL_COLOR_ATTACHMENT0);
+  glNamedFramebufferDrawBuffer(draw_framebuffer, GL_COLOR_ATTACHMENT0);
+
+  // scale the source into the base level
+  glNamedFramebufferTexture(read_framebuffer, GL_COLOR_ATTACHMENT0,
+                            texture.GetTextureID(), 0);
+  glNamedFramebufferTextureLayer(draw_framebuffer, GL_COLOR_ATTACHMENT0,
+                                 texture_id_, 0, layer);
+  glBlitNamedFramebuffer(read_framebuffer, draw_framebuffer, 0, 0,
+                         source_size.x, source_size.y, 0, 0, metadata_.size.x,
+                         metadata_.size.y, GL_COLOR_BUFFER_BIT, filter);
+
+  // then downsample each level from the previous one, generating mipmaps of
+  // the whole array would touch every other layer as well
+  for (uint32_t level = 1; level < level_count_; level++) {
+    glNamedFramebufferTextureLayer(read_framebuffer, GL_COLOR_ATTACHMENT0,
+                                   texture_id_, level - 1, layer);
+    glNamedFramebufferTextureLayer(draw_framebuffer, GL_COLOR_ATTACHMENT0,
+                                   texture_id_, level, layer);
+
+    glBlitNamedFramebuffer(
+        read_framebuffer, draw_framebuffer, 0, 0,
+        std::max(metadata_.size.x >> (level - 1), 1),
+        std::max(metadata_.size.y >> (level - 1), 1), 0, 0,
+        std::max(metadata_.size.x >> level, 1),
+        std::max(metadata_.size.y >> level, 1), GL_COLOR_BUFFER_BIT,
+        GL_LINEAR);
+  }
+
+  glDeleteFramebuffers(2, framebuffers);
+}
+
+void OpenGLTextureArray::Bind(uint16_t slot) const {
+  glBindTextureUnit(slot, texture_id_);
+}
+
+uint32_t OpenGLTextureArray::CreateStorage(uint32_t layer_count) const {
+  uint32_t texture_id;
+  glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &texture_id);
+
+  int min_filter = DeserializeTextureFilteringMode(metadata_.min_filter);
+  if (level_count_ > 1) {
+    min_filter = metadata_.min_filter == TextureFilteringMode::kNearest
+                     ? GL_NEAREST_MIPMAP_NEAREST
+                     : GL_LINEAR_MIPMAP_LINEAR;
+  }
+
+  glTextureParameteri(texture_id, GL_TEXTURE_MIN_FILTER, min_filter);
+  glTextureParameteri(texture_id, GL_TEXTURE_MAG_FILTER,
+                      DeserializeTextureFilteringMode(metadata_.mag_filter));
+  glTextureParameteri(texture_id, GL_TEXTURE_WRAP_S,
+                      DeserializeTextureWrappingMode(metadata_.wrap_s));
+  glTextureParameteri(texture_id, GL_TEXTURE_WRAP_T,
+                      DeserializeTextureWrappingMode(metadata_.wrap_t));
+
+  const int internal_format = IsCompressedTextureFormat(metadata_.format)
+                                  ? DeserializeTextureFormat(metadata_.format)
+                                  : GL_RGBA8;
+
+  glTextureStorage3D(texture_id, level_count_, internal_format,
+                     metadata_.size.x, metadata_.size.y, layer_count);
+
+  return texture_id;
+}
+}  // namespace eve
@@ -0,0 +1,34 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "graphics/texture_array.h"
+
+namespace eve {
+class OpenGLTextureArray final : public TextureArray {
+ public:
+  OpenGLTextureArray(const TextureArrayMetadata& metadata,
+                     uint32_t layer_count);
+  ~OpenGLTextureArray();
+
+  const TextureArrayMetadata& GetMetadata() const override;
+
+  uint32_t GetLayerCount() const override;
+
+  void Resize(uint32_t layer_count) override;
+
+  void SetLayer(uint32_t layer, const Texture& texture) override;
+
+  void Bind(uint16_t slot = 0) const override;
+
+ private:
+  [[nodiscard]] uint32_t CreateStorage(uint32_t layer_count) const;
+
+ private:
+  TextureArrayMetadata metadata_;
+  uint32_t layer_count_;
+  uint32_t level_count_;
+
+  uint32_t texture_id_;
+};
+}  // namespace eve
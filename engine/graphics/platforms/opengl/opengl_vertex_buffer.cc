@@ -5,10 +5,21 @@
 #include <glad/glad.h>
 
 namespace eve {
-OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size) {
+OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size,
+                                       VertexBufferUsage usage) {
   glCreateBuffers(1, &vbo_);
   glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-  // TODO documentate this constructor and tell the client this defines as DYNAMIC_DRAW
+
+  if (usage == VertexBufferUsage::kPersistentMapped) {
+    // coherent mapping, writes are visible to the GPU without flushing
+    const GLbitfield flags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+    mapped_data_ = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+    return;
+  }
+
   glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
 }
 
@@ -19,6 +30,10 @@ OpenGLVertexBuffer::OpenGLVertexBuffer(const void* vertices, uint32_t size) {
 }
 
 OpenGLVertexBuffer::~OpenGLVertexBuffer() {
+  if (mapped_data_) {
+    glUnmapNamedBuffer(vbo_);
+  }
+
   glDeleteBuffers(1, &vbo_);
 }
 
@@ -35,6 +50,10 @@ void OpenGLVertexBuffer::SetData(const void* data, uint32_t size) {
   glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
 }
 
+void* OpenGLVertexBuffer::GetMappedData() {
+  return mapped_data_;
+}
+
 const BufferLayout& OpenGLVertexBuffer::GetLayout() {
   return layout_;
 }
@@ -7,7 +7,7 @@
 namespace eve {
 class OpenGLVertexBuffer final : public VertexBuffer {
  public:
-  OpenGLVertexBuffer(uint32_t size);
+  OpenGLVertexBuffer(uint32_t size, VertexBufferUsage usage);
   OpenGLVertexBuffer(const void* vertices, uint32_t size);
   ~OpenGLVertexBuffer();
 
@@ -16,11 +16,15 @@ class OpenGLVertexBuffer final : public VertexBuffer {
 
   void SetData(const void* data, uint32_t size) override;
 
+  void* GetMappedData() override;
+
   const BufferLayout& GetLayout() override;
   void SetLayout(const BufferLayout& layout) override;
 
  private:
   uint32_t vbo_;
   BufferLayout layout_;
+
+  void* mapped_data_ = nullptr;
 };
 }  // namespace eve
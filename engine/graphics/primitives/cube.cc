@@ -11,10 +11,8 @@ namespace eve {
 CubePrimitive::CubePrimitive() {
   vertex_array_ = VertexArray::Create();
 
-  // initialize vertex buffer
-  vertices_.Allocate(kCubeMaxVertexCount);
-
-  vertex_buffer_ = VertexBuffer::Create(vertices_.GetSize());
+  // vertices are written directly into the mapped ring buffer
+  vertex_buffer_ = vertices_.GetVertexBuffer();
   vertex_buffer_->SetLayout({
       {ShaderDataType::kFloat4, "a_position"},
       {ShaderDataType::kFloat2, "a_tex_coords"},
@@ -55,19 +53,24 @@ void CubePrimitive::Render(RenderStats& stats) {
     return;
   }
 
-  vertex_buffer_->SetData(vertices_.GetData(), vertices_.GetSize());
-
   shader_->Bind();
-  RenderCommand::DrawIndexed(vertex_array_, index_count_);
+  RenderCommand::DrawIndexed(vertex_array_, index_count_,
+                             vertices_.GetBaseIndex());
+
+  vertices_.Submit();
 
   stats.draw_calls++;
 }
 
 void CubePrimitive::Reset() {
-  vertices_.ResetIndex();
+  vertices_.Reset();
   index_count_ = 0;
 }
 
+void CubePrimitive::EndFrame() {
+  vertices_.EndFrame();
+}
+
 void CubePrimitive::AddInstance(const Transform& transform,
                                 const Color& color) {
   const glm::mat4 model_matrix = transform.GetTransformMatrix();
@@ -6,6 +6,7 @@
 
 #include "core/buffer.h"
 #include "graphics/material.h"
+#include "graphics/ring_buffer.h"
 #include "graphics/shader.h"
 #include "graphics/vertex_array.h"
 #include "scene/transform.h"
@@ -38,6 +39,9 @@ class CubePrimitive {
 
   void Reset();
 
+  // moves on to the next frame's segment of the vertex ring buffer
+  void EndFrame();
+
   void AddInstance(const Transform& transform, const Color& color);
 
   [[nodiscard]] bool NeedsNewBatch();
@@ -47,7 +51,7 @@ class CubePrimitive {
   Ref<VertexBuffer> vertex_buffer_;
   Ref<Shader> shader_;
 
-  BufferArray<CubeVertex> vertices_;
+  RingBufferArray<CubeVertex> vertices_{kCubeMaxVertexCount};
   uint32_t index_count_ = 0;
 };
 
@@ -0,0 +1,149 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/primitives/instanced_mesh.h"
+
+#include "graphics/render_command.h"
+#include "graphics/renderer.h"
+
+namespace eve {
+
+InstancedMeshPrimitive::InstancedMeshPrimitive(
+    Ref<TextureResidency> texture_residency)
+    : texture_residency_(texture_residency) {
+  shader_ = Shader::Create("assets/shaders/mesh_instanced.vert",
+                           "assets/shaders/mesh.frag");
+
+  TextureResidency::SetSamplers(*shader_);
+}
+
+void InstancedMeshPrimitive::Render(RenderStats& stats) {
+  bool bound = false;
+
+  for (auto& [handle, model_buffers] : models_) {
+    for (auto& mesh : model_buffers.meshes) {
+      const uint32_t instance_count = mesh->instances.GetCount();
+      if (instance_count <= 0) {
+        continue;
+      }
+
+      // Bind shared state only if there is something to draw
+      if (!bound) {
+        texture_residency_->Bind();
+
+        shader_->Bind();
+        bound = true;
+      }
+
+      // diffuse maps which are not resident take the first slot
+      if (mesh->diffuse_index >= kTextureSlotIndexBase) {
+        mesh->diffuse_map->Bind(kMaxTextureArrays);
+      }
+
+      mesh->instance_buffer->SetData(mesh->instances.GetData(),
+                                     instance_count * sizeof(MeshInstance));
+
+      RenderCommand::DrawIndexedInstanced(mesh->vertex_array,
+                                          mesh->index_count, instance_count);
+
+      stats.draw_calls++;
+    }
+  }
+}
+
+void InstancedMeshPrimitive::Reset() {
+  // release static buffers of the models which are not loaded anymore
+  std::erase_if(models_,
+                [](const auto& pair) { return pair.second.model.expired(); });
+
+  for (auto& [handle, model_buffers] : models_) {
+    for (auto& mesh : model_buffers.meshes) {
+      mesh->instances.ResetIndex();
+    }
+  }
+}
+
+void InstancedMeshPrimitive::AddInstance(const Ref<Model>& model,
+                                         const glm::mat4& transform,
+                                         const Material& material) {
+  ModelBuffers& model_buffers = GetOrCreateModelBuffers(model);
+
+  for (auto& mesh : model_buffers.meshes) {
+    MeshInstance instance;
+    instance.transform = transform;
+    instance.albedo = material.albedo;
+    instance.diffuse_index = mesh->diffuse_index;
+
+    mesh->instances.Add(instance);
+  }
+}
+
+bool InstancedMeshPrimitive::NeedsNewBatch(const Ref<Model>& model) {
+  const auto it = models_.find(model->handle);
+  if (it == models_.end() || it->second.meshes.empty() ||
+      it->second.model.lock() != model) {
+    return false;
+  }
+
+  // every mesh of a model receives the same amount of instances
+  return it->second.meshes.front()->instances.GetCount() >= kMeshMaxInstances;
+}
+
+float InstancedMeshPrimitive::FindTexture(const Ref<Texture>& texture) {
+  // every mesh is drawn on its own so it could always use the first slot
+  return (float)texture_residency_->GetIndex(texture).value_or(
+      kTextureSlotIndexBase);
+}
+
+InstancedMeshPrimitive::ModelBuffers&
+InstancedMeshPrimitive::GetOrCreateModelBuffers(const Ref<Model>& model) {
+  auto it = models_.find(model->handle);
+  if (it != models_.end() && it->second.model.lock() == model) {
+    return it->second;
+  }
+
+  ModelBuffers& model_buffers = models_[model->handle];
+  model_buffers.model = model;
+  model_buffers.meshes.clear();
+
+  for (const MeshData& mesh_data : model->meshes) {
+    Scope<MeshBuffers> mesh = CreateScope<MeshBuffers>();
+    mesh->vertex_array = VertexArray::Create();
+
+    // vertices are kept in model space and uploaded only once
+    Ref<VertexBuffer> vertex_buffer =
+        VertexBuffer::Create(mesh_data.vertices.data(),
+                             mesh_data.vertices.size() * sizeof(MeshVertex));
+    vertex_buffer->SetLayout({
+        {ShaderDataType::kFloat4, "a_position"},
+        {ShaderDataType::kFloat4, "a_albedo"},
+        {ShaderDataType::kFloat3, "a_normal"},
+        {ShaderDataType::kFloat2, "a_tex_coords"},
+        {ShaderDataType::kFloat, "a_diffuse_index"},
+    });
+    mesh->vertex_array->AddVertexBuffer(vertex_buffer);
+
+    mesh->instances.Allocate(kMeshMaxInstances);
+
+    mesh->instance_buffer = VertexBuffer::Create(mesh->instances.GetSize());
+    mesh->instance_buffer->SetLayout({
+        {ShaderDataType::kMat4, "a_instance_transform", false, 1},
+        {ShaderDataType::kFloat4, "a_instance_albedo", false, 1},
+        {ShaderDataType::kFloat, "a_instance_diffuse_index", false, 1},
+    });
+    mesh->vertex_array->AddVertexBuffer(mesh->instance_buffer);
+
+    Ref<IndexBuffer> index_buffer = IndexBuffer::Create(
+        mesh_data.indices.data(), mesh_data.indices.size());
+    mesh->vertex_array->SetIndexBuffer(index_buffer);
+
+    mesh->index_count = mesh_data.indices.size();
+    mesh->diffuse_map = mesh_data.diffuse_map;
+    mesh->diffuse_index = FindTexture(mesh->diffuse_map);
+
+    model_buffers.meshes.push_back(std::move(mesh));
+  }
+
+  return model_buffers;
+}
+
+}  // namespace eve
@@ -0,0 +1,75 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "core/buffer.h"
+#include "graphics/material.h"
+#include "graphics/shader.h"
+#include "graphics/texture_residency.h"
+#include "graphics/vertex_array.h"
+#include "scene/model.h"
+
+namespace eve {
+
+struct RenderStats;
+
+static constexpr size_t kMeshMaxInstances = 1000;
+
+struct MeshInstance final {
+  glm::mat4 transform;
+  Color albedo;
+  float diffuse_index = 0.0f;
+};
+
+/**
+ * @brief Renders models whose vertices are uploaded once into static
+ * buffers, only per instance records are streamed each frame.
+ */
+class InstancedMeshPrimitive {
+ public:
+  InstancedMeshPrimitive(Ref<TextureResidency> texture_residency);
+  ~InstancedMeshPrimitive() = default;
+
+  void Render(RenderStats& stats);
+
+  void Reset();
+
+  void AddInstance(const Ref<Model>& model, const glm::mat4& transform,
+                   const Material& material);
+
+  [[nodiscard]] bool NeedsNewBatch(const Ref<Model>& model);
+
+  [[nodiscard]] float FindTexture(const Ref<Texture>& texture);
+
+ private:
+  struct MeshBuffers final {
+    Ref<VertexArray> vertex_array;
+    Ref<VertexBuffer> instance_buffer;
+    uint32_t index_count;
+
+    Ref<Texture> diffuse_map;
+    // stays valid as long as the diffuse map is alive
+    float diffuse_index;
+    BufferArray<MeshInstance> instances;
+  };
+
+  struct ModelBuffers final {
+    // used to detect unloaded or reloaded models sharing the same handle
+    std::weak_ptr<Model> model;
+    std::vector<Scope<MeshBuffers>> meshes;
+  };
+
+  ModelBuffers& GetOrCreateModelBuffers(const Ref<Model>& model);
+
+ private:
+  Ref<Shader> shader_;
+
+  std::unordered_map<AssetHandle, ModelBuffers> models_;
+
+  // Textures
+  Ref<TextureResidency> texture_residency_;
+};
+
+}  // namespace eve
@@ -11,9 +11,8 @@ namespace eve {
 LinePrimitive::LinePrimitive() {
   vertex_array_ = VertexArray::Create();
 
-  vertices_.Allocate(kMaxLineVertexCount);
-
-  vertex_buffer_ = VertexBuffer::Create(vertices_.GetSize());
+  // vertices are written directly into the mapped ring buffer
+  vertex_buffer_ = vertices_.GetVertexBuffer();
   vertex_buffer_->SetLayout({{ShaderDataType::kFloat3, "a_position"},
                              {ShaderDataType::kFloat4, "a_color"}});
   vertex_array_->AddVertexBuffer(vertex_buffer_);
@@ -27,17 +26,22 @@ void LinePrimitive::Render(RenderStats& stats) {
     return;
   }
 
-  vertex_buffer_->SetData(vertices_.GetData(), vertices_.GetSize());
-
   shader_->Bind();
   RenderCommand::SetLineWidth(line_width);
-  RenderCommand::DrawLines(vertex_array_, vertices_.GetCount());
+  RenderCommand::DrawLines(vertex_array_, vertices_.GetCount(),
+                           vertices_.GetBaseIndex());
+
+  vertices_.Submit();
 
   stats.draw_calls++;
 }
 
 void LinePrimitive::Reset() {
-  vertices_.ResetIndex();
+  vertices_.Reset();
+}
+
+void LinePrimitive::EndFrame() {
+  vertices_.EndFrame();
 }
 
 void LinePrimitive::AddInstance(const glm::vec3& p0, const glm::vec3& p1,
@@ -5,6 +5,7 @@
 #include "pch_shared.h"
 
 #include "core/buffer.h"
+#include "graphics/ring_buffer.h"
 #include "graphics/shader.h"
 #include "graphics/vertex_array.h"
 
@@ -33,6 +34,9 @@ class LinePrimitive {
 
   void Reset();
 
+  // moves on to the next frame's segment of the vertex ring buffer
+  void EndFrame();
+
   void AddInstance(const glm::vec3& p0, const glm::vec3& p1,
                    const Color& color);
 
@@ -43,7 +47,7 @@ class LinePrimitive {
   Ref<VertexBuffer> vertex_buffer_;
   Ref<Shader> shader_;
 
-  BufferArray<LineVertex> vertices_;
+  RingBufferArray<LineVertex> vertices_{kMaxLineVertexCount};
 };
 
 }  // namespace eve
\ No newline at end of file
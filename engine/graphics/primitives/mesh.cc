@@ -9,13 +9,12 @@
 
 namespace eve {
 
-MeshPrimitive::MeshPrimitive() {
+MeshPrimitive::MeshPrimitive(Ref<TextureResidency> texture_residency)
+    : texture_residency_(texture_residency) {
   vertex_array_ = VertexArray::Create();
 
-  // initialize vertex buffer
-  vertices_.Allocate(kMeshMaxVertexCount);
-
-  vertex_buffer_ = VertexBuffer::Create(vertices_.GetSize());
+  // vertices are written directly into the mapped ring buffer
+  vertex_buffer_ = vertices_.GetVertexBuffer();
   vertex_buffer_->SetLayout({
       {ShaderDataType::kFloat4, "a_position"},
       {ShaderDataType::kFloat4, "a_albedo"},
@@ -35,30 +34,7 @@ MeshPrimitive::MeshPrimitive() {
   fragment_path_ = "assets/shaders/mesh.frag";
   shader_ = Shader::Create(vertex_path_, fragment_path_);
 
-  // fill the textures with empty values (which is default white texture)
-  {
-    shader_->Bind();
-    int samplers[32];
-    std::iota(std::begin(samplers), std::end(samplers), 0);
-    shader_->SetUniform("u_textures", 32, samplers);
-  }
-
-  // Create default 1x1 white texture
-  TextureMetadata metadata;
-  metadata.size = {1, 1};
-  metadata.format = TextureFormat::kRGBA;
-  metadata.min_filter = TextureFilteringMode::kLinear;
-  metadata.mag_filter = TextureFilteringMode::kLinear;
-  metadata.wrap_s = TextureWrappingMode::kClampToEdge;
-  metadata.wrap_t = TextureWrappingMode::kClampToEdge;
-  metadata.generate_mipmaps = false;
-
-  uint32_t color = 0xffffff;
-  white_texture_ = Texture::Create(metadata, &color);
-
-  // Fill texture slots with default white texture
-  std::fill(std::begin(texture_slots_), std::end(texture_slots_),
-            white_texture_);
+  TextureResidency::SetSamplers(*shader_);
 }
 
 MeshPrimitive::~MeshPrimitive() {}
@@ -68,13 +44,12 @@ void MeshPrimitive::Render(RenderStats& stats) {
     return;
   }
 
-  index_buffer_->SetData(indices_.GetData(), indices_.GetSize());
-  vertex_buffer_->SetData(vertices_.GetData(), vertices_.GetSize());
+  // only upload the used part of the indices
+  index_buffer_->SetData(indices_.GetData(),
+                         indices_.GetCount() * sizeof(uint32_t));
 
-  // Bind textures
-  for (uint32_t i = 0; i <= texture_slot_index_; i++) {
-    texture_slots_[i]->Bind(i);
-  }
+  texture_residency_->Bind();
+  texture_slots_.Bind();
 
   shader_->Bind();
   if (custom_shader_) {
@@ -83,16 +58,24 @@ void MeshPrimitive::Render(RenderStats& stats) {
     }
   }
 
-  RenderCommand::DrawIndexed(vertex_array_, indices_.GetCount());
+  RenderCommand::DrawIndexed(vertex_array_, indices_.GetCount(),
+                             vertices_.GetBaseIndex());
+
+  vertices_.Submit();
 
   stats.draw_calls++;
 }
 
 void MeshPrimitive::Reset() {
-  vertices_.ResetIndex();
+  vertices_.Reset();
   indices_.ResetIndex();
   index_offset_ = 0;
-  texture_slot_index_ = 1;
+
+  texture_slots_.Reset();
+}
+
+void MeshPrimitive::EndFrame() {
+  vertices_.EndFrame();
 }
 
 void MeshPrimitive::AddInstance(const MeshData& mesh,
@@ -118,8 +101,7 @@ void MeshPrimitive::AddInstance(const MeshData& mesh,
 bool MeshPrimitive::NeedsNewBatch(uint32_t vertex_size, uint32_t index_size) {
   return vertices_.GetCount() + vertex_size >= kMeshMaxVertexCount ||
          indices_.GetCount() + index_size >= kMeshMaxIndexCount ||
-         texture_slot_index_ + 1 >=
-             kMeshMaxTextures;  // could have diffuse, specular, normal and height maps
+         texture_slots_.IsFull();
 }
 
 void MeshPrimitive::SetCustomShader(Ref<ShaderInstance> custom_shader) {
@@ -138,6 +120,7 @@ void MeshPrimitive::RecompileShaders() {
   }
 
   shader_->Recompile(vertex_path_, fragment_path_, custom_shader_source);
+  TextureResidency::SetSamplers(*shader_);
 
   auto uniforms = custom_shader_->uniforms;
   custom_shader_->uniforms.clear();
@@ -157,24 +140,14 @@ void MeshPrimitive::RecompileShaders() {
 }
 
 float MeshPrimitive::FindTexture(const Ref<Texture>& texture) {
-  float texture_index = 0.0f;
-
-  if (!texture) {
-    return texture_index;
-  }
-
-  for (uint32_t i = 1; i < texture_slot_index_; i++) {
-    if (texture_slots_[i] == texture) {
-      texture_index = (float)i;
-    }
-  }
-
-  if (texture_index == 0.0f) {
-    texture_index = (float)texture_slot_index_;
-    texture_slots_[texture_slot_index_++] = texture;
+  std::optional<TextureIndex> index = texture_residency_->GetIndex(texture);
+  if (!index) {
+    // batches are flushed before the slots are full
+    index = texture_slots_.Find(texture);
+    EVE_ASSERT_ENGINE(index);
   }
 
-  return texture_index;
+  return (float)*index;
 }
 
 }  // namespace eve
@@ -5,8 +5,11 @@
 #include "pch_shared.h"
 
 #include "core/buffer.h"
+#include "core/math/aabb.h"
 #include "graphics/material.h"
+#include "graphics/ring_buffer.h"
 #include "graphics/shader.h"
+#include "graphics/texture_residency.h"
 #include "graphics/vertex_array.h"
 
 namespace eve {
@@ -15,7 +18,6 @@ struct RenderStats;
 
 static constexpr size_t kMeshMaxVertexCount = 10000;
 static constexpr size_t kMeshMaxIndexCount = 10000;
-static constexpr size_t kMeshMaxTextures = 32;
 
 struct MeshVertex final {
   glm::vec4 position;
@@ -25,22 +27,34 @@ struct MeshVertex final {
   float diffuse_index = 0.0f;
 };
 
+/**
+ * @brief Views into vertex and index memory owned by the model, either
+ * imported data or a mapped cooked model file.
+ */
 struct MeshData {
-  std::vector<MeshVertex> vertices;
-  std::vector<uint32_t> indices;
+  std::span<const MeshVertex> vertices;
+  std::span<const uint32_t> indices;
 
+  // local space bounds of the vertices
+  AABB bounds;
+
+  // loaders only fill the path, the texture is created on the main thread
+  std::string diffuse_path;
   Ref<Texture> diffuse_map = nullptr;
 };
 
 class MeshPrimitive {
  public:
-  MeshPrimitive();
+  MeshPrimitive(Ref<TextureResidency> texture_residency);
   ~MeshPrimitive();
 
   void Render(RenderStats& stats);
 
   void Reset();
 
+  // moves on to the next frame's segment of the vertex ring buffer
+  void EndFrame();
+
   void AddInstance(const MeshData& mesh, const glm::mat4& transform,
                    const Material& material);
 
@@ -59,7 +73,7 @@ class MeshPrimitive {
   Ref<Shader> shader_;
 
   // Render data
-  BufferArray<MeshVertex> vertices_;
+  RingBufferArray<MeshVertex> vertices_{kMeshMaxVertexCount};
   BufferArray<uint32_t> indices_;
   uint32_t index_offset_ = 0;
 
@@ -69,9 +83,8 @@ class MeshPrimitive {
   Ref<ShaderInstance> custom_shader_ = nullptr;
 
   // Textures
-  Ref<Texture> white_texture_;
-  std::array<Ref<Texture>, kMeshMaxTextures> texture_slots_;
-  uint32_t texture_slot_index_ = 0;
+  Ref<TextureResidency> texture_residency_;
+  TextureSlots texture_slots_;
 };
 
 }  // namespace eve
\ No newline at end of file
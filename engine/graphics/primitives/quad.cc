@@ -10,13 +10,12 @@
 
 namespace eve {
 
-QuadPrimitive::QuadPrimitive() {
+QuadPrimitive::QuadPrimitive(Ref<TextureResidency> texture_residency)
+    : texture_residency_(texture_residency) {
   vertex_array_ = VertexArray::Create();
 
-  // initialize vertex buffer
-  vertices_.Allocate(kQuadMaxVertexCount);
-
-  vertex_buffer_ = VertexBuffer::Create(vertices_.GetSize());
+  // vertices are written directly into the mapped ring buffer
+  vertex_buffer_ = vertices_.GetVertexBuffer();
   vertex_buffer_->SetLayout({
       {ShaderDataType::kFloat4, "a_position"},
       {ShaderDataType::kFloat2, "a_tex_coords"},
@@ -51,30 +50,7 @@ QuadPrimitive::QuadPrimitive() {
   shader_ = Shader::Create("assets/shaders/sprite.vert",
                            "assets/shaders/sprite.frag");
 
-  // fill the textures with empty values (which is default white texture)
-  {
-    shader_->Bind();
-    int samplers[32];
-    std::iota(std::begin(samplers), std::end(samplers), 0);
-    shader_->SetUniform("u_textures", 32, samplers);
-  }
-
-  // Create default 1x1 white texture
-  TextureMetadata metadata;
-  metadata.size = {1, 1};
-  metadata.format = TextureFormat::kRGBA;
-  metadata.min_filter = TextureFilteringMode::kLinear;
-  metadata.mag_filter = TextureFilteringMode::kLinear;
-  metadata.wrap_s = TextureWrappingMode::kClampToEdge;
-  metadata.wrap_t = TextureWrappingMode::kClampToEdge;
-  metadata.generate_mipmaps = false;
-
-  uint32_t color = 0xffffffff;
-  white_texture_ = Texture::Create(metadata, &color);
-
-  // Fill texture slots with default white texture
-  std::fill(std::begin(texture_slots_), std::end(texture_slots_),
-            white_texture_);
+  TextureResidency::SetSamplers(*shader_);
 }
 
 QuadPrimitive::~QuadPrimitive() {}
@@ -84,35 +60,40 @@ void QuadPrimitive::Render(RenderStats& stats) {
     return;
   }
 
-  vertex_buffer_->SetData(vertices_.GetData(), vertices_.GetSize());
-
-  // Bind textures
-  for (uint32_t i = 0; i <= texture_slot_index_; i++) {
-    texture_slots_[i]->Bind(i);
-  }
+  texture_residency_->Bind();
+  texture_slots_.Bind();
 
   shader_->Bind();
-  RenderCommand::DrawIndexed(vertex_array_, index_count_);
+  RenderCommand::DrawIndexed(vertex_array_, index_count_,
+                             vertices_.GetBaseIndex());
+
+  vertices_.Submit();
 
   stats.draw_calls++;
 }
 
 void QuadPrimitive::Reset() {
-  vertices_.ResetIndex();
+  vertices_.Reset();
   index_count_ = 0;
-  texture_slot_index_ = 1;
+
+  texture_slots_.Reset();
+  last_texture_ = nullptr;
+  last_texture_index_ = (float)texture_residency_->GetWhiteIndex();
+}
+
+void QuadPrimitive::EndFrame() {
+  vertices_.EndFrame();
 }
 
-void QuadPrimitive::AddInstance(const Transform& transform, const Color& color,
+void QuadPrimitive::AddInstance(const glm::mat4& transform, const Color& color,
                                 const Ref<Texture>& texture,
                                 const glm::vec2& tiling) {
-  const float tex_index = texture ? FindTexture(texture) : 0.0f;
-  const glm::mat4 transform_matrix = transform.GetTransformMatrix();
+  const float tex_index = FindTexture(texture);
 
   for (size_t i = 0; i < kQuadVertexCount; i++) {
     QuadVertex vertex;
 
-    vertex.position = transform_matrix * kQuadVertexPositions[i];
+    vertex.position = transform * kQuadVertexPositions[i];
     vertex.tex_coords = kQuadVertexTexCoords[i];
     vertex.color = color;
     vertex.tex_index = tex_index;
@@ -126,22 +107,26 @@ void QuadPrimitive::AddInstance(const Transform& transform, const Color& color,
 
 bool QuadPrimitive::NeedsNewBatch() {
   return vertices_.GetCount() + kQuadVertexCount >= kQuadMaxVertexCount ||
-         texture_slot_index_ >= kQuadMaxTextures;
+         texture_slots_.IsFull();
 }
 
 float QuadPrimitive::FindTexture(const Ref<Texture>& texture) {
-  float texture_index = 0.0f;
-  for (uint32_t i = 1; i < texture_slot_index_; i++) {
-    if (texture_slots_[i] == texture) {
-      texture_index = (float)i;
-    }
+  if (texture == last_texture_) {
+    return last_texture_index_;
   }
 
-  if (texture_index == 0.0f) {
-    texture_index = (float)texture_slot_index_;
-    texture_slots_[texture_slot_index_++] = texture;
+  std::optional<TextureIndex> index = texture_residency_->GetIndex(texture);
+  if (!index) {
+    // batches are flushed before the slots are full
+    index = texture_slots_.Find(texture);
+    EVE_ASSERT_ENGINE(index);
   }
 
+  const float texture_index = (float)*index;
+
+  last_texture_ = texture;
+  last_texture_index_ = texture_index;
+
   return texture_index;
 }
 
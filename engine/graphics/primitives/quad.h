@@ -6,7 +6,9 @@
 
 #include "core/buffer.h"
 #include "graphics/material.h"
+#include "graphics/ring_buffer.h"
 #include "graphics/shader.h"
+#include "graphics/texture_residency.h"
 #include "graphics/vertex_array.h"
 #include "scene/transform.h"
 
@@ -19,7 +21,6 @@ constexpr size_t kQuadMaxInstances = 1000;
 
 constexpr size_t kQuadMaxVertexCount = kQuadMaxInstances * kQuadVertexCount;
 constexpr size_t kQuadMaxIndexCount = kQuadMaxInstances * kQuadIndexCount;
-constexpr size_t kQuadMaxTextures = 32;
 
 struct RenderStats;
 
@@ -33,14 +34,17 @@ struct QuadVertex final {
 
 class QuadPrimitive {
  public:
-  QuadPrimitive();
+  QuadPrimitive(Ref<TextureResidency> texture_residency);
   ~QuadPrimitive();
 
   void Render(RenderStats& stats);
 
   void Reset();
 
-  void AddInstance(const Transform& transform, const Color& color = kColorWhite,
+  // moves on to the next frame's segment of the vertex ring buffer
+  void EndFrame();
+
+  void AddInstance(const glm::mat4& transform, const Color& color = kColorWhite,
                    const Ref<Texture>& texture = nullptr,
                    const glm::vec2& tiling = {1, 1});
 
@@ -53,13 +57,16 @@ class QuadPrimitive {
   Ref<VertexBuffer> vertex_buffer_;
   Ref<Shader> shader_;
 
-  BufferArray<QuadVertex> vertices_;
+  RingBufferArray<QuadVertex> vertices_{kQuadMaxVertexCount};
   uint32_t index_count_ = 0;
 
   // Textures
-  Ref<Texture> white_texture_;
-  std::array<Ref<Texture>, kQuadMaxTextures> texture_slots_;
-  uint32_t texture_slot_index_ = 0;
+  Ref<TextureResidency> texture_residency_;
+  TextureSlots texture_slots_;
+
+  // sorted draws usually repeat the same texture
+  Ref<Texture> last_texture_;
+  float last_texture_index_ = 0.0f;
 };
 
 const glm::vec4 kQuadVertexPositions[kQuadVertexCount] = {
@@ -30,13 +30,13 @@ void RenderCommand::DrawArrays(const Ref<VertexArray>& vertex_array,
 }
 
 void RenderCommand::DrawIndexed(const Ref<VertexArray>& vertex_array,
-                                uint32_t index_count) {
-  renderer_api_->DrawIndexed(vertex_array, index_count);
+                                uint32_t index_count, uint32_t base_vertex) {
+  renderer_api_->DrawIndexed(vertex_array, index_count, base_vertex);
 }
 
 void RenderCommand::DrawLines(const Ref<VertexArray>& vertex_array,
-                              uint32_t vertex_count) {
-  renderer_api_->DrawLines(vertex_array, vertex_count);
+                              uint32_t vertex_count, uint32_t first_vertex) {
+  renderer_api_->DrawLines(vertex_array, vertex_count, first_vertex);
 }
 
 void RenderCommand::DrawArraysInstanced(const Ref<VertexArray>& vertex_array,
@@ -46,6 +46,13 @@ void RenderCommand::DrawArraysInstanced(const Ref<VertexArray>& vertex_array,
                                      instance_count);
 }
 
+void RenderCommand::DrawIndexedInstanced(const Ref<VertexArray>& vertex_array,
+                                         uint32_t index_count,
+                                         uint32_t instance_count) {
+  renderer_api_->DrawIndexedInstanced(vertex_array, index_count,
+                                      instance_count);
+}
+
 void RenderCommand::SetLineWidth(float width) {
   renderer_api_->SetLineWidth(width);
 }
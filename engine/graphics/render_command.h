@@ -17,15 +17,19 @@ class RenderCommand final {
   static void DrawArrays(const Ref<VertexArray>& vertex_array,
                          uint32_t vertex_count);
   static void DrawIndexed(const Ref<VertexArray>& vertex_array,
-                          uint32_t index_count);
+                          uint32_t index_count, uint32_t base_vertex = 0);
 
   static void DrawLines(const Ref<VertexArray>& vertex_array,
-                        uint32_t vertex_count);
+                        uint32_t vertex_count, uint32_t first_vertex = 0);
 
   static void DrawArraysInstanced(const Ref<VertexArray>& vertex_array,
                                   uint32_t vertex_count,
                                   uint32_t instance_count);
 
+  static void DrawIndexedInstanced(const Ref<VertexArray>& vertex_array,
+                                   uint32_t index_count,
+                                   uint32_t instance_count);
+
   static void SetLineWidth(float width);
 
   static void SetPolygonMode(PolygonMode mode = PolygonMode::kFill);
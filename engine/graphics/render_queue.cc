@@ -0,0 +1,89 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/render_queue.h"
+
+namespace eve {
+
+// top 24 bits of a positive float keep its ordering
+static uint64_t QuantizeDepth(float depth) {
+  const float clamped = std::max(depth, 0.0f);
+
+  uint32_t bits;
+  std::memcpy(&bits, &clamped, sizeof(uint32_t));
+
+  return bits >> 8;
+}
+
+uint64_t RenderQueue::CreateKey(uint16_t shader, uint16_t texture, float depth,
+                                bool translucent) {
+  constexpr uint64_t kDepthMask = (1ull << 24) - 1;
+
+  const uint64_t depth_bits = QuantizeDepth(depth);
+
+  if (!translucent) {
+    return (uint64_t(shader) << 47) | (uint64_t(texture) << 31) |
+           (depth_bits << 7);
+  }
+
+  // farther ones should be drawn first
+  const uint64_t inverted_depth = kDepthMask - depth_bits;
+
+  return (1ull << 63) | (inverted_depth << 39) | (uint64_t(shader) << 23) |
+         (uint64_t(texture) << 7);
+}
+
+void RenderQueue::Push(uint64_t key, RenderQueueItemType type,
+                       uint32_t index) {
+  items_.push_back({key, index, type});
+}
+
+void RenderQueue::Sort() {
+  constexpr uint32_t kRadixBits = 8;
+  constexpr uint32_t kBucketCount = 1 << kRadixBits;
+  constexpr uint32_t kPassCount = 64 / kRadixBits;
+
+  const size_t item_count = items_.size();
+  if (item_count <= 1) {
+    return;
+  }
+
+  sort_buffer_.resize(item_count);
+
+  // count digits of every pass at once
+  std::array<std::array<uint32_t, kBucketCount>, kPassCount> histograms{};
+  for (const RenderQueueItem& item : items_) {
+    for (uint32_t pass = 0; pass < kPassCount; pass++) {
+      histograms[pass][(item.key >> (pass * kRadixBits)) & 0xFF]++;
+    }
+  }
+
+  for (uint32_t pass = 0; pass < kPassCount; pass++) {
+    auto& histogram = histograms[pass];
+
+    const uint32_t shift = pass * kRadixBits;
+
+    // every item has the same digit, nothing to reorder
+    if (histogram[(items_[0].key >> shift) & 0xFF] == item_count) {
+      continue;
+    }
+
+    uint32_t offset = 0;
+    for (uint32_t& count : histogram) {
+      const uint32_t bucket_count = count;
+      count = offset;
+      offset += bucket_count;
+    }
+
+    for (const RenderQueueItem& item : items_) {
+      sort_buffer_[histogram[(item.key >> shift) & 0xFF]++] = item;
+    }
+
+    items_.swap(sort_buffer_);
+  }
+}
+
+void RenderQueue::Clear() {
+  items_.clear();
+}
+
+}  // namespace eve
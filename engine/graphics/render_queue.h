@@ -0,0 +1,57 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+namespace eve {
+
+enum class RenderQueueItemType : uint8_t { kModel, kQuad };
+
+struct RenderQueueItem {
+  uint64_t key;
+  uint32_t index;
+  RenderQueueItemType type;
+};
+
+/**
+ * @brief Holds draw submissions of a frame and orders them by their sort keys
+ * so that draws sharing state end up next to each other.
+ *
+ * Key layout from the most significant bit:
+ *   opaque:      0 | shader (16) | texture (16) | depth (24, front to back)
+ *   translucent: 1 | depth (24, back to front) | shader (16) | texture (16)
+ */
+class RenderQueue {
+ public:
+  RenderQueue() = default;
+
+  [[nodiscard]] static uint64_t CreateKey(uint16_t shader, uint16_t texture,
+                                          float depth, bool translucent);
+
+  [[nodiscard]] static bool IsTranslucent(uint64_t key) {
+    return (key >> 63) != 0;
+  }
+
+  void Push(uint64_t key, RenderQueueItemType type, uint32_t index);
+
+  /**
+   * @brief Stable radix sort by keys, items having the same key keep their
+   * submission order.
+   */
+  void Sort();
+
+  void Clear();
+
+  [[nodiscard]] const std::vector<RenderQueueItem>& GetItems() const {
+    return items_;
+  }
+
+  [[nodiscard]] size_t GetSize() const { return items_.size(); }
+
+ private:
+  std::vector<RenderQueueItem> items_;
+  std::vector<RenderQueueItem> sort_buffer_;
+};
+
+}  // namespace eve
@@ -13,9 +13,12 @@ Renderer::Renderer() {
 
   RenderCommand::Init();
 
+  texture_residency_ = CreateRef<TextureResidency>();
+
   // Create render datas
-  mesh_data_ = CreateRef<MeshPrimitive>();
-  quad_data_ = CreateRef<QuadPrimitive>();
+  mesh_data_ = CreateRef<MeshPrimitive>(texture_residency_);
+  instanced_mesh_data_ = CreateRef<InstancedMeshPrimitive>(texture_residency_);
+  quad_data_ = CreateRef<QuadPrimitive>(texture_residency_);
   cube_data_ = CreateRef<CubePrimitive>();
   line_data_ = CreateRef<LinePrimitive>();
 
@@ -29,12 +32,25 @@ Renderer::~Renderer() {}
 
 void Renderer::BeginScene(const CameraData& camera_data) {
   camera_uniform_buffer_->SetData(&camera_data, sizeof(CameraData));
+  camera_position_ = camera_data.position;
 
   BeginBatch();
 }
 
 void Renderer::EndScene() {
+  SubmitRenderQueue();
   Flush();
+
+  // flushes of a frame share a segment, so only fence once per frame
+  mesh_data_->EndFrame();
+  for (auto& [id, mesh] : custom_meshes_) {
+    mesh->EndFrame();
+  }
+
+  quad_data_->EndFrame();
+  cube_data_->EndFrame();
+  line_data_->EndFrame();
+  wireframe_cube_data_->EndFrame();
 }
 
 void Renderer::DrawModel(const Ref<Model>& model, const Transform& transform,
@@ -43,35 +59,54 @@ void Renderer::DrawModel(const Ref<Model>& model, const Transform& transform,
     return;
   }
 
-  Ref<MeshPrimitive> mesh_data =
-      (material.shader == 0 || !AssetRegistry::Exists(material.shader))
-          ? mesh_data_
-          : AddMeshPrimitiveIfNotExists(material.shader);
-
-  const glm::mat4 transform_matrix = transform.GetTransformMatrix();
-
-  for (MeshData mesh : model->meshes) {
-    if (!mesh_data->NeedsNewBatch(mesh.vertices.size(), mesh.indices.size())) {
-      NextBatch();
-    }
-
-    mesh_data->AddInstance(mesh, transform_matrix, material);
+  DrawModel(model, transform.GetTransformMatrix(), material);
+}
 
-    stats_.index_count += mesh.indices.size();
-    stats_.vertex_count += mesh.vertices.size();
+void Renderer::DrawModel(const Ref<Model>& model,
+                         const glm::mat4& transform_matrix,
+                         const Material& material) {
+  if (!model) {
+    return;
   }
+
+  // default mesh shader comes first, custom shaders are grouped by handle
+  const bool is_default_shader =
+      material.shader == 0 || !AssetRegistry::Exists(material.shader);
+  const uint16_t shader_key =
+      is_default_shader
+          ? 1
+          : static_cast<uint16_t>(2 + material.shader % (UINT16_MAX - 2));
+
+  // instances of the same model share their textures
+  const uint16_t texture_key =
+      static_cast<uint16_t>(model->handle % UINT16_MAX);
+
+  const uint64_t key = RenderQueue::CreateKey(
+      shader_key, texture_key, GetCameraDistance(transform_matrix),
+      material.albedo.a < 1.0f);
+
+  render_queue_.Push(key, RenderQueueItemType::kModel,
+                     static_cast<uint32_t>(model_draws_.size()));
+  model_draws_.push_back({model, transform_matrix, material});
 }
 
 void Renderer::DrawQuad(const Transform& transform, const Color& color,
                         const Ref<Texture>& texture, const glm::vec2& tiling) {
-  if (quad_data_->NeedsNewBatch()) {
-    NextBatch();
-  }
+  DrawQuad(transform.GetTransformMatrix(), color, texture, tiling);
+}
 
-  quad_data_->AddInstance(transform, color, texture, tiling);
+void Renderer::DrawQuad(const glm::mat4& transform, const Color& color,
+                        const Ref<Texture>& texture, const glm::vec2& tiling) {
+  const uint16_t texture_key =
+      texture ? static_cast<uint16_t>(texture->GetTextureID() % UINT16_MAX)
+              : 0;
 
-  stats_.index_count += kQuadIndexCount;
-  stats_.vertex_count += kQuadVertexCount;
+  const uint64_t key = RenderQueue::CreateKey(
+      0, texture_key, GetCameraDistance(transform), color.a < 1.0f);
+
+  render_queue_.Push(key, RenderQueueItemType::kQuad,
+                     static_cast<uint32_t>(quad_draws_.size()));
+  quad_draws_.push_back({transform, color, texture, tiling});
 }
 
 void Renderer::DrawCube(const Transform& transform, const Color& color,
@@ -132,6 +167,7 @@ void Renderer::RecompileShaders() const {
 void Renderer::BeginBatch() {
   // Reset mesh data
   mesh_data_->Reset();
+  instanced_mesh_data_->Reset();
 
   for (auto& [id, mesh] : custom_meshes_) {
     mesh->Reset();
@@ -146,6 +182,7 @@ void Renderer::BeginBatch() {
 
 void Renderer::Flush() {
   mesh_data_->Render(stats_);
+  instanced_mesh_data_->Render(stats_);
 
   // Render custom meshes
   for (auto& [id, mesh] : custom_meshes_) {
@@ -168,6 +205,108 @@ void Renderer::NextBatch() {
   BeginBatch();
 }
 
+void Renderer::SubmitRenderQueue() {
+  render_queue_.Sort();
+
+  // primitives are flushed in a fixed order, so translucent draws which are
+  // blended back to front flush the batch whenever their primitive changes
+  constexpr uint64_t kNoPrimitive = UINT64_MAX;
+  constexpr uint64_t kQuadPrimitive = UINT64_MAX - 1;
+  uint64_t translucent_primitive = kNoPrimitive;
+
+  for (const RenderQueueItem& item : render_queue_.GetItems()) {
+    const bool is_translucent = RenderQueue::IsTranslucent(item.key);
+
+    if (is_translucent) {
+      const uint64_t primitive =
+          item.type == RenderQueueItemType::kQuad
+              ? kQuadPrimitive
+              : GetMeshPrimitiveHandle(model_draws_[item.index].material);
+
+      if (primitive != translucent_primitive) {
+        NextBatch();
+        translucent_primitive = primitive;
+      }
+    }
+
+    switch (item.type) {
+      case RenderQueueItemType::kModel: {
+        const ModelDrawData& draw = model_draws_[item.index];
+        // instances are regrouped per mesh, which breaks the sorted order
+        AddModel(draw.model, draw.transform, draw.material, !is_translucent);
+        break;
+      }
+      case RenderQueueItemType::kQuad: {
+        const QuadDrawData& draw = quad_draws_[item.index];
+        AddQuad(draw.transform, draw.color, draw.texture, draw.tiling);
+        break;
+      }
+    }
+  }
+
+  render_queue_.Clear();
+  model_draws_.clear();
+  quad_draws_.clear();
+}
+
+void Renderer::AddModel(const Ref<Model>& model, const glm::mat4& transform,
+                        const Material& material, bool instanced) {
+  const AssetHandle shader = GetMeshPrimitiveHandle(material);
+
+  // models without custom shaders are drawn instanced from static buffers
+  if (shader == 0 && instanced) {
+    if (instanced_mesh_data_->NeedsNewBatch(model)) {
+      NextBatch();
+    }
+
+    instanced_mesh_data_->AddInstance(model, transform, material);
+
+    for (const MeshData& mesh : model->meshes) {
+      stats_.index_count += mesh.indices.size();
+      stats_.vertex_count += mesh.vertices.size();
+    }
+
+    return;
+  }
+
+  // custom shaders are generated from mesh shader so they are still batched
+  Ref<MeshPrimitive> mesh_data =
+      shader == 0 ? mesh_data_ : AddMeshPrimitiveIfNotExists(shader);
+
+  for (const MeshData& mesh : model->meshes) {
+    if (mesh_data->NeedsNewBatch(mesh.vertices.size(), mesh.indices.size())) {
+      NextBatch();
+    }
+
+    mesh_data->AddInstance(mesh, transform, material);
+
+    stats_.index_count += mesh.indices.size();
+    stats_.vertex_count += mesh.vertices.size();
+  }
+}
+
+void Renderer::AddQuad(const glm::mat4& transform, const Color& color,
+                       const Ref<Texture>& texture, const glm::vec2& tiling) {
+  if (quad_data_->NeedsNewBatch()) {
+    NextBatch();
+  }
+
+  quad_data_->AddInstance(transform, color, texture, tiling);
+
+  stats_.index_count += kQuadIndexCount;
+  stats_.vertex_count += kQuadVertexCount;
+}
+
+AssetHandle Renderer::GetMeshPrimitiveHandle(const Material& material) const {
+  return material.shader == 0 || !AssetRegistry::Exists(material.shader)
+             ? 0
+             : material.shader;
+}
+
+float Renderer::GetCameraDistance(const glm::mat4& transform) const {
+  return glm::distance(glm::vec3(transform[3]), camera_position_);
+}
+
 Ref<MeshPrimitive> Renderer::AddMeshPrimitiveIfNotExists(
     AssetHandle shader_handle) {
   const auto it = std::find_if(custom_meshes_.begin(), custom_meshes_.end(),
@@ -179,7 +318,7 @@ Ref<MeshPrimitive> Renderer::AddMeshPrimitiveIfNotExists(
       AssetRegistry::Get<ShaderInstance>(shader_handle);
 
   if (it == custom_meshes_.end()) {
-    Ref<MeshPrimitive> mesh = CreateRef<MeshPrimitive>();
+    Ref<MeshPrimitive> mesh = CreateRef<MeshPrimitive>(texture_residency_);
     mesh->SetCustomShader(shader_instance);
     mesh->RecompileShaders();
     custom_meshes_[shader_handle] = mesh;
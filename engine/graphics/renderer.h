@@ -7,11 +7,14 @@
 #include "core/math/box.h"
 #include "graphics/graphics_context.h"
 #include "graphics/primitives/cube.h"
+#include "graphics/primitives/instanced_mesh.h"
 #include "graphics/primitives/line.h"
 #include "graphics/primitives/mesh.h"
 #include "graphics/primitives/quad.h"
 #include "graphics/render_command.h"
+#include "graphics/render_queue.h"
 #include "graphics/texture.h"
+#include "graphics/texture_residency.h"
 #include "graphics/uniform_buffer.h"
 #include "scene/model.h"
 #include "scene/transform.h"
@@ -28,6 +31,8 @@ struct RenderStats final {
   uint32_t draw_calls = 0;
   uint32_t vertex_count = 0;
   uint32_t index_count = 0;
+  uint32_t culled_models = 0;
+  uint32_t culled_quads = 0;
 };
 
 class Renderer final {
@@ -42,10 +47,17 @@ class Renderer final {
   void DrawModel(const Ref<Model>& model, const Transform& transform,
                  const Material& material = {});
 
+  void DrawModel(const Ref<Model>& model, const glm::mat4& transform,
+                 const Material& material = {});
+
   void DrawQuad(const Transform& transform, const Color& color = kColorWhite,
                 const Ref<Texture>& texture = nullptr,
                 const glm::vec2& tiling = {1, 1});
 
+  void DrawQuad(const glm::mat4& transform, const Color& color = kColorWhite,
+                const Ref<Texture>& texture = nullptr,
+                const glm::vec2& tiling = {1, 1});
+
   void DrawCube(const Transform& transform, const Color& color,
                 PolygonMode mode = PolygonMode::kFill);
 
@@ -78,11 +90,30 @@ class Renderer final {
 
   Ref<MeshPrimitive> AddMeshPrimitiveIfNotExists(AssetHandle shader);
 
+  // Sorts the queued draws and adds them to the primitives
+  void SubmitRenderQueue();
+
+  void AddModel(const Ref<Model>& model, const glm::mat4& transform,
+                const Material& material, bool instanced = true);
+
+  void AddQuad(const glm::mat4& transform, const Color& color,
+               const Ref<Texture>& texture, const glm::vec2& tiling);
+
+  // shader handle of the mesh primitive drawing @p material, 0 is default
+  [[nodiscard]] AssetHandle GetMeshPrimitiveHandle(
+      const Material& material) const;
+
+  [[nodiscard]] float GetCameraDistance(const glm::mat4& transform) const;
+
  private:
   Ref<GraphicsContext> graphics_context_;
 
+  // Textures shared by every primitive
+  Ref<TextureResidency> texture_residency_;
+
   // Renderer datas
   Ref<MeshPrimitive> mesh_data_;
+  Ref<InstancedMeshPrimitive> instanced_mesh_data_;
   Ref<QuadPrimitive> quad_data_;
   Ref<CubePrimitive> cube_data_;
   Ref<LinePrimitive> line_data_;
@@ -93,8 +124,27 @@ class Renderer final {
   // Other rendering data
   std::unordered_map<AssetHandle, Ref<MeshPrimitive>> custom_meshes_;
 
+  // Queued draws of the frame
+  struct ModelDrawData {
+    Ref<Model> model;
+    glm::mat4 transform;
+    Material material;
+  };
+
+  struct QuadDrawData {
+    glm::mat4 transform;
+    Color color;
+    Ref<Texture> texture;
+    glm::vec2 tiling;
+  };
+
+  RenderQueue render_queue_;
+  std::vector<ModelDrawData> model_draws_;
+  std::vector<QuadDrawData> quad_draws_;
+
   // Camera stuff
   Ref<UniformBuffer> camera_uniform_buffer_;
+  glm::vec3 camera_position_;
 
   // Misc
   RenderStats stats_;
@@ -3,6 +3,7 @@
 #include "graphics/renderer_api.h"
 
 #include "graphics/graphics.h"
+#include "graphics/platforms/null/null_renderer_api.h"
 #include "graphics/platforms/opengl/opengl_renderer_api.h"
 
 namespace eve {
@@ -10,6 +11,8 @@ Scope<RendererAPI> RendererAPI::Create() {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateScope<OpenGLRendererAPI>();
+    case GraphicsAPI::kNull:
+      return CreateScope<NullRendererAPI>();
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -6,7 +6,7 @@
 #include "graphics/vertex_array.h"
 
 namespace eve {
-enum class GraphicsAPI { kNone = 0, kOpenGL, kVulkan };
+enum class GraphicsAPI { kNone = 0, kOpenGL, kVulkan, kNull };
 
 enum BufferBits : uint16_t {
   BufferBits_kDepth = BIT(0),
@@ -30,15 +30,20 @@ class RendererAPI {
   virtual void DrawArrays(const Ref<VertexArray>& vertex_array,
                           uint32_t vertex_count) = 0;
   virtual void DrawIndexed(const Ref<VertexArray>& vertex_array,
-                           uint32_t index_count = 0) = 0;
+                           uint32_t index_count = 0,
+                           uint32_t base_vertex = 0) = 0;
 
   virtual void DrawLines(const Ref<VertexArray>& vertex_array,
-                         uint32_t vertex_count) = 0;
+                         uint32_t vertex_count, uint32_t first_vertex = 0) = 0;
 
   virtual void DrawArraysInstanced(const Ref<VertexArray>& vertex_array,
                                    uint32_t vertex_count,
                                    uint32_t instance_count) = 0;
 
+  virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertex_array,
+                                    uint32_t index_count,
+                                    uint32_t instance_count) = 0;
+
   virtual void SetLineWidth(float width) = 0;
 
   virtual void SetPolygonMode(PolygonMode mode = PolygonMode::kFill) = 0;
@@ -0,0 +1,37 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/ring_buffer.h"
+
+namespace eve {
+
+RingBuffer::RingBuffer(uint32_t segment_size, uint32_t segment_count)
+    : segment_size_(segment_size),
+      segment_count_(segment_count),
+      fences_(segment_count) {
+  EVE_ASSERT_ENGINE(segment_count > 0, "Ring buffer needs a segment.");
+
+  vertex_buffer_ = VertexBuffer::Create(segment_size_ * segment_count_,
+                                        VertexBufferUsage::kPersistentMapped);
+  mapped_data_ = static_cast<uint8_t*>(vertex_buffer_->GetMappedData());
+
+  EVE_ASSERT_ENGINE(mapped_data_, "Unable to map ring buffer.");
+}
+
+uint8_t* RingBuffer::GetSegmentData() {
+  return mapped_data_ + segment_index_ * segment_size_;
+}
+
+void RingBuffer::NextSegment() {
+  fences_[segment_index_] = Fence::Create();
+
+  segment_index_ = (segment_index_ + 1) % segment_count_;
+
+  // segment has never been used or the device has finished with it
+  Ref<Fence>& fence = fences_[segment_index_];
+  if (fence) {
+    fence->Wait();
+    fence.reset();
+  }
+}
+
+}  // namespace eve
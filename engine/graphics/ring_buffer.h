@@ -0,0 +1,141 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "graphics/fence.h"
+#include "graphics/vertex_buffer.h"
+
+namespace eve {
+
+constexpr uint32_t kRingBufferSegmentCount = 3;
+// batches a single segment could hold before a frame has to move on to the
+// next one
+constexpr uint32_t kRingBufferBatchesPerSegment = 4;
+
+/**
+ * @brief Persistently mapped vertex buffer divided into segments, one for
+ * each frame in flight. Every segment is fenced once its frame is drawn so
+ * it is only written again after the device has finished reading it.
+ */
+class RingBuffer {
+ public:
+  RingBuffer(uint32_t segment_size,
+             uint32_t segment_count = kRingBufferSegmentCount);
+
+  /**
+   * @brief Mapped memory of the current segment.
+   */
+  [[nodiscard]] uint8_t* GetSegmentData();
+
+  [[nodiscard]] uint32_t GetSegmentIndex() const { return segment_index_; }
+
+  [[nodiscard]] uint32_t GetSegmentSize() const { return segment_size_; }
+
+  [[nodiscard]] uint32_t GetSegmentCount() const { return segment_count_; }
+
+  /**
+   * @brief Fences the current segment, should be called right after the
+   * last draws reading from it were issued. Then moves to the next segment,
+   * waiting for the device if it is still in use.
+   */
+  void NextSegment();
+
+  [[nodiscard]] const Ref<VertexBuffer>& GetVertexBuffer() const {
+    return vertex_buffer_;
+  }
+
+ private:
+  Ref<VertexBuffer> vertex_buffer_;
+  uint8_t* mapped_data_;
+
+  uint32_t segment_size_;
+  uint32_t segment_count_;
+  uint32_t segment_index_ = 0;
+
+  std::vector<Ref<Fence>> fences_;
+};
+
+/**
+ * @brief Typed batch storage writing directly into a ring buffer, replaces
+ * BufferArray + VertexBuffer::SetData for per frame vertex data. Batches
+ * flushed within a frame are placed one after another in the frame's
+ * segment.
+ */
+template <typename T>
+class RingBufferArray {
+ public:
+  RingBufferArray(uint32_t max_elements,
+                  uint32_t segment_count = kRingBufferSegmentCount)
+      : ring_buffer_(max_elements * kRingBufferBatchesPerSegment * sizeof(T),
+                     segment_count),
+        max_elements_(max_elements),
+        segment_elements_(max_elements * kRingBufferBatchesPerSegment) {}
+
+  void Add(const T& value) {
+    EVE_ASSERT_ENGINE(count_ < max_elements_);
+    T* data = reinterpret_cast<T*>(ring_buffer_.GetSegmentData());
+    data[first_ + count_++] = value;
+  }
+
+  [[nodiscard]] uint32_t GetCount() const { return count_; }
+
+  /**
+   * @brief Index of the first element of current batch in the whole buffer,
+   * to be used as base vertex of the draws.
+   */
+  [[nodiscard]] uint32_t GetBaseIndex() const {
+    return ring_buffer_.GetSegmentIndex() * segment_elements_ + first_;
+  }
+
+  /**
+   * @brief Discards the elements, segment is kept since it was not drawn.
+   */
+  void Reset() { count_ = 0; }
+
+  /**
+   * @brief Should be called after the current elements are drawn, following
+   * elements are written after them in the same segment.
+   */
+  void Submit() {
+    first_ += count_;
+    count_ = 0;
+
+    // too many flushes in a single frame, continue from the next segment
+    if (segment_elements_ - first_ < max_elements_) {
+      ring_buffer_.NextSegment();
+      first_ = 0;
+    }
+  }
+
+  /**
+   * @brief Should be called once every batch of the frame is drawn, moves
+   * on to the next segment if the current one was used.
+   */
+  void EndFrame() {
+    count_ = 0;
+
+    if (first_ == 0) {
+      return;
+    }
+
+    ring_buffer_.NextSegment();
+    first_ = 0;
+  }
+
+  [[nodiscard]] const Ref<VertexBuffer>& GetVertexBuffer() const {
+    return ring_buffer_.GetVertexBuffer();
+  }
+
+ private:
+  RingBuffer ring_buffer_;
+  uint32_t max_elements_;
+  uint32_t segment_elements_;
+
+  // current batch in the segment
+  uint32_t first_ = 0;
+  uint32_t count_ = 0;
+};
+
+}  // namespace eve
@@ -3,6 +3,7 @@
 #include "graphics/scene_renderer.h"
 
 #include "asset/asset_registry.h"
+#include "core/math/frustum.h"
 #include "core/utils/timer.h"
 #include "graphics/render_command.h"
 #include "graphics/renderer.h"
@@ -25,15 +26,16 @@ void SceneRenderer::RenderRuntime(float ds) {
   auto camera = scene->GetPrimaryCameraEntity();
   if (camera && camera.HasComponent<CameraComponent>()) {
     auto& cc = camera.GetComponent<CameraComponent>();
-    auto& tc = camera.GetTransform();
+    // interpolated by physics, should not be recalculated
+    const auto& tc = camera.GetComponent<WorldTransform>();
 
     CameraData data;
     if (cc.is_orthographic) {
       data = {cc.ortho_camera.GetViewMatrix(tc),
-              cc.ortho_camera.GetProjectionMatrix(), tc.GetPosition()};
+              cc.ortho_camera.GetProjectionMatrix(), tc.position};
     } else {
       data = {cc.persp_camera.GetViewMatrix(tc),
-              cc.persp_camera.GetProjectionMatrix(), tc.GetPosition()};
+              cc.persp_camera.GetProjectionMatrix(), tc.position};
     }
 
     RenderSceneRuntime(data);
@@ -82,7 +84,7 @@ void SceneRenderer::RenderSceneEditor(const CameraData& data) {
     RenderCameraBounds();
   }
 
-  RenderScene();
+  RenderScene(data);
 
   DrawGrid();
   RenderColliderBounds();
@@ -105,7 +107,7 @@ void SceneRenderer::RenderSceneRuntime(const CameraData& data) {
 
   renderer->BeginScene(data);
 
-  RenderScene();
+  RenderScene(data);
 
   if (settings_.draw_grid) {
     DrawGrid();
@@ -125,22 +127,44 @@ void SceneRenderer::RenderSceneRuntime(const CameraData& data) {
   stats.last_render_duration = timer.GetElapsedMilliseconds();
 }
 
-void SceneRenderer::RenderScene() {
+void SceneRenderer::RenderScene(const CameraData& data) {
   auto& scene = SceneManager::GetActive();
   auto& renderer = state_->renderer;
+  auto& stats = renderer->stats_;
+
+  const Frustum frustum = Frustum::FromMatrix(data.proj * data.view);
+  const auto is_visible = [&](const AABB& bounds,
+                              const glm::mat4& transform) {
+    return !settings_.frustum_culling || !bounds.IsValid() ||
+           frustum.Intersects(bounds.Transformed(transform));
+  };
 
-  scene->GetAllEntitiesWith<Transform, SpriteRendererComponent>().each(
-      [&](entt::entity entity_id, const Transform& transform,
+  // quads are unit sized on xy plane
+  static const AABB kQuadBounds = {{-0.5f, -0.5f, 0.0f}, {0.5f, 0.5f, 0.0f}};
+
+  // world transforms are updated by TransformSystem before rendering
+  scene->GetAllEntitiesWith<WorldTransform, SpriteRendererComponent>().each(
+      [&](entt::entity entity_id, const WorldTransform& transform,
           const SpriteRendererComponent& sprite) {
-        Entity entity{entity_id, scene.get()};
+        if (!is_visible(kQuadBounds, transform.matrix)) {
+          stats.culled_quads++;
+          return;
+        }
 
         Ref<Texture> texture = AssetRegistry::Get<Texture>(sprite.texture);
-        renderer->DrawQuad(transform, sprite.color, texture, sprite.tex_tiling);
+        renderer->DrawQuad(transform.matrix, sprite.color, texture,
+                           sprite.tex_tiling);
       });
 
-  scene->GetAllEntitiesWith<Transform, ModelComponent>().each(
-      [&](entt::entity entity_id, const Transform& transform,
+  scene->GetAllEntitiesWith<WorldTransform, ModelComponent>().each(
+      [&](entt::entity entity_id, const WorldTransform& transform,
           const ModelComponent& model_comp) {
+        Ref<Model> model = AssetRegistry::Get<Model>(model_comp.model);
+        if (model && !is_visible(model->bounds, transform.matrix)) {
+          stats.culled_models++;
+          return;
+        }
+
         Entity entity{entity_id, scene.get()};
 
         Material material{};
@@ -148,8 +172,7 @@ void SceneRenderer::RenderScene() {
           material = entity.GetComponent<Material>();
         }
 
-        renderer->DrawModel(AssetRegistry::Get<Model>(model_comp.model),
-                            transform, material);
+        renderer->DrawModel(model, transform.matrix, material);
       });
 }
 
@@ -199,7 +222,7 @@ void SceneRenderer::RenderCameraBounds() {
   // check for selected entity already done
   Entity selected_entity = scene->GetSelectedEntity();
   CameraComponent& cc = selected_entity.GetComponent<CameraComponent>();
-  Transform& tc = selected_entity.GetTransform();
+  const auto& tc = selected_entity.GetComponent<WorldTransform>();
 
   Color color(0.75f, 0.75f, 0.75f, 1.0f);
 
@@ -221,31 +244,31 @@ void SceneRenderer::RenderCameraBounds() {
 
     // Calculate points of the camera's frustum
     Box near_box = {
-        .bottom_left = tc.GetPosition() - 0.5f * near_height * tc.GetUp() -
+        .bottom_left = tc.position - 0.5f * near_height * tc.GetUp() -
                        0.5f * near_width * tc.GetRight() +
                        near_plane * tc.GetForward(),
-        .bottom_right = tc.GetPosition() - 0.5f * near_height * tc.GetUp() +
+        .bottom_right = tc.position - 0.5f * near_height * tc.GetUp() +
                         0.5f * near_width * tc.GetRight() +
                         near_plane * tc.GetForward(),
-        .top_left = tc.GetPosition() + 0.5f * near_height * tc.GetUp() -
+        .top_left = tc.position + 0.5f * near_height * tc.GetUp() -
                     0.5f * near_width * tc.GetRight() +
                     near_plane * tc.GetForward(),
-        .top_right = tc.GetPosition() + 0.5f * near_height * tc.GetUp() +
+        .top_right = tc.position + 0.5f * near_height * tc.GetUp() +
                      0.5f * near_width * tc.GetRight() +
                      near_plane * tc.GetForward(),
     };
 
     Box far_box = {
-        .bottom_left = tc.GetPosition() - 0.5f * far_height * tc.GetUp() -
+        .bottom_left = tc.position - 0.5f * far_height * tc.GetUp() -
                        0.5f * far_width * tc.GetRight() +
                        far_plane * tc.GetForward(),
-        .bottom_right = tc.GetPosition() - 0.5f * far_height * tc.GetUp() +
+        .bottom_right = tc.position - 0.5f * far_height * tc.GetUp() +
                         0.5f * far_width * tc.GetRight() +
                         far_plane * tc.GetForward(),
-        .top_left = tc.GetPosition() + 0.5f * far_height * tc.GetUp() -
+        .top_left = tc.position + 0.5f * far_height * tc.GetUp() -
                     0.5f * far_width * tc.GetRight() +
                     far_plane * tc.GetForward(),
-        .top_right = tc.GetPosition() + 0.5f * far_height * tc.GetUp() +
+        .top_right = tc.position + 0.5f * far_height * tc.GetUp() +
                      0.5f * far_width * tc.GetRight() +
                      far_plane * tc.GetForward()};
 
@@ -272,26 +295,26 @@ void SceneRenderer::RenderCameraBounds() {
 
     // Calculate points of the camera's frustum
     Box near_box = {
-        .bottom_left = tc.GetPosition() - half_height * tc.GetUp() -
+        .bottom_left = tc.position - half_height * tc.GetUp() -
                        half_width * tc.GetRight() +
                        near_plane * tc.GetForward(),
-        .bottom_right = tc.GetPosition() - half_height * tc.GetUp() +
+        .bottom_right = tc.position - half_height * tc.GetUp() +
                         half_width * tc.GetRight() +
                         near_plane * tc.GetForward(),
-        .top_left = tc.GetPosition() + half_height * tc.GetUp() -
+        .top_left = tc.position + half_height * tc.GetUp() -
                     half_width * tc.GetRight() + near_plane * tc.GetForward(),
-        .top_right = tc.GetPosition() + half_height * tc.GetUp() +
+        .top_right = tc.position + half_height * tc.GetUp() +
                      half_width * tc.GetRight() + near_plane * tc.GetForward()};
 
     Box far_box = {
-        .bottom_left = tc.GetPosition() - half_height * tc.GetUp() -
+        .bottom_left = tc.position - half_height * tc.GetUp() -
                        half_width * tc.GetRight() + far_plane * tc.GetForward(),
-        .bottom_right = tc.GetPosition() - half_height * tc.GetUp() +
+        .bottom_right = tc.position - half_height * tc.GetUp() +
                         half_width * tc.GetRight() +
                         far_plane * tc.GetForward(),
-        .top_left = tc.GetPosition() + half_height * tc.GetUp() -
+        .top_left = tc.position + half_height * tc.GetUp() -
                     half_width * tc.GetRight() + far_plane * tc.GetForward(),
-        .top_right = tc.GetPosition() + half_height * tc.GetUp() +
+        .top_right = tc.position + half_height * tc.GetUp() +
                      half_width * tc.GetRight() + far_plane * tc.GetForward()};
 
     // Draw frustum boxes
@@ -13,6 +13,7 @@ namespace eve {
 struct SceneRendererSettings {
   bool draw_grid = false;
   bool render_physics_bounds = false;
+  bool frustum_culling = true;
 };
 
 class SceneRenderer {
@@ -32,7 +33,7 @@ class SceneRenderer {
 
   void RenderSceneRuntime(const CameraData& data);
 
-  void RenderScene();
+  void RenderScene(const CameraData& data);
 
   void DrawGrid();
 
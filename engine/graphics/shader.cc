@@ -3,6 +3,7 @@
 #include "graphics/shader.h"
 
 #include "graphics/graphics.h"
+#include "graphics/platforms/null/null_shader.h"
 #include "graphics/platforms/opengl/opengl_shader.h"
 
 namespace eve {
@@ -13,6 +14,8 @@ Ref<Shader> Shader::Create(const std::string& vs_path,
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLShader>(vs_path, fs_path, custom_shader);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullShader>(vs_path, fs_path, custom_shader);
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -4,6 +4,7 @@
 
 #include "graphics/graphics.h"
 #include "graphics/render_command.h"
+#include "platforms/null/null_skybox.h"
 #include "platforms/opengl/opengl_skybox.h"
 
 namespace eve {
@@ -55,6 +56,8 @@ Ref<SkyBox> SkyBox::Create(const fs::path& path) {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLSkyBox>(path);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullSkyBox>();
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -68,6 +71,8 @@ Ref<SkyBox> SkyBox::Create(const std::vector<fs::path>& paths) {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLSkyBox>(paths);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullSkyBox>();
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
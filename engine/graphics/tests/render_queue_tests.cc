@@ -0,0 +1,57 @@
+#include "catch2/catch_all.hpp"
+
+#include "graphics/render_queue.h"
+
+using namespace eve;
+
+TEST_CASE("RenderQueue sorting", "[RenderQueue]") {
+  RenderQueue queue;
+
+  SECTION("Matches stable sort") {
+    std::mt19937_64 rng(1337);
+
+    std::vector<RenderQueueItem> expected;
+    for (uint32_t i = 0; i < 10000; i++) {
+      // limit the range so there are duplicate keys
+      const uint64_t key = rng() % 512 << (rng() % 56);
+      queue.Push(key, RenderQueueItemType::kQuad, i);
+      expected.push_back({key, i, RenderQueueItemType::kQuad});
+    }
+
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const auto& lhs, const auto& rhs) {
+                       return lhs.key < rhs.key;
+                     });
+
+    queue.Sort();
+
+    const auto& items = queue.GetItems();
+    REQUIRE(items.size() == expected.size());
+    for (size_t i = 0; i < items.size(); i++) {
+      REQUIRE(items[i].key == expected[i].key);
+      REQUIRE(items[i].index == expected[i].index);
+    }
+  }
+
+  SECTION("Opaque draws are grouped, translucent ones are back to front") {
+    queue.Push(RenderQueue::CreateKey(0, 0, 5.0f, true),
+               RenderQueueItemType::kQuad, 0);
+    queue.Push(RenderQueue::CreateKey(0, 2, 1.0f, false),
+               RenderQueueItemType::kQuad, 1);
+    queue.Push(RenderQueue::CreateKey(0, 0, 10.0f, true),
+               RenderQueueItemType::kQuad, 2);
+    queue.Push(RenderQueue::CreateKey(0, 1, 20.0f, false),
+               RenderQueueItemType::kQuad, 3);
+    queue.Push(RenderQueue::CreateKey(0, 1, 2.0f, false),
+               RenderQueueItemType::kQuad, 4);
+
+    queue.Sort();
+
+    std::vector<uint32_t> order;
+    for (const RenderQueueItem& item : queue.GetItems()) {
+      order.push_back(item.index);
+    }
+
+    REQUIRE(order == std::vector<uint32_t>{4, 3, 1, 2, 0});
+  }
+}
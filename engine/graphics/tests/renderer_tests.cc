@@ -0,0 +1,189 @@
+#include "catch2/catch_all.hpp"
+
+#include "graphics/platforms/null/null_device.h"
+#include "graphics/renderer.h"
+
+using namespace eve;
+
+static CameraData GetTestCameraData() {
+  return {glm::mat4(1.0f), glm::mat4(1.0f), glm::vec3(0.0f)};
+}
+
+static Ref<Model> CreateTestModel(uint32_t mesh_count) {
+  Ref<Model> model = CreateRef<Model>();
+  model->vertex_storage = {{{0, 0, 0, 1}}, {{1, 0, 0, 1}}, {{0, 1, 0, 1}}};
+  model->index_storage = {0, 1, 2};
+
+  // meshes share the same triangle
+  for (uint32_t i = 0; i < mesh_count; i++) {
+    MeshData mesh;
+    mesh.vertices = model->vertex_storage;
+    mesh.indices = model->index_storage;
+    model->meshes.push_back(mesh);
+  }
+
+  return model;
+}
+
+TEST_CASE("Renderer records draw commands on null device", "[Renderer]") {
+  Renderer renderer;
+  NullDeviceRecord& record = GetNullDeviceRecord();
+
+  SECTION("Empty scene issues no draw calls") {
+    record.Reset();
+
+    renderer.BeginScene(GetTestCameraData());
+    renderer.EndScene();
+
+    REQUIRE(record.GetDrawCount() == 0);
+    REQUIRE(renderer.GetStats().draw_calls == 0);
+  }
+
+  SECTION("Quads are batched into a single draw call") {
+    record.Reset();
+    renderer.ResetStats();
+
+    renderer.BeginScene(GetTestCameraData());
+    for (uint32_t i = 0; i < 100; i++) {
+      renderer.DrawQuad(Transform{});
+    }
+    renderer.EndScene();
+
+    REQUIRE(record.GetDrawCount() == 1);
+    REQUIRE(record.draw_commands[0].count == 100 * kQuadIndexCount);
+    REQUIRE(renderer.GetStats().draw_calls == 1);
+    REQUIRE(record.uploaded_bytes > 0);
+  }
+
+  SECTION("Quads exceeding batch size are split") {
+    record.Reset();
+    renderer.ResetStats();
+
+    renderer.BeginScene(GetTestCameraData());
+    for (uint32_t i = 0; i < kQuadMaxInstances * 2; i++) {
+      renderer.DrawQuad(Transform{});
+    }
+    renderer.EndScene();
+
+    REQUIRE(record.GetDrawCount() == renderer.GetStats().draw_calls);
+    REQUIRE(record.GetDrawCount() >= 2);
+  }
+
+  SECTION("Textures do not break quad batches") {
+    TextureMetadata metadata;
+    metadata.size = {1, 1};
+
+    uint32_t color = 0xffffffff;
+
+    std::vector<Ref<Texture>> textures;
+    for (uint32_t i = 0; i < 40; i++) {
+      textures.push_back(Texture::Create(metadata, &color));
+    }
+
+    record.Reset();
+    renderer.ResetStats();
+
+    // more textures than a shader could bind at once
+    renderer.BeginScene(GetTestCameraData());
+    for (uint32_t i = 0; i < 10; i++) {
+      for (const Ref<Texture>& texture : textures) {
+        renderer.DrawQuad(Transform{}, kColorWhite, texture);
+      }
+    }
+    renderer.EndScene();
+
+    REQUIRE(record.GetDrawCount() == 1);
+  }
+
+  SECTION("Models are drawn instanced once per mesh") {
+    Ref<Model> model = CreateTestModel(2);
+
+    record.Reset();
+    renderer.ResetStats();
+
+    renderer.BeginScene(GetTestCameraData());
+    for (uint32_t i = 0; i < 100; i++) {
+      renderer.DrawModel(model, Transform{});
+    }
+    renderer.EndScene();
+
+    REQUIRE(record.GetDrawCount() == 2);
+    for (const auto& command : record.draw_commands) {
+      REQUIRE(command.type == NullDrawType::kIndexedInstanced);
+      REQUIRE(command.count == 3);
+      REQUIRE(command.instance_count == 100);
+    }
+
+    // static buffers are uploaded only once
+    record.Reset();
+
+    renderer.BeginScene(GetTestCameraData());
+    renderer.DrawModel(model, Transform{});
+    renderer.EndScene();
+
+    REQUIRE(record.uploaded_bytes ==
+            sizeof(CameraData) + 2 * sizeof(MeshInstance));
+  }
+
+  SECTION("Translucent draws keep their back to front order") {
+    Ref<Model> model = CreateTestModel(1);
+
+    Material material;
+    material.albedo.a = 0.5f;
+
+    const Color color = {1.0f, 1.0f, 1.0f, 0.5f};
+
+    const auto at_distance = [](float distance) {
+      Transform transform;
+      transform.local_position = {0.0f, 0.0f, -distance};
+      return transform;
+    };
+
+    record.Reset();
+    renderer.ResetStats();
+
+    renderer.BeginScene(GetTestCameraData());
+    renderer.DrawQuad(at_distance(1.0f), color);
+    renderer.DrawModel(model, at_distance(2.0f), material);
+    renderer.DrawModel(model, at_distance(3.0f), material);
+    renderer.DrawQuad(at_distance(4.0f), color);
+    renderer.EndScene();
+
+    // far quad, both models in a single non-instanced batch, near quad
+    REQUIRE(record.GetDrawCount() == 3);
+    REQUIRE(record.draw_commands[0].count == kQuadIndexCount);
+    REQUIRE(record.draw_commands[1].type == NullDrawType::kIndexed);
+    REQUIRE(record.draw_commands[1].count == 2 * 3);
+    REQUIRE(record.draw_commands[2].count == kQuadIndexCount);
+  }
+}
+
+TEST_CASE("Renderer CPU frame time", "[Renderer][!benchmark]") {
+  Renderer renderer;
+
+  BENCHMARK("DrawQuad 10000") {
+    GetNullDeviceRecord().Reset();
+
+    renderer.BeginScene(GetTestCameraData());
+    for (uint32_t i = 0; i < 10000; i++) {
+      renderer.DrawQuad(Transform{});
+    }
+    renderer.EndScene();
+
+    return GetNullDeviceRecord().GetDrawCount();
+  };
+
+  Ref<Model> model = CreateTestModel(4);
+
+  BENCHMARK("DrawModel 10000") {
+    GetNullDeviceRecord().Reset();
+
+    renderer.BeginScene(GetTestCameraData());
+    for (uint32_t i = 0; i < 10000; i++) {
+      renderer.DrawModel(model, Transform{});
+    }
+    renderer.EndScene();
+
+    return GetNullDeviceRecord().GetDrawCount();
+  };
+}
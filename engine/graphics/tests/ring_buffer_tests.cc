@@ -0,0 +1,117 @@
+#include "catch2/catch_all.hpp"
+
+#include "graphics/platforms/null/null_device.h"
+#include "graphics/renderer.h"
+#include "graphics/ring_buffer.h"
+
+using namespace eve;
+
+TEST_CASE("RingBuffer segments are used in turns", "[RingBuffer]") {
+  NullDeviceRecord& record = GetNullDeviceRecord();
+  record.Reset();
+
+  constexpr uint32_t kSegmentSize = 64;
+
+  RingBuffer ring_buffer(kSegmentSize);
+  REQUIRE(ring_buffer.GetSegmentCount() == kRingBufferSegmentCount);
+
+  uint8_t* mapped_data =
+      static_cast<uint8_t*>(ring_buffer.GetVertexBuffer()->GetMappedData());
+  REQUIRE(mapped_data != nullptr);
+
+  SECTION("Segments do not overlap") {
+    for (uint32_t i = 0; i < kRingBufferSegmentCount; i++) {
+      REQUIRE(ring_buffer.GetSegmentIndex() == i);
+      REQUIRE(ring_buffer.GetSegmentData() == mapped_data + i * kSegmentSize);
+      ring_buffer.NextSegment();
+    }
+
+    REQUIRE(ring_buffer.GetSegmentIndex() == 0);
+  }
+
+  SECTION("Reused segments wait for their fences") {
+    for (uint32_t i = 0; i < kRingBufferSegmentCount - 1; i++) {
+      ring_buffer.NextSegment();
+    }
+    REQUIRE(record.fence_wait_count == 0);
+
+    // back to the first segment
+    ring_buffer.NextSegment();
+    REQUIRE(record.fence_wait_count == 1);
+
+    ring_buffer.NextSegment();
+    REQUIRE(record.fence_wait_count == 2);
+  }
+
+  SECTION("Writes go directly to mapped memory") {
+    RingBufferArray<uint32_t> array(4);
+    uint32_t* data =
+        static_cast<uint32_t*>(array.GetVertexBuffer()->GetMappedData());
+
+    array.Add(42);
+    array.Submit();
+    array.Add(43);
+
+    // flushes of the same frame are placed one after another
+    REQUIRE(array.GetBaseIndex() == 1);
+    REQUIRE(data[0] == 42);
+    REQUIRE(data[1] == 43);
+
+    array.Submit();
+    array.EndFrame();
+    array.Add(44);
+
+    REQUIRE(array.GetBaseIndex() == 4 * kRingBufferBatchesPerSegment);
+    REQUIRE(data[4 * kRingBufferBatchesPerSegment] == 44);
+    REQUIRE(record.uploaded_bytes == 0);
+    REQUIRE(record.fence_wait_count == 0);
+  }
+}
+
+TEST_CASE("Primitives draw from ring buffer segments", "[RingBuffer]") {
+  Renderer renderer;
+  NullDeviceRecord& record = GetNullDeviceRecord();
+
+  const CameraData camera_data = {glm::mat4(1.0f), glm::mat4(1.0f),
+                                  glm::vec3(0.0f)};
+
+  record.Reset();
+
+  for (uint32_t frame = 0; frame < kRingBufferSegmentCount + 1; frame++) {
+    renderer.BeginScene(camera_data);
+    renderer.DrawQuad(Transform{});
+    renderer.EndScene();
+  }
+
+  REQUIRE(record.GetDrawCount() == kRingBufferSegmentCount + 1);
+  for (uint32_t frame = 0; frame < record.GetDrawCount(); frame++) {
+    const uint32_t segment = frame % kRingBufferSegmentCount;
+    REQUIRE(record.draw_commands[frame].first_vertex ==
+            segment * kQuadMaxVertexCount * kRingBufferBatchesPerSegment);
+  }
+
+  // only camera data is uploaded, vertices are written in place
+  REQUIRE(record.uploaded_bytes ==
+          (kRingBufferSegmentCount + 1) * sizeof(CameraData));
+
+  SECTION("Flushes of a frame share its segment") {
+    record.Reset();
+
+    // more batches than there are segments
+    renderer.BeginScene(camera_data);
+    for (uint32_t i = 0; i < kQuadMaxInstances * kRingBufferSegmentCount;
+         i++) {
+      renderer.DrawQuad(Transform{});
+    }
+    renderer.EndScene();
+
+    REQUIRE(record.GetDrawCount() == kRingBufferSegmentCount + 1);
+    for (uint32_t i = 1; i < record.GetDrawCount(); i++) {
+      REQUIRE(record.draw_commands[i].first_vertex >
+              record.draw_commands[i - 1].first_vertex);
+    }
+
+    // only moving on to the next frame's segment waits, not the flushes
+    REQUIRE(record.fence_wait_count == 1);
+  }
+}
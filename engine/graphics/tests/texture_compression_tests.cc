@@ -0,0 +1,211 @@
+#include "catch2/catch_all.hpp"
+
+#include "graphics/cooked_texture.h"
+#include "graphics/platforms/null/null_device.h"
+#include "graphics/texture_compression.h"
+
+using namespace eve;
+
+namespace {
+
+void DecodeRGB565(uint16_t packed, int* color) {
+  const int r = (packed >> 11) & 31;
+  const int g = (packed >> 5) & 63;
+  const int b = packed & 31;
+  color[0] = (r << 3) | (r >> 2);
+  color[1] = (g << 2) | (g >> 4);
+  color[2] = (b << 3) | (b >> 2);
+}
+
+void DecodeBlockBC1(const uint8_t* block, uint8_t* pixels) {
+  const uint16_t color0 = block[0] | (block[1] << 8);
+  const uint16_t color1 = block[2] | (block[3] << 8);
+
+  int palette[4][3];
+  DecodeRGB565(color0, palette[0]);
+  DecodeRGB565(color1, palette[1]);
+  for (int c = 0; c < 3; c++) {
+    if (color0 > color1) {
+      palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+      palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    } else {
+      palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+      palette[3][c] = 0;
+    }
+  }
+
+  for (int i = 0; i < 16; i++) {
+    const int index = (block[4 + i / 4] >> ((i % 4) * 2)) & 3;
+    for (int c = 0; c < 3; c++) {
+      pixels[i * 4 + c] = palette[index][c];
+    }
+    pixels[i * 4 + 3] = 255;
+  }
+}
+
+uint32_t ReadBits(const uint8_t* block, uint32_t& position, uint32_t count) {
+  uint32_t value = 0;
+  for (uint32_t i = 0; i < count; i++, position++) {
+    value |= ((block[position / 8] >> (position % 8)) & 1) << i;
+  }
+  return value;
+}
+
+void DecodeBlockBC3(const uint8_t* block, uint8_t* pixels) {
+  DecodeBlockBC1(block + 8, pixels);
+
+  const int alpha0 = block[0];
+  const int alpha1 = block[1];
+
+  int palette[8] = {alpha0, alpha1};
+  for (int i = 1; i < 7; i++) {
+    palette[i + 1] = alpha0 > alpha1
+                         ? ((7 - i) * alpha0 + i * alpha1) / 7
+                         : alpha0;
+  }
+
+  uint32_t position = 16;
+  for (int i = 0; i < 16; i++) {
+    pixels[i * 4 + 3] = palette[ReadBits(block, position, 3)];
+  }
+}
+
+// only mode 6 is produced by the encoder
+void DecodeBlockBC7(const uint8_t* block, uint8_t* pixels) {
+  static constexpr int kWeights[16] = {0,  4,  9,  13, 17, 21, 26, 30,
+                                       34, 38, 43, 47, 51, 55, 60, 64};
+
+  uint32_t position = 0;
+  REQUIRE(ReadBits(block, position, 7) == 1 << 6);
+
+  int endpoints[2][4];
+  for (int c = 0; c < 4; c++) {
+    endpoints[0][c] = ReadBits(block, position, 7) << 1;
+    endpoints[1][c] = ReadBits(block, position, 7) << 1;
+  }
+
+  const int p_bit0 = ReadBits(block, position, 1);
+  const int p_bit1 = ReadBits(block, position, 1);
+  for (int c = 0; c < 4; c++) {
+    endpoints[0][c] |= p_bit0;
+    endpoints[1][c] |= p_bit1;
+  }
+
+  for (int i = 0; i < 16; i++) {
+    const int weight = kWeights[ReadBits(block, position, i == 0 ? 3 : 4)];
+    for (int c = 0; c < 4; c++) {
+      pixels[i * 4 + c] =
+          ((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >>
+          6;
+    }
+  }
+}
+
+std::vector<uint8_t> CreateGradientBlock(bool with_alpha) {
+  std::vector<uint8_t> pixels(64);
+  for (int i = 0; i < 16; i++) {
+    pixels[i * 4 + 0] = 40 + i * 10;
+    pixels[i * 4 + 1] = 200 - i * 8;
+    pixels[i * 4 + 2] = 90;
+    pixels[i * 4 + 3] = with_alpha ? 255 - i * 15 : 255;
+  }
+  return pixels;
+}
+
+int GetMaxError(const std::vector<uint8_t>& lhs, const uint8_t* rhs) {
+  int max_error = 0;
+  for (size_t i = 0; i < lhs.size(); i++) {
+    max_error = std::max(max_error, std::abs(lhs[i] - rhs[i]));
+  }
+  return max_error;
+}
+
+}  // namespace
+
+TEST_CASE("Texture blocks are compressed", "[TextureCompression]") {
+  // gradients are spread over 4 colors in bc1 and 8 alpha values in bc3
+  constexpr int kPaletteError = 24;
+
+  uint8_t block[16];
+  uint8_t decoded[64];
+
+  SECTION("BC1") {
+    const std::vector<uint8_t> pixels = CreateGradientBlock(false);
+
+    CompressBlockBC1(pixels.data(), block);
+    DecodeBlockBC1(block, decoded);
+
+    REQUIRE(GetMaxError(pixels, decoded) <= kPaletteError);
+  }
+
+  SECTION("BC3") {
+    const std::vector<uint8_t> pixels = CreateGradientBlock(true);
+
+    CompressBlockBC3(pixels.data(), block);
+    DecodeBlockBC3(block, decoded);
+
+    REQUIRE(GetMaxError(pixels, decoded) <= kPaletteError);
+  }
+
+  SECTION("BC7") {
+    const std::vector<uint8_t> pixels = CreateGradientBlock(true);
+
+    CompressBlockBC7(pixels.data(), block);
+    DecodeBlockBC7(block, decoded);
+
+    REQUIRE(GetMaxError(pixels, decoded) <= 8);
+  }
+
+  SECTION("Solid blocks stay solid") {
+    std::vector<uint8_t> pixels(64);
+    for (int i = 0; i < 16; i++) {
+      pixels[i * 4 + 0] = 255;
+      pixels[i * 4 + 1] = 0;
+      pixels[i * 4 + 2] = 255;
+      pixels[i * 4 + 3] = 255;
+    }
+
+    CompressBlockBC1(pixels.data(), block);
+    DecodeBlockBC1(block, decoded);
+
+    REQUIRE(GetMaxError(pixels, decoded) == 0);
+  }
+}
+
+TEST_CASE("Cooked textures keep their mip chain", "[TextureCompression]") {
+  const fs::path path =
+      fs::temp_directory_path() / "eve_cooked_texture_test.etex";
+
+  // non power of two sizes are scaled to their texture array size
+  TextureImage image;
+  image.metadata.size = {48, 20};
+  image.metadata.format = TextureFormat::kRGB;
+  image.metadata.generate_mipmaps = true;
+
+  const uint64_t pixel_count = 48 * 20;
+  image.pixels = Ref<uint8_t>(new uint8_t[pixel_count * 3],
+                              std::default_delete<uint8_t[]>());
+  std::fill_n(image.pixels.get(), pixel_count * 3, 128);
+
+  REQUIRE(CookTexture(image, path));
+
+  TextureImage cooked_image;
+  REQUIRE(LoadCookedTexture(path, cooked_image));
+
+  const TextureMetadata& metadata = cooked_image.metadata;
+  REQUIRE(metadata.size == glm::ivec2(64, 32));
+  REQUIRE(metadata.format == TextureFormat::kBC1);
+  REQUIRE(metadata.mip_count == 7);
+  REQUIRE(cooked_image.levels.size() == 7);
+  REQUIRE(cooked_image.levels.front().size() == 16 * 8 * 8);
+  REQUIRE(cooked_image.levels.back().size() == 8);
+
+  const uint64_t uploaded_bytes = GetNullDeviceRecord().uploaded_bytes;
+
+  Ref<Texture> texture = Texture::Create(cooked_image);
+  REQUIRE(texture->GetMemoryUsage() ==
+          GetNullDeviceRecord().uploaded_bytes - uploaded_bytes);
+
+  cooked_image = {};
+  fs::remove(path);
+}
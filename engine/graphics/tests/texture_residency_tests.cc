@@ -0,0 +1,139 @@
+#include "catch2/catch_all.hpp"
+
+#include "graphics/platforms/null/null_device.h"
+#include "graphics/texture_residency.h"
+
+using namespace eve;
+
+static Ref<Texture> CreateTestTexture(
+    const glm::ivec2& size,
+    TextureFilteringMode filter = TextureFilteringMode::kLinear) {
+  TextureMetadata metadata;
+  metadata.size = size;
+  metadata.min_filter = filter;
+  metadata.mag_filter = filter;
+
+  return Texture::Create(metadata, nullptr);
+}
+
+static uint32_t GetArrayIndex(TextureIndex index) {
+  return index / kMaxTextureArrayLayers;
+}
+
+TEST_CASE("TextureResidency assigns texture indices", "[TextureResidency]") {
+  TextureResidency residency;
+
+  SECTION("Indices are stable") {
+    Ref<Texture> texture = CreateTestTexture({32, 32});
+
+    const TextureIndex index = residency.GetIndex(texture).value();
+    REQUIRE(residency.GetIndex(texture) == index);
+    REQUIRE(index != residency.GetWhiteIndex());
+    REQUIRE(residency.GetIndex(nullptr) == residency.GetWhiteIndex());
+  }
+
+  SECTION("Textures are grouped by size bucket and sampling") {
+    Ref<Texture> texture = CreateTestTexture({30, 30});
+    Ref<Texture> same_bucket = CreateTestTexture({32, 32});
+    Ref<Texture> nearest =
+        CreateTestTexture({32, 32}, TextureFilteringMode::kNearest);
+
+    const TextureIndex index = residency.GetIndex(texture).value();
+    const TextureIndex same_bucket_index = residency.GetIndex(same_bucket);
+    const TextureIndex nearest_index = residency.GetIndex(nearest);
+
+    REQUIRE(index != same_bucket_index);
+    REQUIRE(GetArrayIndex(index) == GetArrayIndex(same_bucket_index));
+    REQUIRE(GetArrayIndex(index) != GetArrayIndex(nearest_index));
+  }
+
+  SECTION("Arrays grow without moving layers") {
+    std::vector<Ref<Texture>> textures;
+    std::set<TextureIndex> indices;
+
+    for (uint32_t i = 0; i < kTextureArrayInitialLayerCount * 2; i++) {
+      textures.push_back(CreateTestTexture({64, 64}));
+      indices.insert(residency.GetIndex(textures.back()).value());
+    }
+
+    REQUIRE(indices.size() == textures.size());
+    REQUIRE(GetArrayIndex(*indices.begin()) ==
+            GetArrayIndex(*indices.rbegin()));
+    REQUIRE(residency.GetIndex(textures.front()) == *indices.begin());
+  }
+
+  SECTION("Layers of destroyed textures are reused") {
+    std::vector<Ref<Texture>> textures;
+    for (uint32_t i = 0; i < kTextureArrayInitialLayerCount; i++) {
+      textures.push_back(CreateTestTexture({64, 64}));
+      (void)residency.GetIndex(textures.back());
+    }
+
+    const TextureIndex released_index =
+        residency.GetIndex(textures.back()).value();
+    textures.pop_back();
+
+    Ref<Texture> texture = CreateTestTexture({64, 64});
+    REQUIRE(residency.GetIndex(texture) == released_index);
+    REQUIRE(residency.GetResidentCount() ==
+            kTextureArrayInitialLayerCount + 1);
+  }
+
+  SECTION("Layers are copied again when texture data changes") {
+    Ref<Texture> texture = CreateTestTexture({4, 4});
+
+    const TextureIndex index = residency.GetIndex(texture).value();
+    GetNullDeviceRecord().Reset();
+
+    (void)residency.GetIndex(texture);
+    REQUIRE(GetNullDeviceRecord().layer_copy_count == 0);
+
+    std::vector<uint32_t> pixels(4 * 4, 0xff0000ff);
+    texture->SetData(pixels.data(), pixels.size() * sizeof(uint32_t));
+
+    REQUIRE(residency.GetIndex(texture) == index);
+    REQUIRE(GetNullDeviceRecord().layer_copy_count == 1);
+
+    (void)residency.GetIndex(texture);
+    REQUIRE(GetNullDeviceRecord().layer_copy_count == 1);
+  }
+
+  SECTION("Textures which do not fit are bound to slots") {
+    // every size bucket needs its own array
+    std::vector<Ref<Texture>> textures;
+    std::optional<TextureIndex> index;
+    do {
+      const uint32_t i = textures.size();
+      textures.push_back(CreateTestTexture({1 << (i % 8), 1 << (i / 8)}));
+      index = residency.GetIndex(textures.back());
+    } while (index);
+
+    REQUIRE(residency.GetArrayCount() == kMaxTextureArrays);
+    REQUIRE(residency.GetIndex(nullptr) == residency.GetWhiteIndex());
+
+    TextureSlots slots;
+    REQUIRE(slots.Find(textures.back()) == kTextureSlotIndexBase);
+    REQUIRE(slots.Find(textures.back()) == kTextureSlotIndexBase);
+
+    for (uint32_t i = 1; i < kMaxTextureSlots; i++) {
+      REQUIRE(slots.Find(CreateTestTexture({8, 8})) ==
+              kTextureSlotIndexBase + i);
+    }
+    REQUIRE(slots.IsFull());
+    REQUIRE_FALSE(slots.Find(textures.front()));
+
+    slots.Reset();
+    REQUIRE_FALSE(slots.IsFull());
+  }
+
+  SECTION("Layers are kept within the memory budget") {
+    std::vector<Ref<Texture>> textures;
+    do {
+      textures.push_back(
+          CreateTestTexture({kMaxTextureArraySize, kMaxTextureArraySize}));
+    } while (residency.GetIndex(textures.back()));
+
+    REQUIRE(textures.size() > 1);
+    REQUIRE(residency.GetMemoryUsage() <= kTextureArrayMemoryBudget);
+  }
+}
@@ -5,7 +5,9 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+#include "graphics/cooked_texture.h"
 #include "graphics/graphics.h"
+#include "graphics/platforms/null/null_texture.h"
 #include "graphics/platforms/opengl/opengl_texture.h"
 
 namespace eve {
@@ -14,6 +16,8 @@ Ref<Texture> Texture::Create(const TextureMetadata& metadata,
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLTexture2D>(metadata, pixels);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullTexture2D>(metadata, pixels);
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -23,18 +27,106 @@ Ref<Texture> Texture::Create(const TextureMetadata& metadata,
   }
 }
 
+Ref<Texture> Texture::Create(const TextureMetadata& metadata,
+                             std::span<const TextureLevelData> levels) {
+  switch (GetGraphicsAPI()) {
+    case GraphicsAPI::kOpenGL:
+      return CreateRef<OpenGLTexture2D>(metadata, levels);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullTexture2D>(metadata, levels);
+    case GraphicsAPI::kVulkan:
+      EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
+      return nullptr;
+    default:
+      EVE_ASSERT_ENGINE(false, "Unknown graphics API");
+      return nullptr;
+  }
+}
+
+size_t Texture::GetMemoryUsage() const {
+  const TextureMetadata& metadata = GetMetadata();
+
+  size_t size = 0;
+  for (uint32_t level = 0; level < metadata.mip_count; level++) {
+    size += GetTextureLevelSize(metadata.format,
+                                glm::max(metadata.size >> int(level), 1));
+  }
+
+  // generated mip chain adds a third of the base level
+  return metadata.generate_mipmaps ? size + size / 3 : size;
+}
+
+Ref<Texture> Texture::Create(const TextureImage& image) {
+  if (!image.levels.empty()) {
+    return Texture::Create(image.metadata, image.levels);
+  }
+
+  return Texture::Create(image.metadata, image.pixels.get());
+}
+
 Ref<Texture> Texture::Create(const fs::path& path, const TextureType& type) {
+  TextureImage image;
+  if (!LoadTextureImage(path, image, type)) {
+    EVE_ASSERT_ENGINE(false);
+    return nullptr;
+  }
+
+  return Texture::Create(image);
+}
+
+bool IsCompressedTextureFormat(TextureFormat format) {
+  return format == TextureFormat::kBC1 || format == TextureFormat::kBC3 ||
+         format == TextureFormat::kBC7;
+}
+
+uint64_t GetTextureLevelSize(TextureFormat format, const glm::ivec2& size) {
+  const uint64_t width = static_cast<uint64_t>(size.x);
+  const uint64_t height = static_cast<uint64_t>(size.y);
+
+  switch (format) {
+    case TextureFormat::kRed:
+      return width * height;
+    case TextureFormat::kRG:
+      return width * height * 2;
+    case TextureFormat::kRGB:
+    case TextureFormat::kBGR:
+      return width * height * 3;
+    case TextureFormat::kRGBA:
+    case TextureFormat::kBGRA:
+      return width * height * 4;
+    case TextureFormat::kBC1:
+      return ((width + 3) / 4) * ((height + 3) / 4) * 8;
+    case TextureFormat::kBC3:
+    case TextureFormat::kBC7:
+      return ((width + 3) / 4) * ((height + 3) / 4) * 16;
+    default:
+      return 0;
+  }
+}
+
+bool LoadTextureImage(const fs::path& path, TextureImage& image,
+                      const TextureType& type, bool cook) {
+  if (path.extension() == kCookedTextureExtension) {
+    return LoadCookedTexture(path, image);
+  }
+
+  const fs::path cooked_path = GetCookedTexturePath(path);
+  if (cook && IsCookedTextureUpToDate(path, cooked_path) &&
+      LoadCookedTexture(cooked_path, image)) {
+    image.metadata.type = type;
+    return true;
+  }
+
   int width, height, channels;
   stbi_uc* data =
       stbi_load(path.string().c_str(), &width, &height, &channels, 0);
 
   if (!data) {
-    stbi_image_free(data);
     EVE_LOG_ENGINE_ERROR("Unable to load texture from: {}", path.string());
-    EVE_ASSERT_ENGINE(false);
+    return false;
   }
 
-  TextureMetadata metadata;
+  TextureMetadata& metadata = image.metadata;
   metadata.size = glm::ivec2{width, height};
   metadata.type = type;
   metadata.min_filter = TextureFilteringMode::kLinear;
@@ -57,14 +149,32 @@ Ref<Texture> Texture::Create(const fs::path& path, const TextureType& type) {
       metadata.format = TextureFormat::kRGBA;
       break;
     default:
-      EVE_ASSERT_ENGINE(false, "Unsupported number of channels in the image");
-      break;
+      stbi_image_free(data);
+      EVE_LOG_ENGINE_ERROR("Unsupported number of channels in the image: {}",
+                           path.string());
+      return false;
   }
 
-  Ref<Texture> texture = Texture::Create(metadata, data);
+  image.pixels = Ref<uint8_t>(data, stbi_image_free);
 
-  stbi_image_free(data);
+  if (!cook) {
+    return true;
+  }
 
-  return texture;
+  // cook at load time so following loads skip decoding, the decoded image
+  // is still used if the cooked one could not be written
+  if (CookTexture(image, cooked_path)) {
+    TextureImage cooked_image;
+    if (LoadCookedTexture(cooked_path, cooked_image)) {
+      cooked_image.metadata.type = type;
+      image = cooked_image;
+    }
+  } else {
+    EVE_LOG_ENGINE_WARNING("Unable to cook texture to: {}",
+                           cooked_path.string());
+  }
+
+  return true;
 }
+
 }  // namespace eve
\ No newline at end of file
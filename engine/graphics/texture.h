@@ -5,6 +5,7 @@
 #include "pch_shared.h"
 
 #include "asset/asset.h"
+#include "core/mapped_file.h"
 
 namespace eve {
 
@@ -17,6 +18,10 @@ enum class TextureFormat {
   kBGR,
   kRGBA,
   kBGRA,
+  // block compressed formats, always created from pre-generated levels
+  kBC1,
+  kBC3,
+  kBC7,
 };
 
 enum class TextureFilteringMode {
@@ -41,8 +46,49 @@ struct TextureMetadata final {
   TextureWrappingMode wrap_s = TextureWrappingMode::kRepeat;
   TextureWrappingMode wrap_t = TextureWrappingMode::kRepeat;
   bool generate_mipmaps = true;
+  // levels given on creation, the rest are generated if requested
+  uint32_t mip_count = 1;
 };
 
+/**
+ * @brief Data of a single mip level, tightly packed.
+ */
+typedef std::span<const uint8_t> TextureLevelData;
+
+/**
+ * @brief Decoded pixels of an image file, decoding does not touch the
+ * graphics API so it could be done on worker threads.
+ */
+struct TextureImage final {
+  TextureMetadata metadata;
+  Ref<uint8_t> pixels = nullptr;
+
+  // pre-generated levels of cooked textures pointing into the mapped file
+  std::vector<TextureLevelData> levels;
+  Ref<MappedFile> mapped_file = nullptr;
+};
+
+[[nodiscard]] bool IsCompressedTextureFormat(TextureFormat format);
+
+/**
+ * @brief Size of a level in bytes, compressed formats are stored in 4x4
+ * blocks so levels smaller than a block still take a whole one.
+ */
+[[nodiscard]] uint64_t GetTextureLevelSize(TextureFormat format,
+                                           const glm::ivec2& size);
+
+/**
+ * @brief Decodes the image at @p path into @p image. If @p cook is set an up
+ * to date cooked texture is preferred, otherwise the image is cooked for the
+ * next time. Cooking is lossy and resizes the image to its texture array
+ * size, so it is meant for project assets only.
+ *
+ * @return false If the image could not be decoded.
+ */
+[[nodiscard]] bool LoadTextureImage(
+    const fs::path& path, TextureImage& image,
+    const TextureType& type = TextureType::kDiffuse, bool cook = false);
+
 class Texture : public Asset {
  public:
   EVE_IMPL_ASSET(AssetType::kTexture)
@@ -53,15 +99,35 @@ class Texture : public Asset {
 
   virtual void SetData(void* data, uint32_t size) = 0;
 
+  /**
+   * @brief Incremented every time the data of the texture changes, copies of
+   * the texture compare it to know when they are stale.
+   */
+  [[nodiscard]] uint32_t GetVersion() const { return version_; }
+
   virtual void Bind(uint16_t slot = 0) const = 0;
 
   virtual bool operator==(const Texture& other) const = 0;
 
+  size_t GetMemoryUsage() const override;
+
   [[nodiscard]] static Ref<Texture> Create(const TextureMetadata& metadata,
                                            const void* pixels);
 
+  /**
+   * @brief Creates a texture from pre-generated @p levels, used for block
+   * compressed formats.
+   */
+  [[nodiscard]] static Ref<Texture> Create(
+      const TextureMetadata& metadata, std::span<const TextureLevelData> levels);
+
+  [[nodiscard]] static Ref<Texture> Create(const TextureImage& image);
+
   [[nodiscard]] static Ref<Texture> Create(
       const fs::path& path, const TextureType& type = TextureType::kDiffuse);
+
+ protected:
+  uint32_t version_ = 0;
 };
 
 }  // namespace eve
\ No newline at end of file
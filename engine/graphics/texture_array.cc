@@ -0,0 +1,25 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/texture_array.h"
+
+#include "graphics/graphics.h"
+#include "graphics/platforms/null/null_texture_array.h"
+#include "graphics/platforms/opengl/opengl_texture_array.h"
+
+namespace eve {
+Scope<TextureArray> TextureArray::Create(const TextureArrayMetadata& metadata,
+                                         uint32_t layer_count) {
+  switch (GetGraphicsAPI()) {
+    case GraphicsAPI::kOpenGL:
+      return CreateScope<OpenGLTextureArray>(metadata, layer_count);
+    case GraphicsAPI::kNull:
+      return CreateScope<NullTextureArray>(metadata, layer_count);
+    case GraphicsAPI::kVulkan:
+      EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
+      return nullptr;
+    default:
+      EVE_ASSERT_ENGINE(false, "Unknown graphics API");
+      return nullptr;
+  }
+}
+}  // namespace eve
@@ -0,0 +1,53 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "graphics/texture.h"
+
+namespace eve {
+
+/**
+ * @brief Every layer of an array shares the same size and sampling state,
+ * layers are stored as RGBA unless the array holds compressed textures.
+ */
+struct TextureArrayMetadata final {
+  glm::ivec2 size = {1, 1};
+  // compressed layers are copied block by block, so they are not converted
+  TextureFormat format = TextureFormat::kRGBA;
+  TextureFilteringMode min_filter = TextureFilteringMode::kLinear;
+  TextureFilteringMode mag_filter = TextureFilteringMode::kLinear;
+  TextureWrappingMode wrap_s = TextureWrappingMode::kRepeat;
+  TextureWrappingMode wrap_t = TextureWrappingMode::kRepeat;
+  bool generate_mipmaps = true;
+
+  bool operator==(const TextureArrayMetadata& other) const = default;
+};
+
+class TextureArray {
+ public:
+  virtual ~TextureArray() = default;
+
+  virtual const TextureArrayMetadata& GetMetadata() const = 0;
+
+  virtual uint32_t GetLayerCount() const = 0;
+
+  /**
+   * @brief Reallocates the storage keeping the contents of existing layers.
+   */
+  virtual void Resize(uint32_t layer_count) = 0;
+
+  /**
+   * @brief Copies @p texture into @p layer, scaling it to the array size.
+   * Compressed textures must already be of the array size with every level.
+   */
+  virtual void SetLayer(uint32_t layer, const Texture& texture) = 0;
+
+  virtual void Bind(uint16_t slot = 0) const = 0;
+
+  [[nodiscard]] static Scope<TextureArray> Create(
+      const TextureArrayMetadata& metadata, uint32_t layer_count);
+};
+
+}  // namespace eve
@@ -0,0 +1,418 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/texture_compression.h"
+
+namespace eve {
+
+static constexpr uint32_t kBlockPixelCount = 16;
+
+// interpolation weights of 4 bit bc7 indices, out of 64
+static constexpr int kBC7Weights[16] = {0,  4,  9,  13, 17, 21, 26, 30,
+                                        34, 38, 43, 47, 51, 55, 60, 64};
+
+[[nodiscard]] static uint16_t PackRGB565(const int* color) {
+  const int r = (color[0] * 31 + 127) / 255;
+  const int g = (color[1] * 63 + 127) / 255;
+  const int b = (color[2] * 31 + 127) / 255;
+  return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+static void UnpackRGB565(uint16_t packed, int* color) {
+  const int r = (packed >> 11) & 31;
+  const int g = (packed >> 5) & 63;
+  const int b = packed & 31;
+  color[0] = (r << 3) | (r >> 2);
+  color[1] = (g << 2) | (g >> 4);
+  color[2] = (b << 3) | (b >> 2);
+}
+
+[[nodiscard]] static int GetDistance(const uint8_t* pixel, const int* color,
+                                     int channel_count) {
+  int distance = 0;
+  for (int c = 0; c < channel_count; c++) {
+    const int difference = pixel[c] - color[c];
+    distance += difference * difference;
+  }
+  return distance;
+}
+
+/**
+ * @brief Bounding box corners do not lie on the line of channels changing
+ * in opposite directions, swaps @p min and @p max of channels which are
+ * negatively correlated with the one having the widest range.
+ */
+static void SelectDiagonal(const uint8_t* pixels, int channel_count, int* min,
+                           int* max) {
+  int axis = 0;
+  for (int c = 1; c < channel_count; c++) {
+    if (max[c] - min[c] > max[axis] - min[axis]) {
+      axis = c;
+    }
+  }
+
+  int mean[4] = {};
+  for (uint32_t i = 0; i < kBlockPixelCount; i++) {
+    for (int c = 0; c < channel_count; c++) {
+      mean[c] += pixels[i * 4 + c];
+    }
+  }
+  for (int c = 0; c < channel_count; c++) {
+    mean[c] /= static_cast<int>(kBlockPixelCount);
+  }
+
+  for (int c = 0; c < channel_count; c++) {
+    if (c == axis) {
+      continue;
+    }
+
+    int covariance = 0;
+    for (uint32_t i = 0; i < kBlockPixelCount; i++) {
+      covariance += (pixels[i * 4 + axis] - mean[axis]) *
+                    (pixels[i * 4 + c] - mean[c]);
+    }
+
+    if (covariance < 0) {
+      std::swap(min[c], max[c]);
+    }
+  }
+}
+
+/**
+ * @brief Writes values into a block starting from the least significant bit.
+ */
+class BlockWriter {
+ public:
+  BlockWriter(uint8_t* block, uint32_t size) : block_(block) {
+    std::fill_n(block_, size, 0);
+  }
+
+  void Write(uint32_t value, uint32_t bit_count) {
+    for (uint32_t i = 0; i < bit_count; i++, position_++) {
+      if (value & (1u << i)) {
+        block_[position_ / 8] |= 1u << (position_ % 8);
+      }
+    }
+  }
+
+ private:
+  uint8_t* block_;
+  uint32_t position_ = 0;
+};
+
+void CompressBlockBC1(const uint8_t* pixels, uint8_t* block) {
+  int min[3] = {255, 255, 255};
+  int max[3] = {0, 0, 0};
+  for (uint32_t i = 0; i < kBlockPixelCount; i++) {
+    for (int c = 0; c < 3; c++) {
+      min[c] = std::min<int>(min[c], pixels[i * 4 + c]);
+      max[c] = std::max<int>(max[c], pixels[i * 4 + c]);
+    }
+  }
+
+  // inset the bounding box so the endpoints are not spent on outliers
+  for (int c = 0; c < 3; c++) {
+    const int inset = (max[c] - min[c]) / 16;
+    min[c] += inset;
+    max[c] -= inset;
+  }
+
+  SelectDiagonal(pixels, 3, min, max);
+
+  uint16_t color0 = PackRGB565(max);
+  uint16_t color1 = PackRGB565(min);
+
+  // four color mode requires the first endpoint to be greater
+  if (color0 < color1) {
+    std::swap(color0, color1);
+  }
+
+  int palette[4][3];
+  UnpackRGB565(color0, palette[0]);
+  UnpackRGB565(color1, palette[1]);
+  for (int c = 0; c < 3; c++) {
+    palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+    palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+  }
+
+  uint32_t indices = 0;
+  if (color0 != color1) {
+    for (uint32_t i = 0; i < kBlockPixelCount; i++) {
+      uint32_t best_index = 0;
+      int best_distance = std::numeric_limits<int>::max();
+      for (uint32_t j = 0; j < 4; j++) {
+        const int distance = GetDistance(pixels + i * 4, palette[j], 3);
+        if (distance < best_distance) {
+          best_distance = distance;
+          best_index = j;
+        }
+      }
+      indices |= best_index << (i * 2);
+    }
+  }
+
+  block[0] = color0 & 0xff;
+  block[1] = color0 >> 8;
+  block[2] = color1 & 0xff;
+  block[3] = color1 >> 8;
+  for (uint32_t i = 0; i < 4; i++) {
+    block[4 + i] = (indices >> (i * 8)) & 0xff;
+  }
+}
+
+void CompressBlockBC3(const uint8_t* pixels, uint8_t* block) {
+  int min_alpha = 255;
+  int max_alpha = 0;
+  for (uint32_t i = 0; i < kBlockPixelCount; i++) {
+    min_alpha = std::min<int>(min_alpha, pixels[i * 4 + 3]);
+    max_alpha = std::max<int>(max_alpha, pixels[i * 4 + 3]);
+  }
+
+  // eight value mode, indices 2 to 7 are interpolated between the endpoints
+  int palette[8];
+  palette[0] = max_alpha;
+  palette[1] = min_alpha;
+  for (int i = 1; i < 7; i++) {
+    palette[i + 1] = ((7 - i) * max_alpha + i * min_alpha) / 7;
+  }
+
+  BlockWriter writer(block, 8);
+  writer.Write(max_alpha, 8);
+  writer.Write(min_alpha, 8);
+
+  for (uint32_t i = 0; i < kBlockPixelCount; i++) {
+    uint32_t best_index = 0;
+    if (max_alpha != min_alpha) {
+      int best_distance = std::numeric_limits<int>::max();
+      for (uint32_t j = 0; j < 8; j++) {
+        const int distance = std::abs(pixels[i * 4 + 3] - palette[j]);
+        if (distance < best_distance) {
+          best_distance = distance;
+          best_index = j;
+        }
+      }
+    }
+    writer.Write(best_index, 3);
+  }
+
+  CompressBlockBC1(pixels, block + 8);
+}
+
+void CompressBlockBC7(const uint8_t* pixels, uint8_t* block) {
+  int min[4] = {255, 255, 255, 255};
+  int max[4] = {0, 0, 0, 0};
+  for (uint32_t i = 0; i < kBlockPixelCount; i++) {
+    for (int c = 0; c < 4; c++) {
+      min[c] = std::min<int>(min[c], pixels[i * 4 + c]);
+      max[c] = std::max<int>(max[c], pixels[i * 4 + c]);
+    }
+  }
+
+  SelectDiagonal(pixels, 4, min, max);
+
+  // endpoints are 7 bits per channel with a shared least significant bit,
+  // pick the bit giving the smallest error
+  const auto quantize = [](const int* color, int* quantized, int& p_bit) {
+    int best_error = std::numeric_limits<int>::max();
+    for (int p = 0; p < 2; p++) {
+      int error = 0;
+      int candidate[4];
+      for (int c = 0; c < 4; c++) {
+        candidate[c] = std::clamp((color[c] - p + 1) / 2, 0, 127);
+        error += std::abs(((candidate[c] << 1) | p) - color[c]);
+      }
+
+      if (error < best_error) {
+        best_error = error;
+        p_bit = p;
+        std::copy_n(candidate, 4, quantized);
+      }
+    }
+  };
+
+  int endpoints[2][4];
+  int p_bits[2];
+  quantize(min, endpoints[0], p_bits[0]);
+  quantize(max, endpoints[1], p_bits[1]);
+
+  int expanded[2][4];
+  for (int e = 0; e < 2; e++) {
+    for (int c = 0; c < 4; c++) {
+      expanded[e][c] = (endpoints[e][c] << 1) | p_bits[e];
+    }
+  }
+
+  int palette[16][4];
+  for (int i = 0; i < 16; i++) {
+    for (int c = 0; c < 4; c++) {
+      palette[i][c] = ((64 - kBC7Weights[i]) * expanded[0][c] +
+                       kBC7Weights[i] * expanded[1][c] + 32) >>
+                      6;
+    }
+  }
+
+  uint32_t indices[kBlockPixelCount];
+  for (uint32_t i = 0; i < kBlockPixelCount; i++) {
+    uint32_t best_index = 0;
+    int best_distance = std::numeric_limits<int>::max();
+    for (uint32_t j = 0; j < 16; j++) {
+      const int distance = GetDistance(pixels + i * 4, palette[j], 4);
+      if (distance < best_distance) {
+        best_distance = distance;
+        best_index = j;
+      }
+    }
+    indices[i] = best_index;
+  }
+
+  // the most significant bit of the first index is implicitly zero, swap
+  // the endpoints to make it so as the weights are symmetric
+  if (indices[0] >= 8) {
+    std::swap(endpoints[0], endpoints[1]);
+    std::swap(p_bits[0], p_bits[1]);
+    for (uint32_t& index : indices) {
+      index = 15 - index;
+    }
+  }
+
+  BlockWriter writer(block, 16);
+  writer.Write(1 << 6, 7);
+  for (int c = 0; c < 4; c++) {
+    writer.Write(endpoints[0][c], 7);
+    writer.Write(endpoints[1][c], 7);
+  }
+  writer.Write(p_bits[0], 1);
+  writer.Write(p_bits[1], 1);
+
+  writer.Write(indices[0], 3);
+  for (uint32_t i = 1; i < kBlockPixelCount; i++) {
+    writer.Write(indices[i], 4);
+  }
+}
+
+std::vector<uint8_t> CompressImage(const uint8_t* pixels,
+                                   const glm::ivec2& size,
+                                   TextureFormat format) {
+  EVE_ASSERT_ENGINE(IsCompressedTextureFormat(format));
+
+  const uint64_t block_size = format == TextureFormat::kBC1 ? 8 : 16;
+  const int block_count_x = (size.x + kTextureBlockSize - 1) / kTextureBlockSize;
+  const int block_count_y = (size.y + kTextureBlockSize - 1) / kTextureBlockSize;
+
+  std::vector<uint8_t> blocks(GetTextureLevelSize(format, size));
+
+  uint8_t block_pixels[kBlockPixelCount * 4];
+  for (int block_y = 0; block_y < block_count_y; block_y++) {
+    for (int block_x = 0; block_x < block_count_x; block_x++) {
+      for (int y = 0; y < kTextureBlockSize; y++) {
+        for (int x = 0; x < kTextureBlockSize; x++) {
+          const int pixel_x =
+              std::min(block_x * kTextureBlockSize + x, size.x - 1);
+          const int pixel_y =
+              std::min(block_y * kTextureBlockSize + y, size.y - 1);
+
+          std::copy_n(pixels + (pixel_y * size.x + pixel_x) * 4, 4,
+                      block_pixels + (y * kTextureBlockSize + x) * 4);
+        }
+      }
+
+      uint8_t* block =
+          blocks.data() + (block_y * block_count_x + block_x) * block_size;
+
+      switch (format) {
+        case TextureFormat::kBC1:
+          CompressBlockBC1(block_pixels, block);
+          break;
+        case TextureFormat::kBC3:
+          CompressBlockBC3(block_pixels, block);
+          break;
+        default:
+          CompressBlockBC7(block_pixels, block);
+          break;
+      }
+    }
+  }
+
+  return blocks;
+}
+
+TextureFormat ChooseCompressedFormat(const uint8_t* pixels,
+                                     const glm::ivec2& size) {
+  const uint64_t pixel_count = static_cast<uint64_t>(size.x) * size.y;
+  for (uint64_t i = 0; i < pixel_count; i++) {
+    if (pixels[i * 4 + 3] != 255) {
+      return TextureFormat::kBC7;
+    }
+  }
+  return TextureFormat::kBC1;
+}
+
+std::vector<uint8_t> GenerateMipLevel(const uint8_t* pixels,
+                                      const glm::ivec2& size) {
+  const glm::ivec2 level_size = glm::max(size / 2, 1);
+
+  std::vector<uint8_t> level(static_cast<size_t>(level_size.x) *
+                             level_size.y * 4);
+
+  for (int y = 0; y < level_size.y; y++) {
+    const int y0 = std::min(y * 2, size.y - 1);
+    const int y1 = std::min(y * 2 + 1, size.y - 1);
+
+    for (int x = 0; x < level_size.x; x++) {
+      const int x0 = std::min(x * 2, size.x - 1);
+      const int x1 = std::min(x * 2 + 1, size.x - 1);
+
+      for (int c = 0; c < 4; c++) {
+        const int sum = pixels[(y0 * size.x + x0) * 4 + c] +
+                        pixels[(y0 * size.x + x1) * 4 + c] +
+                        pixels[(y1 * size.x + x0) * 4 + c] +
+                        pixels[(y1 * size.x + x1) * 4 + c];
+        level[(y * level_size.x + x) * 4 + c] =
+            static_cast<uint8_t>((sum + 2) / 4);
+      }
+    }
+  }
+
+  return level;
+}
+
+std::vector<uint8_t> ResizeImage(const uint8_t* pixels,
+                                 const glm::ivec2& size,
+                                 const glm::ivec2& new_size) {
+  std::vector<uint8_t> resized(static_cast<size_t>(new_size.x) * new_size.y *
+                               4);
+
+  const float scale_x = static_cast<float>(size.x) / new_size.x;
+  const float scale_y = static_cast<float>(size.y) / new_size.y;
+
+  for (int y = 0; y < new_size.y; y++) {
+    const float source_y =
+        std::clamp((y + 0.5f) * scale_y - 0.5f, 0.0f, size.y - 1.0f);
+    const int y0 = static_cast<int>(source_y);
+    const int y1 = std::min(y0 + 1, size.y - 1);
+    const float ty = source_y - y0;
+
+    for (int x = 0; x < new_size.x; x++) {
+      const float source_x =
+          std::clamp((x + 0.5f) * scale_x - 0.5f, 0.0f, size.x - 1.0f);
+      const int x0 = static_cast<int>(source_x);
+      const int x1 = std::min(x0 + 1, size.x - 1);
+      const float tx = source_x - x0;
+
+      for (int c = 0; c < 4; c++) {
+        const float top = std::lerp(
+            static_cast<float>(pixels[(y0 * size.x + x0) * 4 + c]),
+            static_cast<float>(pixels[(y0 * size.x + x1) * 4 + c]), tx);
+        const float bottom = std::lerp(
+            static_cast<float>(pixels[(y1 * size.x + x0) * 4 + c]),
+            static_cast<float>(pixels[(y1 * size.x + x1) * 4 + c]), tx);
+
+        resized[(y * new_size.x + x) * 4 + c] =
+            static_cast<uint8_t>(std::lerp(top, bottom, ty) + 0.5f);
+      }
+    }
+  }
+
+  return resized;
+}
+
+}  // namespace eve
@@ -0,0 +1,58 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "graphics/texture.h"
+
+namespace eve {
+
+constexpr int kTextureBlockSize = 4;
+
+/**
+ * @brief Encodes a 4x4 block of RGBA8 pixels into 8 bytes, alpha is
+ * ignored.
+ */
+void CompressBlockBC1(const uint8_t* pixels, uint8_t* block);
+
+/**
+ * @brief Encodes a 4x4 block of RGBA8 pixels into 16 bytes, interpolated
+ * alpha followed by a BC1 color block.
+ */
+void CompressBlockBC3(const uint8_t* pixels, uint8_t* block);
+
+/**
+ * @brief Encodes a 4x4 block of RGBA8 pixels into 16 bytes using mode 6,
+ * a single RGBA line with 4 bit indices.
+ */
+void CompressBlockBC7(const uint8_t* pixels, uint8_t* block);
+
+/**
+ * @brief Encodes an RGBA8 image into blocks of @p format, pixels of partial
+ * blocks at the edges are clamped.
+ */
+[[nodiscard]] std::vector<uint8_t> CompressImage(const uint8_t* pixels,
+                                                 const glm::ivec2& size,
+                                                 TextureFormat format);
+
+/**
+ * @brief BC1 for opaque images, BC7 otherwise.
+ */
+[[nodiscard]] TextureFormat ChooseCompressedFormat(const uint8_t* pixels,
+                                                   const glm::ivec2& size);
+
+/**
+ * @brief Box filters an RGBA8 image into its next mip level.
+ */
+[[nodiscard]] std::vector<uint8_t> GenerateMipLevel(const uint8_t* pixels,
+                                                    const glm::ivec2& size);
+
+/**
+ * @brief Bilinearly resamples an RGBA8 image to @p new_size.
+ */
+[[nodiscard]] std::vector<uint8_t> ResizeImage(const uint8_t* pixels,
+                                               const glm::ivec2& size,
+                                               const glm::ivec2& new_size);
+
+}  // namespace eve
@@ -0,0 +1,273 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "graphics/texture_residency.h"
+
+namespace eve {
+
+[[nodiscard]] static int GetBucketSize(int size) {
+  int bucket_size = 1;
+  while (bucket_size < size && bucket_size < kMaxTextureArraySize) {
+    bucket_size <<= 1;
+  }
+  return bucket_size;
+}
+
+[[nodiscard]] static uint64_t GetLayerSize(
+    const TextureArrayMetadata& metadata) {
+  glm::ivec2 size = metadata.size;
+  uint64_t layer_size = GetTextureLevelSize(metadata.format, size);
+
+  while (metadata.generate_mipmaps && (size.x > 1 || size.y > 1)) {
+    size = glm::max(size / 2, glm::ivec2(1));
+    layer_size += GetTextureLevelSize(metadata.format, size);
+  }
+
+  return layer_size;
+}
+
+[[nodiscard]] static bool IsSameTexture(const std::weak_ptr<Texture>& lhs,
+                                        const Ref<Texture>& rhs) {
+  return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+}
+
+TextureResidency::TextureResidency() {
+  // Create default 1x1 white texture
+  TextureMetadata metadata;
+  metadata.size = {1, 1};
+  metadata.format = TextureFormat::kRGBA;
+  metadata.min_filter = TextureFilteringMode::kLinear;
+  metadata.mag_filter = TextureFilteringMode::kLinear;
+  metadata.wrap_s = TextureWrappingMode::kClampToEdge;
+  metadata.wrap_t = TextureWrappingMode::kClampToEdge;
+  metadata.generate_mipmaps = false;
+
+  uint32_t color = 0xffffffff;
+  white_texture_ = Texture::Create(metadata, &color);
+
+  white_index_ = GetIndex(white_texture_).value();
+}
+
+std::optional<TextureIndex> TextureResidency::GetIndex(
+    const Ref<Texture>& texture) {
+  if (!texture) {
+    return white_index_;
+  }
+
+  const auto it = entries_.find(texture.get());
+  if (it != entries_.end()) {
+    Entry& entry = it->second;
+    if (IsSameTexture(entry.texture, texture)) {
+      // data of the texture changed since it was copied
+      if (entry.index && entry.version != texture->GetVersion()) {
+        arrays_[*entry.index / kMaxTextureArrayLayers].array->SetLayer(
+            *entry.index % kMaxTextureArrayLayers, *texture);
+        entry.version = texture->GetVersion();
+      }
+
+      return entry.index;
+    }
+
+    // address of a destroyed texture is reused
+    CollectGarbage();
+  }
+
+  const TextureArrayMetadata metadata =
+      GetArrayMetadata(texture->GetMetadata());
+
+  // compressed textures could not be scaled, they are cooked at the size of
+  // their array
+  if (IsCompressedTextureFormat(metadata.format) &&
+      texture->GetMetadata().size != metadata.size) {
+    EVE_LOG_ENGINE_WARNING(
+        "Compressed texture without a power of two size is bound to a "
+        "slot.");
+    entries_[texture.get()] = {texture, std::nullopt, texture->GetVersion()};
+    return std::nullopt;
+  }
+
+  const std::optional<TextureIndex> index = AllocateLayer(metadata);
+  if (!index) {
+    EVE_LOG_ENGINE_WARNING(
+        "Texture arrays are full, texture of size {}x{} is bound to a slot.",
+        metadata.size.x, metadata.size.y);
+    entries_[texture.get()] = {texture, std::nullopt, texture->GetVersion()};
+    return std::nullopt;
+  }
+
+  const uint32_t array_index = *index / kMaxTextureArrayLayers;
+  const uint32_t layer = *index % kMaxTextureArrayLayers;
+  arrays_[array_index].array->SetLayer(layer, *texture);
+
+  entries_[texture.get()] = {texture, *index, texture->GetVersion()};
+
+  return *index;
+}
+
+void TextureResidency::Bind() const {
+  for (uint32_t i = 0; i < arrays_.size(); i++) {
+    arrays_[i].array->Bind(i);
+  }
+}
+
+void TextureResidency::SetSamplers(const Shader& shader) {
+  shader.Bind();
+
+  int samplers[kMaxTextureArrays + kMaxTextureSlots];
+  std::iota(std::begin(samplers), std::end(samplers), 0);
+
+  shader.SetUniform("u_texture_arrays", kMaxTextureArrays, samplers);
+  shader.SetUniform("u_texture_slots", kMaxTextureSlots,
+                    samplers + kMaxTextureArrays);
+}
+
+void TextureResidency::CollectGarbage() {
+  std::erase_if(entries_, [this](const auto& pair) {
+    const Entry& entry = pair.second;
+    if (!entry.texture.expired()) {
+      return false;
+    }
+
+    if (entry.index) {
+      ArrayEntry& array = arrays_[*entry.index / kMaxTextureArrayLayers];
+      array.free_layers.push_back(*entry.index % kMaxTextureArrayLayers);
+    }
+
+    return true;
+  });
+}
+
+uint32_t TextureResidency::GetResidentCount() const {
+  return std::count_if(entries_.begin(), entries_.end(),
+                       [](const auto& pair) { return pair.second.index; });
+}
+
+TextureArrayMetadata TextureResidency::GetArrayMetadata(
+    const TextureMetadata& metadata) {
+  TextureArrayMetadata array_metadata;
+  array_metadata.size = {GetBucketSize(metadata.size.x),
+                         GetBucketSize(metadata.size.y)};
+  array_metadata.min_filter = metadata.min_filter;
+  array_metadata.mag_filter = metadata.mag_filter;
+  array_metadata.wrap_s = metadata.wrap_s;
+  array_metadata.wrap_t = metadata.wrap_t;
+
+  if (IsCompressedTextureFormat(metadata.format)) {
+    array_metadata.format = metadata.format;
+    array_metadata.generate_mipmaps = metadata.mip_count > 1;
+  } else {
+    array_metadata.generate_mipmaps = metadata.generate_mipmaps;
+  }
+
+  return array_metadata;
+}
+
+std::optional<TextureIndex> TextureResidency::AllocateLayer(
+    const TextureArrayMetadata& metadata) {
+  if (auto index = TryAllocateLayer(metadata, false)) {
+    return index;
+  }
+
+  // reuse the layers of destroyed textures before growing
+  CollectGarbage();
+
+  if (auto index = TryAllocateLayer(metadata, false)) {
+    return index;
+  }
+
+  if (auto index = TryAllocateLayer(metadata, true)) {
+    return index;
+  }
+
+  if (arrays_.size() >= kMaxTextureArrays) {
+    return std::nullopt;
+  }
+
+  // large arrays start smaller so they still fit into the budget
+  const uint32_t layer_count = std::min(kTextureArrayInitialLayerCount,
+                                        GetAffordableLayerCount(metadata));
+  if (layer_count == 0) {
+    return std::nullopt;
+  }
+
+  ArrayEntry& array = arrays_.emplace_back();
+  array.array = TextureArray::Create(metadata, layer_count);
+  array.used_layer_count = 1;
+
+  memory_usage_ += layer_count * GetLayerSize(metadata);
+
+  return (arrays_.size() - 1) * kMaxTextureArrayLayers;
+}
+
+std::optional<TextureIndex> TextureResidency::TryAllocateLayer(
+    const TextureArrayMetadata& metadata, bool allow_grow) {
+  for (uint32_t i = 0; i < arrays_.size(); i++) {
+    ArrayEntry& array = arrays_[i];
+    if (array.array->GetMetadata() != metadata) {
+      continue;
+    }
+
+    if (!array.free_layers.empty()) {
+      const uint32_t layer = array.free_layers.back();
+      array.free_layers.pop_back();
+      return i * kMaxTextureArrayLayers + layer;
+    }
+
+    const uint32_t layer_count = array.array->GetLayerCount();
+    if (array.used_layer_count < layer_count) {
+      return i * kMaxTextureArrayLayers + array.used_layer_count++;
+    }
+
+    const uint32_t added_layer_count =
+        std::min({layer_count, kMaxTextureArrayLayers - layer_count,
+                  GetAffordableLayerCount(metadata)});
+    if (allow_grow && added_layer_count > 0) {
+      array.array->Resize(layer_count + added_layer_count);
+      memory_usage_ += added_layer_count * GetLayerSize(metadata);
+      return i * kMaxTextureArrayLayers + array.used_layer_count++;
+    }
+  }
+
+  return std::nullopt;
+}
+
+uint32_t TextureResidency::GetAffordableLayerCount(
+    const TextureArrayMetadata& metadata) const {
+  if (memory_usage_ >= kTextureArrayMemoryBudget) {
+    return 0;
+  }
+
+  return std::min<uint64_t>(
+      (kTextureArrayMemoryBudget - memory_usage_) / GetLayerSize(metadata),
+      kMaxTextureArrayLayers);
+}
+
+std::optional<TextureIndex> TextureSlots::Find(const Ref<Texture>& texture) {
+  for (uint32_t i = 0; i < slot_count_; i++) {
+    if (textures_[i] == texture) {
+      return kTextureSlotIndexBase + i;
+    }
+  }
+
+  if (IsFull()) {
+    return std::nullopt;
+  }
+
+  textures_[slot_count_] = texture;
+  return kTextureSlotIndexBase + slot_count_++;
+}
+
+void TextureSlots::Bind() const {
+  for (uint32_t i = 0; i < slot_count_; i++) {
+    textures_[i]->Bind(kMaxTextureArrays + i);
+  }
+}
+
+void TextureSlots::Reset() {
+  // release the textures so they could be destroyed
+  for (uint32_t i = 0; i < slot_count_; i++) {
+    textures_[i] = nullptr;
+  }
+  slot_count_ = 0;
+}
+
+}  // namespace eve
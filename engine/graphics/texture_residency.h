@@ -0,0 +1,162 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "graphics/shader.h"
+#include "graphics/texture.h"
+#include "graphics/texture_array.h"
+
+namespace eve {
+
+// must match texture_arrays.glsl
+constexpr uint32_t kMaxTextureArrays = 24;
+constexpr uint32_t kMaxTextureArrayLayers = 256;
+constexpr uint32_t kMaxTextureSlots = 8;
+
+constexpr uint32_t kTextureArrayInitialLayerCount = 4;
+constexpr int kMaxTextureArraySize = 4096;
+
+// upper bound of the memory taken by layers, on top of the textures
+constexpr uint64_t kTextureArrayMemoryBudget = 256ull * 1024 * 1024;
+
+/**
+ * @brief Packed as `array * kMaxTextureArrayLayers + layer`, textures bound
+ * to slots come after every layer as `kTextureSlotIndexBase + slot`.
+ */
+typedef uint32_t TextureIndex;
+
+constexpr TextureIndex kTextureSlotIndexBase =
+    kMaxTextureArrays * kMaxTextureArrayLayers;
+
+/**
+ * @brief Copies textures into layers of texture arrays shared by every
+ * batch. Each texture gets a stable index on first use so batches do not
+ * have to be broken once texture slots are filled.
+ *
+ * Textures are grouped by their sampling state and scaled to the next power
+ * of two of their size, compressed textures are cooked at that size and
+ * grouped by their format as well.
+ *
+ * Layers are copies, the textures themselves stay alive for their other
+ * users. A resident texture costs its own memory plus a layer which could
+ * be up to four times larger because of the padding, and uncompressed
+ * layers are always stored as RGBA. Layers are kept within
+ * kTextureArrayMemoryBudget, textures which do not fit into it or into
+ * kMaxTextureArrays are bound to TextureSlots instead.
+ */
+class TextureResidency {
+ public:
+  TextureResidency();
+
+  TextureResidency(const TextureResidency&) = delete;
+  TextureResidency& operator=(const TextureResidency&) = delete;
+
+  /**
+   * @brief Returns the index of @p texture, making it resident if it is
+   * seen for the first time. Null textures map to a white texture.
+   *
+   * @return std::nullopt If the texture could not be made resident, it
+   * should be bound to a slot instead.
+   */
+  [[nodiscard]] std::optional<TextureIndex> GetIndex(
+      const Ref<Texture>& texture);
+
+  [[nodiscard]] TextureIndex GetWhiteIndex() const { return white_index_; }
+
+  /**
+   * @brief Binds every array to the slot matching its index.
+   */
+  void Bind() const;
+
+  /**
+   * @brief Points the samplers of @p shader declared in texture_arrays.glsl
+   * to the units arrays and slots are bound to.
+   */
+  static void SetSamplers(const Shader& shader);
+
+  /**
+   * @brief Frees the layers of textures which are destroyed, called
+   * automatically before the arrays grow.
+   */
+  void CollectGarbage();
+
+  [[nodiscard]] uint32_t GetArrayCount() const { return arrays_.size(); }
+
+  [[nodiscard]] uint32_t GetResidentCount() const;
+
+  /**
+   * @brief Memory allocated for the layers of every array in bytes.
+   */
+  [[nodiscard]] uint64_t GetMemoryUsage() const { return memory_usage_; }
+
+  [[nodiscard]] static TextureArrayMetadata GetArrayMetadata(
+      const TextureMetadata& metadata);
+
+ private:
+  [[nodiscard]] std::optional<TextureIndex> AllocateLayer(
+      const TextureArrayMetadata& metadata);
+
+  [[nodiscard]] std::optional<TextureIndex> TryAllocateLayer(
+      const TextureArrayMetadata& metadata, bool allow_grow);
+
+  // number of layers which could be added without exceeding the budget
+  [[nodiscard]] uint32_t GetAffordableLayerCount(
+      const TextureArrayMetadata& metadata) const;
+
+ private:
+  struct Entry final {
+    // used to detect destroyed textures and reused addresses
+    std::weak_ptr<Texture> texture;
+    // not set for textures which did not fit, they are not tried again
+    std::optional<TextureIndex> index;
+    // version of the texture when it was copied into its layer
+    uint32_t version;
+  };
+
+  struct ArrayEntry final {
+    Scope<TextureArray> array;
+    uint32_t used_layer_count = 0;
+    std::vector<uint32_t> free_layers;
+  };
+
+  std::unordered_map<const Texture*, Entry> entries_;
+  std::vector<ArrayEntry> arrays_;
+
+  uint64_t memory_usage_ = 0;
+
+  Ref<Texture> white_texture_;
+  TextureIndex white_index_ = 0;
+};
+
+/**
+ * @brief Binds the textures which are not resident to the slots after the
+ * texture arrays. Slots are only valid for a single batch, so batches
+ * should be flushed once they are full.
+ */
+class TextureSlots {
+ public:
+  /**
+   * @brief Returns the index of the slot @p texture is bound to, taking a
+   * new one if it is not bound yet.
+   *
+   * @return std::nullopt If every slot is taken.
+   */
+  [[nodiscard]] std::optional<TextureIndex> Find(const Ref<Texture>& texture);
+
+  [[nodiscard]] bool IsFull() const { return slot_count_ >= kMaxTextureSlots; }
+
+  /**
+   * @brief Binds every slot to the unit after the texture arrays.
+   */
+  void Bind() const;
+
+  void Reset();
+
+ private:
+  std::array<Ref<Texture>, kMaxTextureSlots> textures_;
+  uint32_t slot_count_ = 0;
+};
+
+}  // namespace eve
@@ -3,6 +3,7 @@
 #include "graphics/uniform_buffer.h"
 
 #include "graphics/graphics.h"
+#include "graphics/platforms/null/null_uniform_buffer.h"
 #include "graphics/platforms/opengl/opengl_uniform_buffer.h"
 
 namespace eve {
@@ -10,6 +11,8 @@ Ref<UniformBuffer> UniformBuffer::Create(uint32_t size, uint32_t binding) {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLUniformBuffer>(size, binding);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullUniformBuffer>(size, binding);
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -3,6 +3,7 @@
 #include "graphics/vertex_array.h"
 
 #include "graphics/graphics.h"
+#include "graphics/platforms/null/null_vertex_array.h"
 #include "graphics/platforms/opengl/opengl_vertex_array.h"
 
 namespace eve {
@@ -11,6 +12,8 @@ Ref<VertexArray> VertexArray::Create() {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLVertexArray>();
+    case GraphicsAPI::kNull:
+      return CreateRef<NullVertexArray>();
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -3,13 +3,17 @@
 #include "graphics/vertex_buffer.h"
 
 #include "graphics/graphics.h"
+#include "graphics/platforms/null/null_vertex_buffer.h"
 #include "graphics/platforms/opengl/opengl_vertex_buffer.h"
 
 namespace eve {
-Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
+Ref<VertexBuffer> VertexBuffer::Create(uint32_t size,
+                                       VertexBufferUsage usage) {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
-      return CreateRef<OpenGLVertexBuffer>(size);
+      return CreateRef<OpenGLVertexBuffer>(size, usage);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullVertexBuffer>(size, usage);
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
@@ -23,6 +27,8 @@ Ref<VertexBuffer> VertexBuffer::Create(const void* vertices, uint32_t size) {
   switch (GetGraphicsAPI()) {
     case GraphicsAPI::kOpenGL:
       return CreateRef<OpenGLVertexBuffer>(vertices, size);
+    case GraphicsAPI::kNull:
+      return CreateRef<NullVertexBuffer>(vertices, size);
     case GraphicsAPI::kVulkan:
       EVE_ASSERT_ENGINE(false, "Vulkan not supported yet!");
       return nullptr;
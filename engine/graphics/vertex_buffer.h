@@ -7,6 +7,13 @@
 #include "graphics/buffer_layout.h"
 
 namespace eve {
+enum class VertexBufferUsage {
+  // updated with SetData
+  kDynamic,
+  // written directly through GetMappedData, synchronization is up to the user
+  kPersistentMapped,
+};
+
 class VertexBuffer {
  public:
   virtual void Bind() = 0;
@@ -14,10 +21,17 @@ class VertexBuffer {
 
   virtual void SetData(const void* data, uint32_t size) = 0;
 
+  /**
+   * @brief Writable pointer to the buffer memory if it was created
+   * persistently mapped, nullptr otherwise.
+   */
+  virtual void* GetMappedData() = 0;
+
   virtual const BufferLayout& GetLayout() = 0;
   virtual void SetLayout(const BufferLayout& layout) = 0;
 
-  [[nodiscard]] static Ref<VertexBuffer> Create(uint32_t size);
+  [[nodiscard]] static Ref<VertexBuffer> Create(
+      uint32_t size, VertexBufferUsage usage = VertexBufferUsage::kDynamic);
 
   [[nodiscard]] static Ref<VertexBuffer> Create(const void* vertices,
                                                 uint32_t size);
@@ -0,0 +1,237 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "physics/aabb_tree.h"
+
+namespace eve {
+
+AABBTree::AABBTree(float margin) : margin_(margin) {}
+
+void AABBTree::Clear() {
+  nodes_.clear();
+  leaves_.clear();
+  root_ = kNullNode;
+  free_list_ = kNullNode;
+}
+
+void AABBTree::Insert(entt::entity entity, const AABB& bounds) {
+  EVE_ASSERT_ENGINE(leaves_.find(entity) == leaves_.end(),
+                    "Entity already exists in the tree!");
+
+  const int32_t leaf = AllocateNode();
+  nodes_[leaf].bounds = {bounds.min - glm::vec3(margin_),
+                         bounds.max + glm::vec3(margin_)};
+  nodes_[leaf].entity = entity;
+
+  InsertLeaf(leaf);
+
+  leaves_[entity] = leaf;
+}
+
+void AABBTree::Remove(entt::entity entity) {
+  const auto it = leaves_.find(entity);
+  if (it == leaves_.end()) {
+    return;
+  }
+
+  RemoveLeaf(it->second);
+  FreeNode(it->second);
+
+  leaves_.erase(it);
+}
+
+void AABBTree::Update(entt::entity entity, const AABB& bounds) {
+  const auto it = leaves_.find(entity);
+  if (it == leaves_.end()) {
+    Insert(entity, bounds);
+    return;
+  }
+
+  const int32_t leaf = it->second;
+
+  // fat bounds still cover the collider
+  if (nodes_[leaf].bounds.Contains(bounds)) {
+    return;
+  }
+
+  RemoveLeaf(leaf);
+
+  nodes_[leaf].bounds = {bounds.min - glm::vec3(margin_),
+                         bounds.max + glm::vec3(margin_)};
+
+  InsertLeaf(leaf);
+}
+
+void AABBTree::Query(const AABB& bounds,
+                     std::vector<entt::entity>& out) const {
+  if (root_ == kNullNode) {
+    return;
+  }
+
+  stack_.clear();
+  stack_.push_back(root_);
+
+  while (!stack_.empty()) {
+    const Node& node = nodes_[stack_.back()];
+    stack_.pop_back();
+
+    if (!node.bounds.Overlaps(bounds)) {
+      continue;
+    }
+
+    if (node.IsLeaf()) {
+      out.push_back(node.entity);
+    } else {
+      stack_.push_back(node.left);
+      stack_.push_back(node.right);
+    }
+  }
+}
+
+uint32_t AABBTree::GetHeight() const {
+  return GetHeight(root_);
+}
+
+int32_t AABBTree::AllocateNode() {
+  if (free_list_ == kNullNode) {
+    nodes_.emplace_back();
+    return nodes_.size() - 1;
+  }
+
+  const int32_t index = free_list_;
+  // parent member is used as the next pointer of the free list
+  free_list_ = nodes_[index].parent;
+  nodes_[index] = Node{};
+
+  return index;
+}
+
+void AABBTree::FreeNode(int32_t index) {
+  nodes_[index].parent = free_list_;
+  nodes_[index].left = kNullNode;
+  nodes_[index].right = kNullNode;
+  nodes_[index].entity = entt::null;
+  free_list_ = index;
+}
+
+void AABBTree::InsertLeaf(int32_t leaf) {
+  if (root_ == kNullNode) {
+    root_ = leaf;
+    nodes_[root_].parent = kNullNode;
+    return;
+  }
+
+  // Find the best sibling using the surface area heuristic
+  const AABB leaf_bounds = nodes_[leaf].bounds;
+
+  int32_t index = root_;
+  while (!nodes_[index].IsLeaf()) {
+    const Node& node = nodes_[index];
+
+    const float area = node.bounds.GetSurfaceArea();
+    const float combined_area =
+        AABB::Merge(node.bounds, leaf_bounds).GetSurfaceArea();
+
+    // cost of creating a new parent for this node and the leaf
+    const float cost = 2.0f * combined_area;
+
+    // minimum cost of pushing the leaf further down the tree
+    const float inheritance_cost = 2.0f * (combined_area - area);
+
+    const auto get_child_cost = [&](int32_t child) {
+      const AABB merged = AABB::Merge(nodes_[child].bounds, leaf_bounds);
+      if (nodes_[child].IsLeaf()) {
+        return merged.GetSurfaceArea() + inheritance_cost;
+      }
+
+      return merged.GetSurfaceArea() - nodes_[child].bounds.GetSurfaceArea() +
+             inheritance_cost;
+    };
+
+    const float left_cost = get_child_cost(node.left);
+    const float right_cost = get_child_cost(node.right);
+
+    if (cost < left_cost && cost < right_cost) {
+      break;
+    }
+
+    index = left_cost < right_cost ? node.left : node.right;
+  }
+
+  const int32_t sibling = index;
+
+  // Create a new parent
+  const int32_t old_parent = nodes_[sibling].parent;
+  const int32_t new_parent = AllocateNode();
+
+  nodes_[new_parent].parent = old_parent;
+  nodes_[new_parent].bounds = AABB::Merge(leaf_bounds, nodes_[sibling].bounds);
+  nodes_[new_parent].left = sibling;
+  nodes_[new_parent].right = leaf;
+
+  nodes_[sibling].parent = new_parent;
+  nodes_[leaf].parent = new_parent;
+
+  if (old_parent == kNullNode) {
+    root_ = new_parent;
+  } else if (nodes_[old_parent].left == sibling) {
+    nodes_[old_parent].left = new_parent;
+  } else {
+    nodes_[old_parent].right = new_parent;
+  }
+
+  Refit(old_parent);
+}
+
+void AABBTree::RemoveLeaf(int32_t leaf) {
+  if (leaf == root_) {
+    root_ = kNullNode;
+    return;
+  }
+
+  const int32_t parent = nodes_[leaf].parent;
+  const int32_t grand_parent = nodes_[parent].parent;
+  const int32_t sibling = nodes_[parent].left == leaf ? nodes_[parent].right
+                                                      : nodes_[parent].left;
+
+  // Replace the parent with the sibling
+  if (grand_parent == kNullNode) {
+    root_ = sibling;
+    nodes_[sibling].parent = kNullNode;
+  } else {
+    if (nodes_[grand_parent].left == parent) {
+      nodes_[grand_parent].left = sibling;
+    } else {
+      nodes_[grand_parent].right = sibling;
+    }
+    nodes_[sibling].parent = grand_parent;
+
+    Refit(grand_parent);
+  }
+
+  FreeNode(parent);
+}
+
+void AABBTree::Refit(int32_t index) {
+  while (index != kNullNode) {
+    Node& node = nodes_[index];
+    node.bounds =
+        AABB::Merge(nodes_[node.left].bounds, nodes_[node.right].bounds);
+
+    index = node.parent;
+  }
+}
+
+uint32_t AABBTree::GetHeight(int32_t index) const {
+  if (index == kNullNode) {
+    return 0;
+  }
+
+  const Node& node = nodes_[index];
+  if (node.IsLeaf()) {
+    return 1;
+  }
+
+  return 1 + std::max(GetHeight(node.left), GetHeight(node.right));
+}
+
+}  // namespace eve
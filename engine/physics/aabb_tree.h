@@ -0,0 +1,67 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "physics/broad_phase.h"
+
+namespace eve {
+
+/**
+ * @brief Dynamic bounding volume hierarchy, leaves are stored with a margin
+ * so small movements do not require reinsertion.
+ */
+class AABBTree final : public BroadPhase {
+ public:
+  AABBTree(float margin = 0.1f);
+
+  void Clear() override;
+
+  void Insert(entt::entity entity, const AABB& bounds) override;
+
+  void Remove(entt::entity entity) override;
+
+  void Update(entt::entity entity, const AABB& bounds) override;
+
+  void Query(const AABB& bounds,
+             std::vector<entt::entity>& out) const override;
+
+  [[nodiscard]] uint32_t GetHeight() const;
+
+ private:
+  static constexpr int32_t kNullNode = -1;
+
+  struct Node {
+    AABB bounds;
+    int32_t parent = kNullNode;
+    int32_t left = kNullNode;
+    int32_t right = kNullNode;
+    entt::entity entity = entt::null;
+
+    [[nodiscard]] bool IsLeaf() const { return left == kNullNode; }
+  };
+
+  [[nodiscard]] int32_t AllocateNode();
+
+  void FreeNode(int32_t index);
+
+  void InsertLeaf(int32_t leaf);
+
+  void RemoveLeaf(int32_t leaf);
+
+  void Refit(int32_t index);
+
+  [[nodiscard]] uint32_t GetHeight(int32_t index) const;
+
+ private:
+  float margin_;
+
+  std::vector<Node> nodes_;
+  int32_t root_ = kNullNode;
+  int32_t free_list_ = kNullNode;
+
+  std::unordered_map<entt::entity, int32_t> leaves_;
+
+  mutable std::vector<int32_t> stack_;
+};
+
+}  // namespace eve
@@ -4,17 +4,21 @@
 
 namespace eve {
 
+AABB GetColliderBounds(const glm::vec3& position,
+                       const BoxCollider& collider) {
+  return AABB::FromCenter(position + collider.local_position,
+                          collider.local_scale / 2.0f);
+}
+
 template <>
-bool ColliderIntersects(const Transform& lhs_transform,
+bool ColliderIntersects(const glm::vec3& lhs_entity_position,
                         const BoxCollider& lhs_collider,
-                        const Transform& rhs_transform,
+                        const glm::vec3& rhs_entity_position,
                         const BoxCollider& rhs_collider) {
   // Get world-space properties
-  glm::vec3 lhs_position =
-      lhs_transform.GetPosition() + lhs_collider.local_position;
+  glm::vec3 lhs_position = lhs_entity_position + lhs_collider.local_position;
   glm::vec3 lhs_scale = lhs_collider.local_scale;
-  glm::vec3 rhs_position =
-      rhs_transform.GetPosition() + rhs_collider.local_position;
+  glm::vec3 rhs_position = rhs_entity_position + rhs_collider.local_position;
   glm::vec3 rhs_scale = rhs_collider.local_scale;
 
   // Check for intersection along each axis
@@ -4,6 +4,7 @@
 
 #include "pch_shared.h"
 
+#include "core/math/aabb.h"
 #include "physics/collider.h"
 
 namespace eve {
@@ -17,10 +18,13 @@ struct BoxCollider : Collider {
   TriggerFunc on_trigger = nullptr;
 };
 
+[[nodiscard]] AABB GetColliderBounds(const glm::vec3& position,
+                                     const BoxCollider& collider);
+
 template <>
-bool ColliderIntersects(const Transform& lhs_transform,
+bool ColliderIntersects(const glm::vec3& lhs_position,
                         const BoxCollider& lhs_collider,
-                        const Transform& rhs_transform,
+                        const glm::vec3& rhs_position,
                         const BoxCollider& rhs_collider);
 
 }  // namespace eve
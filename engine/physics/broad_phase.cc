@@ -0,0 +1,24 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "physics/broad_phase.h"
+
+#include "physics/aabb_tree.h"
+#include "physics/spatial_hash.h"
+
+namespace eve {
+
+Scope<BroadPhase> BroadPhase::Create(BroadPhaseType type) {
+  switch (type) {
+    case BroadPhaseType::kBruteForce:
+      return nullptr;
+    case BroadPhaseType::kSpatialHash:
+      return CreateScope<SpatialHash>();
+    case BroadPhaseType::kAABBTree:
+      return CreateScope<AABBTree>();
+    default:
+      EVE_ASSERT_ENGINE(false, "Unknown broad phase type");
+      return nullptr;
+  }
+}
+
+}  // namespace eve
@@ -0,0 +1,49 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include <entt/entt.hpp>
+
+#include "core/math/aabb.h"
+
+namespace eve {
+
+enum class BroadPhaseType {
+  // test every collider against each other
+  kBruteForce,
+  kSpatialHash,
+  kAABBTree,
+};
+
+/**
+ * @brief Spatial structure used to find collider pairs which could collide
+ * before running exact intersection tests on them.
+ */
+class BroadPhase {
+ public:
+  virtual ~BroadPhase() = default;
+
+  virtual void Clear() = 0;
+
+  virtual void Insert(entt::entity entity, const AABB& bounds) = 0;
+
+  virtual void Remove(entt::entity entity) = 0;
+
+  /**
+   * @brief Moves already inserted entity to its new bounds.
+   */
+  virtual void Update(entt::entity entity, const AABB& bounds) = 0;
+
+  /**
+   * @brief Appends every entity whose bounds might overlap with @p bounds,
+   * results are guaranteed to be unique but could contain false positives.
+   */
+  virtual void Query(const AABB& bounds,
+                     std::vector<entt::entity>& out) const = 0;
+
+  [[nodiscard]] static Scope<BroadPhase> Create(BroadPhaseType type);
+};
+
+}  // namespace eve
@@ -16,10 +16,14 @@ struct Collider {
   virtual ~Collider() = default;
 };
 
+/**
+ * @brief Positions are the world positions of the entities owning the
+ * colliders.
+ */
 template <typename T>
   requires std::is_base_of_v<Collider, T>
-bool ColliderIntersects(const Transform& lhs_transform, const T& lhs_collider,
-                        const Transform& rhs_transform, const T& rhs_collider) {
+bool ColliderIntersects(const glm::vec3& lhs_position, const T& lhs_collider,
+                        const glm::vec3& rhs_position, const T& rhs_collider) {
   return false;
 }
 
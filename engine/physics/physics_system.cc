@@ -19,17 +19,71 @@ void ApplyConstraints(glm::vec3& vec, const glm::vec3& vec_before,
 }
 
 PhysicsSystem::PhysicsSystem()
-    : System(SystemRunType_kRuntime | SystemRunType_kSimulation) {}
+    : System(SystemRunType_kRuntime | SystemRunType_kSimulation) {
+  // world transforms are updated by the TransformSystem running before
+  Reads<BoxCollider, TagComponent, WorldTransform>();
+  Writes<Transform, Rigidbody, RigidbodyInterpolation>();
+
+  // trigger callbacks are calling into scripts
+  SetMainThreadOnly();
+}
+
+void PhysicsSystem::OnStart() {
+  accumulator_ = 0.0f;
+}
 
 void PhysicsSystem::OnUpdate(float ds) {
-  // TODO If this performs not good with big data consider using Barnes-Hut algorithm
-  // with an Octree
+  DetectTeleports();
+
+  if (settings_.tick_rate <= 0.0f) {
+    BuildBroadPhase();
+    Step(ds);
+    InterpolatePositions(1.0f);
+    return;
+  }
+
+  const float fixed_ds = 1.0f / settings_.tick_rate;
+
+  accumulator_ += ds;
+
+  const auto steps_due = static_cast<uint32_t>(accumulator_ / fixed_ds);
+  const uint32_t steps = std::min(steps_due, settings_.max_substeps);
+
+  // skipped steps are dropped too, otherwise they pile up under load
+  accumulator_ -= steps_due * fixed_ds;
+
+  if (steps > 0) {
+    BuildBroadPhase();
+  }
+
+  // bodies which lost their rigidbody keep the state but are left alone
+  auto bodies = GetScene()
+                    ->GetAllEntitiesWith<Transform, Rigidbody,
+                                         RigidbodyInterpolation>();
+
+  for (uint32_t i = 0; i < steps; i++) {
+    bodies.each([](const Transform& tc, const Rigidbody&,
+                   RigidbodyInterpolation& state) {
+      state.previous_position = tc.local_position;
+    });
+
+    Step(fixed_ds);
+  }
+
+  InterpolatePositions(settings_.interpolate ? accumulator_ / fixed_ds : 1.0f);
+}
+
+void PhysicsSystem::Step(float ds) {
+  auto colliders =
+      GetScene()->GetAllEntitiesWith<Transform, WorldTransform, BoxCollider>();
+
   for (const auto& entity_id :
        GetScene()->GetAllEntitiesWith<Transform, Rigidbody>()) {
     Entity entity{entity_id, GetScene()};
 
     Transform& tc = entity.GetComponent<Transform>();
     Rigidbody& rb = entity.GetComponent<Rigidbody>();
+    const WorldTransform& world = entity.GetComponent<WorldTransform>();
 
     Transform tc_before = tc;
     Rigidbody rb_before = rb;
@@ -63,30 +117,155 @@ void PhysicsSystem::OnUpdate(float ds) {
 
     BoxCollider& collider = entity.GetComponent<BoxCollider>();
 
-    // Check for collisions with other entities having BoxCollider components
-    GetScene()->GetAllEntitiesWith<Transform, BoxCollider>().each(
-        [&](entt::entity other_id, Transform& other_tc,
-            BoxCollider& other_collider) {
-          Entity other_entity{other_id, GetScene()};
+    const auto check_collision = [&](entt::entity other_id,
+                                     const Transform& other_tc,
+                                     const WorldTransform& other_world,
+                                     BoxCollider& other_collider) {
+      Entity other_entity{other_id, GetScene()};
 
-          if (entity_id == other_id) {
-            return;
-          }
+      if (entity_id == other_id) {
+        return;
+      }
 
-          if (ColliderIntersects(tc, collider, other_tc, other_collider)) {
-            rb = rb_before;
-            tc = tc_before;
+      if (ColliderIntersects(world.GetPosition(tc), collider,
+                             other_world.GetPosition(other_tc),
+                             other_collider)) {
+        rb = rb_before;
+        tc = tc_before;
 
-            if (collider.is_trigger && collider.on_trigger != nullptr) {
-              collider.on_trigger(other_entity.GetName());
-            }
-            if (other_collider.is_trigger &&
-                other_collider.on_trigger != nullptr) {
-              other_collider.on_trigger(entity.GetName());
+        if (collider.is_trigger && collider.on_trigger != nullptr) {
+          collider.on_trigger(other_entity.GetName());
+        }
+        if (other_collider.is_trigger && other_collider.on_trigger != nullptr) {
+          other_collider.on_trigger(entity.GetName());
+        }
+      }
+    };
+
+    if (!broad_phase_) {
+      // Check for collisions with other entities having BoxCollider components
+      colliders.each(check_collision);
+      continue;
+    }
+
+    // Body could be moved back to its previous position on collision so
+    // query both of the positions.
+    const AABB bounds_before =
+        GetColliderBounds(world.GetPosition(tc_before), collider);
+    const AABB bounds = GetColliderBounds(world.GetPosition(tc), collider);
+
+    candidates_.clear();
+    broad_phase_->Query(AABB::Merge(bounds_before, bounds), candidates_);
+
+    for (const entt::entity other_id : candidates_) {
+      auto [other_tc, other_world, other_collider] =
+          colliders.get<Transform, WorldTransform, BoxCollider>(other_id);
+      check_collision(other_id, other_tc, other_world, other_collider);
+    }
+
+    broad_phase_->Update(entity_id,
+                         GetColliderBounds(world.GetPosition(tc), collider));
+  }
+}
+
+void PhysicsSystem::DetectTeleports() {
+  for (const auto& entity_id :
+       GetScene()->GetAllEntitiesWith<Transform, Rigidbody>()) {
+    Entity entity{entity_id, GetScene()};
+
+    const Transform& tc = entity.GetComponent<Transform>();
+
+    if (!entity.HasComponent<RigidbodyInterpolation>()) {
+      entity.AddComponent<RigidbodyInterpolation>(
+          tc.local_position, tc.local_position, tc.local_position);
+      continue;
+    }
+
+    auto& state = entity.GetComponent<RigidbodyInterpolation>();
+
+    // moved by scripts or the editor since last frame, render it there
+    // instead of blending from the old position
+    if (tc.local_position != state.current_position) {
+      state.previous_position = tc.local_position;
+      state.current_position = tc.local_position;
+    }
+  }
+}
+
+void PhysicsSystem::InterpolatePositions(float alpha) {
+  GetScene()
+      ->GetAllEntitiesWith<Transform, Rigidbody, RigidbodyInterpolation>()
+      .each([&](const Transform& tc, const Rigidbody&,
+                RigidbodyInterpolation& state) {
+        state.current_position = tc.local_position;
+        state.rendered_position = glm::mix(state.previous_position,
+                                           state.current_position, alpha);
+      });
+}
+
+PhysicsInterpolationSystem::PhysicsInterpolationSystem()
+    : System(SystemRunType_kRuntime | SystemRunType_kSimulation) {
+  Reads<Transform, Rigidbody, RigidbodyInterpolation, RelationComponent>();
+  Writes<WorldTransform>();
+}
+
+void PhysicsInterpolationSystem::OnUpdate(float ds) {
+  Scene* scene = GetScene();
+
+  auto worlds = scene->GetAllEntitiesWith<WorldTransform, RelationComponent>();
+
+  scene->GetAllEntitiesWith<Transform, Rigidbody, RigidbodyInterpolation>()
+      .each([&](entt::entity entity_id, const Transform& tc, const Rigidbody&,
+                const RigidbodyInterpolation& state) {
+        const glm::vec3 offset = state.rendered_position - tc.local_position;
+        if (offset == kVec3Zero) {
+          return;
+        }
+
+        const glm::mat4 translation = glm::translate(glm::mat4(1.0f), offset);
+
+        // children are rendered relative to the interpolated position
+        stack_.push_back(entity_id);
+        while (!stack_.empty()) {
+          const entt::entity id = stack_.back();
+          stack_.pop_back();
+
+          auto [world, relation] =
+              worlds.get<WorldTransform, RelationComponent>(id);
+          world.position += offset;
+          world.matrix = translation * world.matrix;
+          world.dirty = true;
+
+          for (const UUID& child_id : relation.children_ids) {
+            if (Entity child = scene->TryGetEntityByUUID(child_id); child) {
+              stack_.push_back((entt::entity)child);
             }
           }
-        });
+        }
+      });
+}
+
+void PhysicsSystem::BuildBroadPhase() {
+  if (broad_phase_type_ != settings_.broad_phase) {
+    broad_phase_ = BroadPhase::Create(settings_.broad_phase);
+    broad_phase_type_ = settings_.broad_phase;
   }
+
+  if (!broad_phase_) {
+    return;
+  }
+
+  // Colliders could be moved or destroyed outside of physics,
+  // so rebuild from scratch every frame.
+  broad_phase_->Clear();
+
+  GetScene()
+      ->GetAllEntitiesWith<Transform, WorldTransform, BoxCollider>()
+      .each([&](entt::entity entity_id, const Transform& tc,
+                const WorldTransform& world, const BoxCollider& collider) {
+        broad_phase_->Insert(
+            entity_id, GetColliderBounds(world.GetPosition(tc), collider));
+      });
 }
 
 }  // namespace eve
\ No newline at end of file
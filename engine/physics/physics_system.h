@@ -4,12 +4,33 @@
 
 #include "pch_shared.h"
 
+#include "physics/broad_phase.h"
 #include "scene/system.h"
 
 namespace eve {
 
 struct PhysicsSystemSettings {
   glm::vec3 gravity = {0.0f, -9.8f, 0.0f};
+  BroadPhaseType broad_phase = BroadPhaseType::kAABBTree;
+
+  // simulation steps per second, frame delta is used directly if not positive
+  float tick_rate = 60.0f;
+  // steps exceeding this in a single frame are dropped to cap physics time
+  uint32_t max_substeps = 8;
+  // renders bodies between the last two steps instead of the latest one
+  bool interpolate = true;
+};
+
+/**
+ * @brief Positions of the last two steps of a rigidbody, added by
+ * PhysicsSystem. Transform always holds the simulated position, rendering
+ * gets the interpolated one through PhysicsInterpolationSystem.
+ */
+struct RigidbodyInterpolation {
+  glm::vec3 previous_position;
+  // any other value in Transform means it was moved outside of physics
+  glm::vec3 current_position;
+  glm::vec3 rendered_position;
 };
 
 class PhysicsSystem : public System {
@@ -19,10 +40,45 @@ class PhysicsSystem : public System {
   PhysicsSystemSettings& GetSettings() { return settings_; }
 
  protected:
+  void OnStart() override;
+
   void OnUpdate(float ds) override;
 
+ private:
+  void Step(float ds);
+
+  void DetectTeleports();
+
+  void InterpolatePositions(float alpha);
+
+  void BuildBroadPhase();
+
  private:
   PhysicsSystemSettings settings_;
+
+  Scope<BroadPhase> broad_phase_;
+  BroadPhaseType broad_phase_type_ = BroadPhaseType::kBruteForce;
+
+  std::vector<entt::entity> candidates_;
+
+  float accumulator_ = 0.0f;
+};
+
+/**
+ * @brief Moves world transforms of rigidbodies and their children to the
+ * interpolated positions, should run after the last TransformSystem. Moved
+ * world transforms are recalculated from Transform on the next update.
+ */
+class PhysicsInterpolationSystem : public System {
+ public:
+  PhysicsInterpolationSystem();
+
+ protected:
+  void OnUpdate(float ds) override;
+
+ private:
+  // kept between frames to prevent reallocations
+  std::vector<entt::entity> stack_;
 };
 
 };  // namespace eve
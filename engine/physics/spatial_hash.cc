@@ -0,0 +1,108 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "physics/spatial_hash.h"
+
+namespace eve {
+
+SpatialHash::SpatialHash(float cell_size)
+    : cell_size_(cell_size), inverse_cell_size_(1.0f / cell_size) {
+  EVE_ASSERT_ENGINE(cell_size > 0.0f, "Cell size must be positive!");
+}
+
+void SpatialHash::Clear() {
+  // keep allocated cell vectors to reuse them at the next frame
+  for (auto& [hash, entities] : cells_) {
+    entities.clear();
+  }
+  bounds_.clear();
+}
+
+void SpatialHash::Insert(entt::entity entity, const AABB& bounds) {
+  bounds_[entity] = bounds;
+
+  ForEachCell(bounds, [&](uint64_t hash) {
+    cells_[hash].push_back(entity);
+  });
+}
+
+void SpatialHash::Remove(entt::entity entity) {
+  const auto it = bounds_.find(entity);
+  if (it == bounds_.end()) {
+    return;
+  }
+
+  ForEachCell(it->second, [&](uint64_t hash) {
+    auto& entities = cells_[hash];
+
+    const auto entity_it = std::find(entities.begin(), entities.end(), entity);
+    if (entity_it != entities.end()) {
+      *entity_it = entities.back();
+      entities.pop_back();
+    }
+  });
+
+  bounds_.erase(it);
+}
+
+void SpatialHash::Update(entt::entity entity, const AABB& bounds) {
+  const auto it = bounds_.find(entity);
+  if (it != bounds_.end() && GetCell(it->second.min) == GetCell(bounds.min) &&
+      GetCell(it->second.max) == GetCell(bounds.max)) {
+    // still in the same cells
+    it->second = bounds;
+    return;
+  }
+
+  Remove(entity);
+  Insert(entity, bounds);
+}
+
+void SpatialHash::Query(const AABB& bounds,
+                        std::vector<entt::entity>& out) const {
+  query_results_.clear();
+
+  ForEachCell(bounds, [&](uint64_t hash) {
+    const auto it = cells_.find(hash);
+    if (it == cells_.end()) {
+      return;
+    }
+
+    for (const entt::entity entity : it->second) {
+      if (bounds_.at(entity).Overlaps(bounds)) {
+        query_results_.push_back(entity);
+      }
+    }
+  });
+
+  std::sort(query_results_.begin(), query_results_.end());
+  const auto last = std::unique(query_results_.begin(), query_results_.end());
+
+  out.insert(out.end(), query_results_.begin(), last);
+}
+
+glm::ivec3 SpatialHash::GetCell(const glm::vec3& point) const {
+  return glm::ivec3(glm::floor(point * inverse_cell_size_));
+}
+
+uint64_t SpatialHash::HashCell(const glm::ivec3& cell) {
+  // large primes to spread neighbouring cells
+  return ((uint64_t)(uint32_t)cell.x * 73856093ull) ^
+         ((uint64_t)(uint32_t)cell.y * 19349663ull) ^
+         ((uint64_t)(uint32_t)cell.z * 83492791ull);
+}
+
+template <typename Func>
+void SpatialHash::ForEachCell(const AABB& bounds, Func func) const {
+  const glm::ivec3 min = GetCell(bounds.min);
+  const glm::ivec3 max = GetCell(bounds.max);
+
+  for (int x = min.x; x <= max.x; x++) {
+    for (int y = min.y; y <= max.y; y++) {
+      for (int z = min.z; z <= max.z; z++) {
+        func(HashCell({x, y, z}));
+      }
+    }
+  }
+}
+
+}  // namespace eve
@@ -0,0 +1,49 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "physics/broad_phase.h"
+
+namespace eve {
+
+/**
+ * @brief Sparse uniform grid, works best when colliders are about the same
+ * size as a cell.
+ */
+class SpatialHash final : public BroadPhase {
+ public:
+  SpatialHash(float cell_size = 2.0f);
+
+  void Clear() override;
+
+  void Insert(entt::entity entity, const AABB& bounds) override;
+
+  void Remove(entt::entity entity) override;
+
+  void Update(entt::entity entity, const AABB& bounds) override;
+
+  void Query(const AABB& bounds,
+             std::vector<entt::entity>& out) const override;
+
+  [[nodiscard]] float GetCellSize() const { return cell_size_; }
+
+ private:
+  [[nodiscard]] glm::ivec3 GetCell(const glm::vec3& point) const;
+
+  [[nodiscard]] static uint64_t HashCell(const glm::ivec3& cell);
+
+  template <typename Func>
+  void ForEachCell(const AABB& bounds, Func func) const;
+
+ private:
+  float cell_size_;
+  float inverse_cell_size_;
+
+  std::unordered_map<uint64_t, std::vector<entt::entity>> cells_;
+  std::unordered_map<entt::entity, AABB> bounds_;
+
+  // used to filter duplicates of multi cell entities
+  mutable std::vector<entt::entity> query_results_;
+};
+
+}  // namespace eve
@@ -0,0 +1,140 @@
+#include "catch2/catch_all.hpp"
+
+#include "physics/aabb_tree.h"
+#include "physics/spatial_hash.h"
+
+using namespace eve;
+
+namespace {
+
+std::vector<AABB> GenerateBounds(uint32_t count, float world_size,
+                                 uint32_t seed = 1337) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-world_size, world_size);
+  std::uniform_real_distribution<float> extent(0.25f, 1.0f);
+
+  std::vector<AABB> bounds(count);
+  for (AABB& aabb : bounds) {
+    aabb = AABB::FromCenter({position(rng), position(rng), position(rng)},
+                            glm::vec3(extent(rng)));
+  }
+  return bounds;
+}
+
+std::vector<entt::entity> BruteForceQuery(const std::vector<AABB>& bounds,
+                                          const AABB& query) {
+  std::vector<entt::entity> result;
+  for (uint32_t i = 0; i < bounds.size(); i++) {
+    if (bounds[i].Overlaps(query)) {
+      result.push_back(static_cast<entt::entity>(i));
+    }
+  }
+  return result;
+}
+
+// broad phase could return false positives so filter them out
+std::vector<entt::entity> FilterOverlapping(
+    const std::vector<AABB>& bounds, const AABB& query,
+    std::vector<entt::entity> candidates) {
+  std::erase_if(candidates, [&](entt::entity entity) {
+    return !bounds[static_cast<uint32_t>(entity)].Overlaps(query);
+  });
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+void RequireMatchesBruteForce(BroadPhase& broad_phase,
+                              const std::vector<AABB>& bounds) {
+  std::vector<entt::entity> candidates;
+  for (const AABB& query : bounds) {
+    candidates.clear();
+    broad_phase.Query(query, candidates);
+
+    const size_t candidate_count = candidates.size();
+    std::sort(candidates.begin(), candidates.end());
+    REQUIRE(std::unique(candidates.begin(), candidates.end()) ==
+            candidates.end());
+    REQUIRE(candidates.size() == candidate_count);
+
+    REQUIRE(FilterOverlapping(bounds, query, candidates) ==
+            BruteForceQuery(bounds, query));
+  }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("BroadPhase matches brute force", "[BroadPhase]",
+                   SpatialHash, AABBTree) {
+  std::vector<AABB> bounds = GenerateBounds(500, 20.0f);
+
+  TestType broad_phase;
+  for (uint32_t i = 0; i < bounds.size(); i++) {
+    broad_phase.Insert(static_cast<entt::entity>(i), bounds[i]);
+  }
+
+  SECTION("Query after insertion") {
+    RequireMatchesBruteForce(broad_phase, bounds);
+  }
+
+  SECTION("Query after update") {
+    std::vector<AABB> moved = GenerateBounds(bounds.size(), 20.0f, 42);
+    for (uint32_t i = 0; i < bounds.size(); i += 2) {
+      bounds[i] = moved[i];
+      broad_phase.Update(static_cast<entt::entity>(i), bounds[i]);
+    }
+
+    RequireMatchesBruteForce(broad_phase, bounds);
+  }
+
+  SECTION("Removed entities are not returned") {
+    for (uint32_t i = 0; i < bounds.size(); i++) {
+      broad_phase.Remove(static_cast<entt::entity>(i));
+    }
+
+    std::vector<entt::entity> candidates;
+    broad_phase.Query(AABB::FromCenter(glm::vec3(0.0f), glm::vec3(50.0f)),
+                      candidates);
+    REQUIRE(candidates.empty());
+  }
+}
+
+TEST_CASE("BroadPhase benchmark", "[BroadPhase][!benchmark]") {
+  constexpr uint32_t kColliderCount = 10000;
+  const std::vector<AABB> bounds = GenerateBounds(kColliderCount, 200.0f);
+
+  BENCHMARK("Brute force 10k colliders") {
+    uint32_t pair_count = 0;
+    for (uint32_t i = 0; i < bounds.size(); i++) {
+      for (uint32_t j = i + 1; j < bounds.size(); j++) {
+        pair_count += bounds[i].Overlaps(bounds[j]);
+      }
+    }
+    return pair_count;
+  };
+
+  const auto benchmark_broad_phase = [&](BroadPhase& broad_phase) {
+    broad_phase.Clear();
+    for (uint32_t i = 0; i < bounds.size(); i++) {
+      broad_phase.Insert(static_cast<entt::entity>(i), bounds[i]);
+    }
+
+    size_t pair_count = 0;
+    std::vector<entt::entity> candidates;
+    for (const AABB& query : bounds) {
+      candidates.clear();
+      broad_phase.Query(query, candidates);
+      pair_count += candidates.size();
+    }
+    return pair_count;
+  };
+
+  SpatialHash spatial_hash;
+  BENCHMARK("Spatial hash 10k colliders") {
+    return benchmark_broad_phase(spatial_hash);
+  };
+
+  AABBTree aabb_tree;
+  BENCHMARK("AABB tree 10k colliders") {
+    return benchmark_broad_phase(aabb_tree);
+  };
+}
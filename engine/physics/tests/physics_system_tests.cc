@@ -0,0 +1,141 @@
+#include "catch2/catch_all.hpp"
+
+#include "physics/physics_system.h"
+#include "physics/rigidbody.h"
+#include "scene/entity.h"
+#include "scene/scene.h"
+
+using namespace eve;
+
+namespace {
+
+class TestPhysicsSystem : public PhysicsSystem {
+ public:
+  using PhysicsSystem::OnUpdate;
+};
+
+class TestPhysicsInterpolationSystem : public PhysicsInterpolationSystem {
+ public:
+  using PhysicsInterpolationSystem::OnUpdate;
+};
+
+}  // namespace
+
+TEST_CASE("PhysicsSystem fixed timestep", "[PhysicsSystem]") {
+  Ref<State> state = CreateRef<State>();
+  Scene scene(state);
+
+  TestPhysicsSystem* physics = scene.PushSystem<TestPhysicsSystem>();
+
+  // power of two tick rate so the steps are exact in floating point
+  PhysicsSystemSettings& settings = physics->GetSettings();
+  settings.tick_rate = 4.0f;
+  settings.max_substeps = 3;
+  settings.interpolate = false;
+
+  Entity body = scene.CreateEntity({"body"});
+  Rigidbody& rb = body.AddComponent<Rigidbody>();
+  rb.velocity = {1.0f, 0.0f, 0.0f};
+  rb.acceleration = {0.0f, 0.0f, 0.0f};
+
+  const auto get_position = [&]() {
+    return body.GetTransform().local_position.x;
+  };
+
+  const auto get_rendered_position = [&]() {
+    return body.GetComponent<RigidbodyInterpolation>().rendered_position.x;
+  };
+
+  SECTION("Runs a step for every elapsed tick") {
+    physics->OnUpdate(0.125f);
+    REQUIRE(get_position() == 0.0f);
+
+    // leftover of the previous frame completes a step
+    physics->OnUpdate(0.625f);
+    REQUIRE(get_position() == 0.75f);
+  }
+
+  SECTION("Drops steps beyond max substeps") {
+    physics->OnUpdate(2.0f);
+    REQUIRE(get_position() == 0.75f);
+
+    // dropped steps are not caught up later
+    physics->OnUpdate(0.125f);
+    REQUIRE(get_position() == 0.75f);
+  }
+
+  SECTION("Interpolates between the last two steps") {
+    settings.interpolate = true;
+
+    physics->OnUpdate(0.25f);
+    REQUIRE(get_rendered_position() == 0.0f);
+
+    physics->OnUpdate(0.125f);
+    REQUIRE(get_rendered_position() == 0.125f);
+
+    // transform keeps the simulated position
+    REQUIRE(get_position() == 0.25f);
+
+    physics->OnUpdate(0.125f);
+    REQUIRE(get_rendered_position() == 0.25f);
+    REQUIRE(get_position() == 0.5f);
+  }
+
+  SECTION("Moves outside of physics do not lose simulated motion") {
+    settings.interpolate = true;
+
+    physics->OnUpdate(0.25f);
+
+    // e.g. a script moving the body relative to its position
+    body.GetTransform().local_position.x += 0.125f;
+
+    physics->OnUpdate(0.125f);
+    REQUIRE(get_position() == 0.375f);
+    REQUIRE(get_rendered_position() == 0.375f);
+
+    physics->OnUpdate(0.125f);
+    REQUIRE(get_position() == 0.625f);
+  }
+
+  SECTION("Teleports bodies moved outside of physics") {
+    settings.interpolate = true;
+
+    physics->OnUpdate(0.25f);
+    physics->OnUpdate(0.125f);
+
+    body.GetTransform().local_position.x = 10.0f;
+
+    physics->OnUpdate(0.0f);
+    REQUIRE(get_rendered_position() == 10.0f);
+
+    physics->OnUpdate(0.125f);
+    REQUIRE(get_position() == 10.25f);
+    REQUIRE(get_rendered_position() == 10.0f);
+
+    physics->OnUpdate(0.125f);
+    REQUIRE(get_rendered_position() == 10.125f);
+  }
+
+  SECTION("Interpolated positions are only rendered") {
+    settings.interpolate = true;
+
+    Entity child = scene.CreateEntity({"child", body.GetUUID()});
+    child.GetTransform().local_position = {0.0f, 1.0f, 0.0f};
+
+    auto* interpolation = scene.PushSystem<TestPhysicsInterpolationSystem>();
+
+    physics->OnUpdate(0.25f);
+    physics->OnUpdate(0.125f);
+
+    scene.OnUpdateEditor(0.0f);
+    interpolation->OnUpdate(0.0f);
+
+    // children follow the rendered position of their parent
+    REQUIRE(body.GetComponent<WorldTransform>().position.x == 0.125f);
+    REQUIRE(child.GetComponent<WorldTransform>().position ==
+            glm::vec3(0.125f, 1.0f, 0.0f));
+
+    // simulated values are used from the next update on
+    REQUIRE(body.GetWorldTransform().position.x == 0.25f);
+  }
+}
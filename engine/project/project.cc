@@ -36,6 +36,8 @@ Ref<Project> Project::Load(const fs::path& path) {
     Input::Init();
     Input::Deserialize(GetKeymapsPath());
 
+    AssetRegistry::SetMemoryBudget(project->config_.asset_memory_budget *
+                                   1024 * 1024);
     AssetRegistry::Deserialize(GetAssetRegistryPath());
     SceneManager::Init(active_project_);
 
@@ -12,6 +12,9 @@ struct ProjectConfig {
   std::string asset_registry;
   std::string keymaps;
   std::vector<std::string> scenes;
+  // unused assets are unloaded past this many megabytes when assets are
+  // loaded on demand
+  uint64_t asset_memory_budget = 512;
 };
 
 class Project {
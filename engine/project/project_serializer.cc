@@ -23,6 +23,7 @@ void ProjectSerializer::Serialize(const fs::path& path) {
            {"script_directory", config.script_directory},
            {"asset_registry", config.asset_registry},
            {"keymaps", config.keymaps},
+           {"asset_memory_budget", config.asset_memory_budget},
            {"scenes", json::array()}};
 
   for (const auto& scene : config.scenes) {
@@ -50,6 +51,8 @@ bool ProjectSerializer::Deserialize(const fs::path& path) {
   config.script_directory = j["script_directory"].get<std::string>();
   config.asset_registry = j["asset_registry"].get<std::string>();
   config.keymaps = j["keymaps"].get<std::string>();
+  config.asset_memory_budget =
+      j.value("asset_memory_budget", config.asset_memory_budget);
 
   auto scenes_json = j["scenes"];
   for (auto& scene : scenes_json) {
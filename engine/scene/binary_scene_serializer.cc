@@ -0,0 +1,848 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "scene/binary_scene_serializer.h"
+
+#include "asset/asset_registry.h"
+#include "core/debug/log.h"
+#include "core/mapped_file.h"
+#include "core/uuid.h"
+#include "scene/components.h"
+#include "scene/entity.h"
+#include "scene/scene_serializer.h"
+#include "scripting/script.h"
+#include "scripting/script_engine.h"
+
+namespace eve {
+
+// File layout, every blob starts aligned to kBinarySceneAlignment and
+// values are stored in the native (little endian) byte order:
+//   BinarySceneHeader
+//   BinarySceneTable[table_count]
+//   Record[record_count] for each table
+//   char[strings_size]
+//
+// Empty tables are not written at all, tables of unknown types are skipped
+// so new ones could be added without breaking older readers.
+
+static constexpr char kBinarySceneMagic[4] = {'E', 'S', 'C', 'B'};
+static constexpr uint64_t kBinarySceneAlignment = 16;
+
+// largest uniform and script field value, bigger ones like matrices are not
+// serialized
+static constexpr uint32_t kBinaryValueSize = 16;
+
+// uniform types serialized by the json format as well, others like matrices
+// are left with their default values
+template <typename T>
+static constexpr bool kIsSerializedUniform =
+    std::is_same_v<T, float> || std::is_same_v<T, glm::vec2> ||
+    std::is_same_v<T, glm::vec3> || std::is_same_v<T, glm::vec4> ||
+    std::is_same_v<T, int> || std::is_same_v<T, bool>;
+
+enum class SceneTableType : uint32_t {
+  kEntity = 0,
+  kTransform,
+  kCamera,
+  kSpriteRenderer,
+  kModel,
+  kMaterial,
+  kMaterialUniform,
+  kRigidbody,
+  kBoxCollider,
+  kScript,
+  kScriptField,
+};
+
+struct BinaryString {
+  uint32_t offset;
+  uint32_t size;
+};
+
+struct BinarySceneHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t table_count;
+  uint32_t reserved;
+  BinaryString name;
+  uint64_t tables_offset;
+  uint64_t strings_offset;
+  uint64_t strings_size;
+};
+
+struct BinarySceneTable {
+  uint32_t type;
+  uint32_t record_size;
+  uint64_t record_count;
+  uint64_t offset;
+};
+
+struct EntityRecord {
+  uint64_t id;
+  uint64_t parent_id;
+  BinaryString tag;
+};
+
+struct TransformRecord {
+  uint64_t entity;
+  glm::vec3 position;
+  glm::vec3 rotation;
+  glm::vec3 scale;
+};
+
+struct CameraRecord {
+  uint64_t entity;
+  float ortho_aspect_ratio;
+  float ortho_zoom_level;
+  float ortho_near_clip;
+  float ortho_far_clip;
+  float persp_aspect_ratio;
+  float persp_fov;
+  float persp_near_clip;
+  float persp_far_clip;
+  uint8_t is_orthographic;
+  uint8_t is_primary;
+  uint8_t is_fixed_aspect_ratio;
+};
+
+struct SpriteRendererRecord {
+  uint64_t entity;
+  uint64_t texture;
+  Color color;
+  glm::vec2 tex_tiling;
+};
+
+struct ModelRecord {
+  uint64_t entity;
+  uint64_t model;
+};
+
+struct MaterialRecord {
+  uint64_t entity;
+  uint64_t shader;
+  Color albedo;
+};
+
+struct MaterialUniformRecord {
+  uint64_t entity;
+  BinaryString name;
+  uint32_t type;
+  uint8_t value[kBinaryValueSize];
+};
+
+struct RigidbodyRecord {
+  uint64_t entity;
+  glm::vec3 velocity;
+  glm::vec3 acceleration;
+  float mass;
+  uint8_t use_gravity;
+  uint8_t freeze_x;
+  uint8_t freeze_y;
+  uint8_t freeze_z;
+  uint8_t freeze_pitch;
+  uint8_t freeze_yaw;
+  uint8_t freeze_roll;
+};
+
+struct BoxColliderRecord {
+  uint64_t entity;
+  glm::vec3 local_position;
+  glm::vec3 local_scale;
+  uint8_t is_trigger;
+};
+
+struct ScriptRecord {
+  uint64_t entity;
+  BinaryString class_name;
+};
+
+struct ScriptFieldRecord {
+  uint64_t entity;
+  BinaryString name;
+  uint32_t type;
+  uint8_t data[kBinaryValueSize];
+};
+
+static_assert(std::is_trivially_copyable_v<BinarySceneHeader>);
+static_assert(std::is_trivially_copyable_v<TransformRecord>);
+static_assert(std::is_trivially_copyable_v<SpriteRendererRecord>);
+static_assert(std::is_trivially_copyable_v<MaterialRecord>);
+static_assert(std::is_trivially_copyable_v<RigidbodyRecord>);
+static_assert(std::is_trivially_copyable_v<BoxColliderRecord>);
+
+[[nodiscard]] static uint64_t Align(uint64_t offset) {
+  return (offset + kBinarySceneAlignment - 1) & ~(kBinarySceneAlignment - 1);
+}
+
+static void WritePadding(std::ofstream& file, uint64_t offset) {
+  static constexpr char kZeros[kBinarySceneAlignment] = {};
+
+  const uint64_t position = static_cast<uint64_t>(file.tellp());
+  file.write(kZeros, offset - position);
+}
+
+/**
+ * @brief Collects tables and strings until they are written at once.
+ */
+class BinarySceneWriter {
+ public:
+  template <typename Record>
+  void AddTable(SceneTableType type, const std::vector<Record>& records) {
+    if (records.empty()) {
+      return;
+    }
+
+    BinarySceneTable& table = tables_.emplace_back();
+    table.type = static_cast<uint32_t>(type);
+    table.record_size = sizeof(Record);
+    table.record_count = records.size();
+
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(records.data());
+    table_data_.emplace_back(data, data + records.size() * sizeof(Record));
+  }
+
+  [[nodiscard]] BinaryString AddString(const std::string& value) {
+    const BinaryString string = {static_cast<uint32_t>(strings_.size()),
+                                 static_cast<uint32_t>(value.size())};
+    strings_ += value;
+    return string;
+  }
+
+  bool Write(const fs::path& path, const std::string& name) {
+    BinarySceneHeader header = {};
+    std::copy_n(kBinarySceneMagic, 4, header.magic);
+    header.version = kBinarySceneVersion;
+    header.table_count = static_cast<uint32_t>(tables_.size());
+    header.name = AddString(name);
+    header.tables_offset = Align(sizeof(BinarySceneHeader));
+
+    uint64_t offset = Align(header.tables_offset +
+                            tables_.size() * sizeof(BinarySceneTable));
+    for (uint32_t i = 0; i < tables_.size(); i++) {
+      tables_[i].offset = offset;
+      offset = Align(offset + table_data_[i].size());
+    }
+
+    header.strings_offset = offset;
+    header.strings_size = strings_.size();
+
+    // write next to the destination and swap so readers never see a
+    // partial file, unique so saves of the same scene do not collide
+    fs::path temp_path = path;
+    temp_path += std::format(".{}.tmp", (uint64_t)UUID());
+
+    std::error_code error;
+    {
+      std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+      if (!file.is_open()) {
+        return false;
+      }
+
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+      WritePadding(file, header.tables_offset);
+      file.write(reinterpret_cast<const char*>(tables_.data()),
+                 tables_.size() * sizeof(BinarySceneTable));
+
+      for (uint32_t i = 0; i < tables_.size(); i++) {
+        WritePadding(file, tables_[i].offset);
+        file.write(reinterpret_cast<const char*>(table_data_[i].data()),
+                   table_data_[i].size());
+      }
+
+      WritePadding(file, header.strings_offset);
+      file.write(strings_.data(), strings_.size());
+
+      if (!file.good()) {
+        file.close();
+        fs::remove(temp_path, error);
+        return false;
+      }
+    }
+
+    fs::rename(temp_path, path, error);
+    if (error) {
+      fs::remove(temp_path, error);
+      return false;
+    }
+
+    return true;
+  }
+
+ private:
+  std::vector<BinarySceneTable> tables_;
+  std::vector<std::vector<uint8_t>> table_data_;
+  std::string strings_;
+};
+
+/**
+ * @brief Validated view of a mapped binary scene.
+ */
+class BinarySceneReader {
+ public:
+  bool Open(const fs::path& path) {
+    file_ = MappedFile::Open(path);
+    if (!file_) {
+      return false;
+    }
+
+    const uint64_t file_size = file_->GetSize();
+    if (file_size < sizeof(BinarySceneHeader)) {
+      return false;
+    }
+
+    header_ = file_->As<BinarySceneHeader>();
+    if (!std::equal(header_->magic, header_->magic + 4, kBinarySceneMagic) ||
+        header_->version != kBinarySceneVersion) {
+      return false;
+    }
+
+    if (!IsInFile(header_->tables_offset, header_->table_count,
+                  sizeof(BinarySceneTable)) ||
+        !IsInFile(header_->strings_offset, header_->strings_size, 1)) {
+      return false;
+    }
+
+    tables_ = {file_->As<BinarySceneTable>(header_->tables_offset),
+               header_->table_count};
+
+    for (const BinarySceneTable& table : tables_) {
+      if (table.record_size == 0 ||
+          !IsInFile(table.offset, table.record_count, table.record_size)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * @return Records of the table or an empty span if it is missing or of an
+   * other record layout, in which case the reader is marked as corrupted.
+   */
+  template <typename Record>
+  [[nodiscard]] std::span<const Record> GetTable(SceneTableType type) {
+    for (const BinarySceneTable& table : tables_) {
+      if (table.type != static_cast<uint32_t>(type)) {
+        continue;
+      }
+
+      if (table.record_size != sizeof(Record)) {
+        is_corrupted_ = true;
+        return {};
+      }
+
+      return {file_->As<Record>(table.offset), table.record_count};
+    }
+
+    return {};
+  }
+
+  [[nodiscard]] std::string GetString(const BinaryString& string) {
+    if (string.offset > header_->strings_size ||
+        string.size > header_->strings_size - string.offset) {
+      is_corrupted_ = true;
+      return "";
+    }
+
+    return std::string(
+        file_->As<char>(header_->strings_offset + string.offset), string.size);
+  }
+
+  [[nodiscard]] std::string GetName() { return GetString(header_->name); }
+
+  [[nodiscard]] bool IsCorrupted() const { return is_corrupted_; }
+
+ private:
+  [[nodiscard]] bool IsInFile(uint64_t offset, uint64_t count,
+                              uint64_t element_size) const {
+    const uint64_t file_size = file_->GetSize();
+    return offset <= file_size && count <= (file_size - offset) / element_size;
+  }
+
+ private:
+  Ref<MappedFile> file_;
+  const BinarySceneHeader* header_ = nullptr;
+  std::span<const BinarySceneTable> tables_;
+  bool is_corrupted_ = false;
+};
+
+/**
+ * @brief Calls @p func for every record of @p type belonging to an existing
+ * entity.
+ */
+template <typename Record, typename Func>
+static void ForEachRecord(
+    BinarySceneReader& reader, SceneTableType type,
+    const std::unordered_map<uint64_t, entt::entity>& entities, Func func) {
+  for (const Record& record : reader.GetTable<Record>(type)) {
+    const auto it = entities.find(record.entity);
+    if (it != entities.end()) {
+      func(it->second, record);
+    }
+  }
+}
+
+fs::path GetBinaryScenePath(const fs::path& scene_path) {
+  fs::path binary_path = scene_path;
+  binary_path += kBinarySceneExtension;
+  return binary_path;
+}
+
+bool IsBinarySceneUpToDate(const fs::path& scene_path,
+                           const fs::path& binary_path) {
+  std::error_code error;
+  if (!fs::exists(binary_path, error)) {
+    return false;
+  }
+
+  if (!fs::exists(scene_path, error)) {
+    return true;
+  }
+
+  return fs::last_write_time(binary_path, error) >=
+         fs::last_write_time(scene_path, error);
+}
+
+BinarySceneSerializer::BinarySceneSerializer(const Ref<Scene>& scene)
+    : scene_(scene) {}
+
+bool BinarySceneSerializer::Serialize(const fs::path& file_path) {
+  entt::registry& registry = scene_->registry_;
+
+  BinarySceneWriter writer;
+
+  {
+    std::vector<EntityRecord> records;
+    records.reserve(scene_->entity_map_.size());
+
+    // same order with the json serializer so children keep their order
+    registry.view<entt::entity>().each([&](auto entity_id) {
+      if (!registry.all_of<IdComponent, TagComponent, RelationComponent>(
+              entity_id)) {
+        return;
+      }
+
+      EntityRecord& record = records.emplace_back();
+      record.id = registry.get<IdComponent>(entity_id).id;
+      record.parent_id = registry.get<RelationComponent>(entity_id).parent_id;
+      record.tag = writer.AddString(registry.get<TagComponent>(entity_id).tag);
+    });
+
+    writer.AddTable(SceneTableType::kEntity, records);
+  }
+
+  {
+    std::vector<TransformRecord> records;
+    registry.view<IdComponent, Transform>().each(
+        [&](const IdComponent& id, const Transform& tc) {
+          TransformRecord& record = records.emplace_back();
+          record.entity = id.id;
+          record.position = tc.local_position;
+          record.rotation = tc.local_rotation;
+          record.scale = tc.local_scale;
+        });
+
+    writer.AddTable(SceneTableType::kTransform, records);
+  }
+
+  {
+    std::vector<CameraRecord> records;
+    registry.view<IdComponent, CameraComponent>().each(
+        [&](const IdComponent& id, const CameraComponent& camera) {
+          CameraRecord& record = records.emplace_back();
+          record.entity = id.id;
+          record.ortho_aspect_ratio = camera.ortho_camera.aspect_ratio;
+          record.ortho_zoom_level = camera.ortho_camera.zoom_level;
+          record.ortho_near_clip = camera.ortho_camera.near_clip;
+          record.ortho_far_clip = camera.ortho_camera.far_clip;
+          record.persp_aspect_ratio = camera.persp_camera.aspect_ratio;
+          record.persp_fov = camera.persp_camera.fov;
+          record.persp_near_clip = camera.persp_camera.near_clip;
+          record.persp_far_clip = camera.persp_camera.far_clip;
+          record.is_orthographic = camera.is_orthographic;
+          record.is_primary = camera.is_primary;
+          record.is_fixed_aspect_ratio = camera.is_fixed_aspect_ratio;
+        });
+
+    writer.AddTable(SceneTableType::kCamera, records);
+  }
+
+  {
+    std::vector<SpriteRendererRecord> records;
+    registry.view<IdComponent, SpriteRendererComponent>().each(
+        [&](const IdComponent& id, const SpriteRendererComponent& sprite) {
+          SpriteRendererRecord& record = records.emplace_back();
+          record.entity = id.id;
+          record.texture = sprite.texture;
+          record.color = sprite.color;
+          record.tex_tiling = sprite.tex_tiling;
+        });
+
+    writer.AddTable(SceneTableType::kSpriteRenderer, records);
+  }
+
+  {
+    std::vector<ModelRecord> records;
+    registry.view<IdComponent, ModelComponent>().each(
+        [&](const IdComponent& id, const ModelComponent& model) {
+          ModelRecord& record = records.emplace_back();
+          record.entity = id.id;
+          record.model = model.model;
+        });
+
+    writer.AddTable(SceneTableType::kModel, records);
+  }
+
+  {
+    std::vector<MaterialRecord> records;
+    std::vector<MaterialUniformRecord> uniform_records;
+
+    registry.view<IdComponent, Material>().each(
+        [&](const IdComponent& id, const Material& material) {
+          MaterialRecord& record = records.emplace_back();
+          record.entity = id.id;
+          record.shader = material.shader;
+          record.albedo = material.albedo;
+
+          Ref<ShaderInstance> shader_instance =
+              material.shader != 0
+                  ? AssetRegistry::Get<ShaderInstance>(material.shader)
+                  : nullptr;
+          if (!shader_instance) {
+            return;
+          }
+
+          for (const ShaderUniform& uniform : shader_instance->uniforms) {
+            MaterialUniformRecord& uniform_record =
+                uniform_records.emplace_back();
+            uniform_record.entity = id.id;
+            uniform_record.name = writer.AddString(uniform.name);
+            uniform_record.type = static_cast<uint32_t>(uniform.type);
+
+            std::visit(
+                [&](const auto& val) {
+                  using ValueType = std::decay_t<decltype(val)>;
+                  if constexpr (kIsSerializedUniform<ValueType>) {
+                    static_assert(sizeof(ValueType) <= kBinaryValueSize);
+                    std::memcpy(uniform_record.value, &val, sizeof(val));
+                  }
+                },
+                uniform.value);
+          }
+        });
+
+    writer.AddTable(SceneTableType::kMaterial, records);
+    writer.AddTable(SceneTableType::kMaterialUniform, uniform_records);
+  }
+
+  {
+    std::vector<RigidbodyRecord> records;
+    registry.view<IdComponent, Rigidbody>().each(
+        [&](const IdComponent& id, const Rigidbody& rb) {
+          RigidbodyRecord& record = records.emplace_back();
+          record.entity = id.id;
+          record.velocity = rb.velocity;
+          record.acceleration = rb.acceleration;
+          record.mass = rb.mass;
+          record.use_gravity = rb.use_gravity;
+          record.freeze_x = rb.position_constraints.freeze_x;
+          record.freeze_y = rb.position_constraints.freeze_y;
+          record.freeze_z = rb.position_constraints.freeze_z;
+          record.freeze_pitch = rb.rotation_constraints.freeze_pitch;
+          record.freeze_yaw = rb.rotation_constraints.freeze_yaw;
+          record.freeze_roll = rb.rotation_constraints.freeze_roll;
+        });
+
+    writer.AddTable(SceneTableType::kRigidbody, records);
+  }
+
+  {
+    std::vector<BoxColliderRecord> records;
+    registry.view<IdComponent, BoxCollider>().each(
+        [&](const IdComponent& id, const BoxCollider& col) {
+          BoxColliderRecord& record = records.emplace_back();
+          record.entity = id.id;
+          record.local_position = col.local_position;
+          record.local_scale = col.local_scale;
+          record.is_trigger = col.is_trigger;
+        });
+
+    writer.AddTable(SceneTableType::kBoxCollider, records);
+  }
+
+  {
+    std::vector<ScriptRecord> records;
+    std::vector<ScriptFieldRecord> field_records;
+
+    registry.view<IdComponent, ScriptComponent>().each(
+        [&](auto entity_id, const IdComponent& id,
+            const ScriptComponent& sc) {
+          ScriptRecord& record = records.emplace_back();
+          record.entity = id.id;
+          record.class_name = writer.AddString(sc.class_name);
+
+          Ref<ScriptClass> entity_class =
+              ScriptEngine::GetEntityClass(sc.class_name);
+          if (!entity_class) {
+            return;
+          }
+
+          auto& entity_fields =
+              ScriptEngine::GetScriptFieldMap({entity_id, scene_.get()});
+
+          for (const auto& [name, field] : entity_class->GetFields()) {
+            const auto it = entity_fields.find(name);
+            if (it == entity_fields.end()) {
+              continue;
+            }
+
+            ScriptFieldRecord& field_record = field_records.emplace_back();
+            field_record.entity = id.id;
+            field_record.name = writer.AddString(name);
+            field_record.type = static_cast<uint32_t>(field.type);
+
+            const auto data =
+                it->second.GetValue<std::array<uint8_t, kBinaryValueSize>>();
+            std::copy(data.begin(), data.end(), field_record.data);
+          }
+        });
+
+    writer.AddTable(SceneTableType::kScript, records);
+    writer.AddTable(SceneTableType::kScriptField, field_records);
+  }
+
+  return writer.Write(file_path, scene_->name_);
+}
+
+bool BinarySceneSerializer::Deserialize(const fs::path& file_path) {
+  BinarySceneReader reader;
+  if (!reader.Open(file_path)) {
+    EVE_LOG_ENGINE_ERROR("Failed to load binary scene file '{0}'",
+                         file_path.string());
+    return false;
+  }
+
+  entt::registry& registry = scene_->registry_;
+
+  scene_->name_ = reader.GetName();
+  EVE_LOG_ENGINE_TRACE("Deserializing scene: {0}", scene_->name_);
+
+  const auto entity_records =
+      reader.GetTable<EntityRecord>(SceneTableType::kEntity);
+
+  std::unordered_map<uint64_t, entt::entity> entities;
+  entities.reserve(entity_records.size());
+
+  // names are already unique as they are saved from a scene
+  for (const EntityRecord& record : entity_records) {
+    if (record.id == kInvalidUUID || entities.contains(record.id)) {
+      EVE_LOG_ENGINE_ERROR("Binary scene is corrupted: {}",
+                           file_path.string());
+      return false;
+    }
+
+    entities[record.id] =
+        scene_->InsertEntity(record.id, reader.GetString(record.tag));
+  }
+
+  // Create entities before setting parents in order to build parent/child
+  // relations.
+  for (const EntityRecord& record : entity_records) {
+    if (!record.parent_id) {
+      continue;
+    }
+
+    const auto parent = entities.find(record.parent_id);
+    if (parent != entities.end()) {
+      Entity entity = {entities.at(record.id), scene_.get()};
+      entity.SetParent({parent->second, scene_.get()});
+    }
+  }
+
+  ForEachRecord<TransformRecord>(
+      reader, SceneTableType::kTransform, entities,
+      [&](entt::entity entity, const TransformRecord& record) {
+        auto& tc = registry.get<Transform>(entity);
+        tc.local_position = record.position;
+        tc.local_rotation = record.rotation;
+        tc.local_scale = record.scale;
+      });
+
+  ForEachRecord<CameraRecord>(
+      reader, SceneTableType::kCamera, entities,
+      [&](entt::entity entity, const CameraRecord& record) {
+        auto& camera = registry.emplace_or_replace<CameraComponent>(entity);
+        camera.ortho_camera.aspect_ratio = record.ortho_aspect_ratio;
+        camera.ortho_camera.zoom_level = record.ortho_zoom_level;
+        camera.ortho_camera.near_clip = record.ortho_near_clip;
+        camera.ortho_camera.far_clip = record.ortho_far_clip;
+        camera.persp_camera.aspect_ratio = record.persp_aspect_ratio;
+        camera.persp_camera.fov = record.persp_fov;
+        camera.persp_camera.near_clip = record.persp_near_clip;
+        camera.persp_camera.far_clip = record.persp_far_clip;
+        camera.is_orthographic = record.is_orthographic;
+        camera.is_primary = record.is_primary;
+        camera.is_fixed_aspect_ratio = record.is_fixed_aspect_ratio;
+      });
+
+  ForEachRecord<SpriteRendererRecord>(
+      reader, SceneTableType::kSpriteRenderer, entities,
+      [&](entt::entity entity, const SpriteRendererRecord& record) {
+        auto& sprite =
+            registry.emplace_or_replace<SpriteRendererComponent>(entity);
+        sprite.texture = record.texture;
+        sprite.color = record.color;
+        sprite.tex_tiling = record.tex_tiling;
+      });
+
+  ForEachRecord<ModelRecord>(
+      reader, SceneTableType::kModel, entities,
+      [&](entt::entity entity, const ModelRecord& record) {
+        registry.emplace_or_replace<ModelComponent>(entity).model =
+            record.model;
+      });
+
+  ForEachRecord<MaterialRecord>(
+      reader, SceneTableType::kMaterial, entities,
+      [&](entt::entity entity, const MaterialRecord& record) {
+        auto& material = registry.emplace_or_replace<Material>(entity);
+        material.albedo = record.albedo;
+        material.shader = record.shader;
+      });
+
+  ForEachRecord<MaterialUniformRecord>(
+      reader, SceneTableType::kMaterialUniform, entities,
+      [&](entt::entity entity, const MaterialUniformRecord& record) {
+        const Material* material = registry.try_get<Material>(entity);
+        if (!material || material->shader == 0) {
+          return;
+        }
+
+        Ref<ShaderInstance> shader_instance =
+            AssetRegistry::Get<ShaderInstance>(material->shader);
+        if (!shader_instance) {
+          return;
+        }
+
+        ShaderUniform uniform;
+        uniform.name = reader.GetString(record.name);
+        uniform.type = static_cast<ShaderUniformType>(record.type);
+
+        // necessary for std::visit
+        uniform.value = GetDefaultShaderValue(uniform.type);
+        std::visit(
+            [&](auto& val) {
+              using ValueType = std::decay_t<decltype(val)>;
+              if constexpr (kIsSerializedUniform<ValueType>) {
+                std::memcpy(&val, record.value, sizeof(val));
+              }
+            },
+            uniform.value);
+
+        shader_instance->uniforms.push_back(uniform);
+      });
+
+  ForEachRecord<RigidbodyRecord>(
+      reader, SceneTableType::kRigidbody, entities,
+      [&](entt::entity entity, const RigidbodyRecord& record) {
+        auto& rb = registry.emplace_or_replace<Rigidbody>(entity);
+        rb.velocity = record.velocity;
+        rb.acceleration = record.acceleration;
+        rb.mass = record.mass;
+        rb.use_gravity = record.use_gravity;
+        rb.position_constraints = {static_cast<bool>(record.freeze_x),
+                                   static_cast<bool>(record.freeze_y),
+                                   static_cast<bool>(record.freeze_z)};
+        rb.rotation_constraints = {static_cast<bool>(record.freeze_pitch),
+                                   static_cast<bool>(record.freeze_yaw),
+                                   static_cast<bool>(record.freeze_roll)};
+      });
+
+  ForEachRecord<BoxColliderRecord>(
+      reader, SceneTableType::kBoxCollider, entities,
+      [&](entt::entity entity, const BoxColliderRecord& record) {
+        auto& col = registry.emplace_or_replace<BoxCollider>(entity);
+        col.is_trigger = record.is_trigger;
+        col.local_position = record.local_position;
+        col.local_scale = record.local_scale;
+      });
+
+  ForEachRecord<ScriptRecord>(
+      reader, SceneTableType::kScript, entities,
+      [&](entt::entity entity, const ScriptRecord& record) {
+        registry.emplace_or_replace<ScriptComponent>(entity).class_name =
+            reader.GetString(record.class_name);
+      });
+
+  ForEachRecord<ScriptFieldRecord>(
+      reader, SceneTableType::kScriptField, entities,
+      [&](entt::entity entity, const ScriptFieldRecord& record) {
+        const ScriptComponent* sc = registry.try_get<ScriptComponent>(entity);
+        if (!sc) {
+          return;
+        }
+
+        Ref<ScriptClass> entity_class =
+            ScriptEngine::GetEntityClass(sc->class_name);
+        if (!entity_class) {
+          return;
+        }
+
+        const std::string name = reader.GetString(record.name);
+
+        const auto& fields = entity_class->GetFields();
+        const auto field = fields.find(name);
+        if (field == fields.end() ||
+            field->second.type != static_cast<ScriptFieldType>(record.type)) {
+          return;
+        }
+
+        auto& entity_fields =
+            ScriptEngine::GetScriptFieldMap({entity, scene_.get()});
+
+        ScriptFieldInstance& field_instance = entity_fields[name];
+        field_instance.field = field->second;
+
+        std::array<uint8_t, kBinaryValueSize> data;
+        std::copy_n(record.data, kBinaryValueSize, data.begin());
+        field_instance.SetValue(data);
+      });
+
+  if (reader.IsCorrupted()) {
+    EVE_LOG_ENGINE_ERROR("Binary scene is corrupted: {}", file_path.string());
+    return false;
+  }
+
+  return true;
+}
+
+bool ConvertSceneToBinary(const fs::path& json_path,
+                          const fs::path& binary_path) {
+  // converted scenes are never run, so they do not need a state
+  Ref<Scene> scene = CreateRef<Scene>(nullptr);
+
+  SceneSerializer serializer(scene);
+  if (!serializer.Deserialize(json_path)) {
+    return false;
+  }
+
+  BinarySceneSerializer binary_serializer(scene);
+  return binary_serializer.Serialize(binary_path);
+}
+
+bool ConvertSceneToJson(const fs::path& binary_path,
+                        const fs::path& json_path) {
+  Ref<Scene> scene = CreateRef<Scene>(nullptr);
+
+  BinarySceneSerializer binary_serializer(scene);
+  if (!binary_serializer.Deserialize(binary_path)) {
+    return false;
+  }
+
+  SceneSerializer serializer(scene);
+  serializer.Serialize(json_path);
+
+  return true;
+}
+
+}  // namespace eve
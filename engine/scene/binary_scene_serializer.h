@@ -0,0 +1,58 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "scene/scene.h"
+
+namespace eve {
+
+constexpr uint32_t kBinarySceneVersion = 1;
+constexpr const char* kBinarySceneExtension = ".escb";
+
+/**
+ * @brief Binary scene of @p scene_path lives next to it, `level.escn` is
+ * converted into `level.escn.escb`.
+ */
+[[nodiscard]] fs::path GetBinaryScenePath(const fs::path& scene_path);
+
+/**
+ * @brief Binary scene is up to date if it is newer than its json source, or
+ * if the source is not shipped at all.
+ */
+[[nodiscard]] bool IsBinarySceneUpToDate(const fs::path& scene_path,
+                                         const fs::path& binary_path);
+
+/**
+ * @brief Compact alternative of SceneSerializer. Components are stored in
+ * tables, one contiguous array of records per component type keyed by the
+ * entity UUID, so loading is a pass over each table instead of building a
+ * json document of the whole scene.
+ */
+class BinarySceneSerializer {
+ public:
+  BinarySceneSerializer(const Ref<Scene>& scene);
+
+  /**
+   * @return true if the file is written successfully.
+   */
+  bool Serialize(const fs::path& file_path);
+
+  bool Deserialize(const fs::path& file_path);
+
+ private:
+  Ref<Scene> scene_;
+};
+
+/**
+ * @brief Converts a json scene into the binary format, json scenes are the
+ * ones to keep under version control.
+ */
+bool ConvertSceneToBinary(const fs::path& json_path,
+                          const fs::path& binary_path);
+
+bool ConvertSceneToJson(const fs::path& binary_path,
+                        const fs::path& json_path);
+
+}  // namespace eve
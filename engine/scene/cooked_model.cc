@@ -0,0 +1,271 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "scene/cooked_model.h"
+
+#include "core/debug/log.h"
+#include "core/uuid.h"
+
+namespace eve {
+
+// File layout, every blob starts aligned to kCookedModelAlignment and
+// values are stored in the native (little endian) byte order:
+//   CookedModelHeader
+//   CookedMesh[mesh_count]
+//   MeshVertex[vertex_count]
+//   uint32_t[index_count]
+//   char[strings_size]
+
+static constexpr char kCookedModelMagic[4] = {'E', 'M', 'D', 'L'};
+static constexpr uint64_t kCookedModelAlignment = 16;
+
+struct CookedBounds {
+  float min[3];
+  float max[3];
+};
+
+struct CookedModelHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t vertex_size;
+  uint32_t mesh_count;
+  uint64_t vertex_count;
+  uint64_t index_count;
+  uint64_t meshes_offset;
+  uint64_t vertices_offset;
+  uint64_t indices_offset;
+  uint64_t strings_offset;
+  uint64_t strings_size;
+  CookedBounds bounds;
+};
+
+struct CookedMesh {
+  uint64_t first_vertex;
+  uint64_t vertex_count;
+  uint64_t first_index;
+  uint64_t index_count;
+  CookedBounds bounds;
+  // path of the diffuse map relative to the model, empty if there is none
+  uint32_t diffuse_path_offset;
+  uint32_t diffuse_path_size;
+};
+
+static_assert(std::is_trivially_copyable_v<MeshVertex>);
+static_assert(std::is_trivially_copyable_v<CookedModelHeader>);
+static_assert(std::is_trivially_copyable_v<CookedMesh>);
+
+[[nodiscard]] static uint64_t Align(uint64_t offset) {
+  return (offset + kCookedModelAlignment - 1) & ~(kCookedModelAlignment - 1);
+}
+
+[[nodiscard]] static CookedBounds SerializeBounds(const AABB& bounds) {
+  return {{bounds.min.x, bounds.min.y, bounds.min.z},
+          {bounds.max.x, bounds.max.y, bounds.max.z}};
+}
+
+[[nodiscard]] static AABB DeserializeBounds(const CookedBounds& bounds) {
+  return {{bounds.min[0], bounds.min[1], bounds.min[2]},
+          {bounds.max[0], bounds.max[1], bounds.max[2]}};
+}
+
+static void WritePadding(std::ofstream& file, uint64_t offset) {
+  static constexpr char kZeros[kCookedModelAlignment] = {};
+
+  const uint64_t position = static_cast<uint64_t>(file.tellp());
+  file.write(kZeros, offset - position);
+}
+
+fs::path GetCookedModelPath(const fs::path& source_path) {
+  fs::path cooked_path = source_path;
+  cooked_path += kCookedModelExtension;
+  return cooked_path;
+}
+
+bool IsCookedModelUpToDate(const fs::path& source_path,
+                           const fs::path& cooked_path) {
+  std::error_code error;
+  if (!fs::exists(cooked_path, error)) {
+    return false;
+  }
+
+  if (!fs::exists(source_path, error)) {
+    return true;
+  }
+
+  return fs::last_write_time(cooked_path, error) >=
+         fs::last_write_time(source_path, error);
+}
+
+bool CookModel(const Model& model, const fs::path& path) {
+  CookedModelHeader header = {};
+  std::copy_n(kCookedModelMagic, 4, header.magic);
+  header.version = kCookedModelVersion;
+  header.vertex_size = sizeof(MeshVertex);
+  header.mesh_count = static_cast<uint32_t>(model.meshes.size());
+  header.bounds = SerializeBounds(model.bounds);
+
+  std::vector<CookedMesh> meshes(model.meshes.size());
+  std::string strings;
+
+  for (uint32_t i = 0; i < model.meshes.size(); i++) {
+    const MeshData& mesh_data = model.meshes[i];
+
+    CookedMesh& mesh = meshes[i];
+    mesh.first_vertex = header.vertex_count;
+    mesh.vertex_count = mesh_data.vertices.size();
+    mesh.first_index = header.index_count;
+    mesh.index_count = mesh_data.indices.size();
+    mesh.bounds = SerializeBounds(mesh_data.bounds);
+
+    if (!mesh_data.diffuse_path.empty()) {
+      const std::string diffuse_path =
+          fs::path(mesh_data.diffuse_path).filename().string();
+
+      mesh.diffuse_path_offset = static_cast<uint32_t>(strings.size());
+      mesh.diffuse_path_size = static_cast<uint32_t>(diffuse_path.size());
+      strings += diffuse_path;
+    }
+
+    header.vertex_count += mesh.vertex_count;
+    header.index_count += mesh.index_count;
+  }
+
+  header.meshes_offset = Align(sizeof(CookedModelHeader));
+  header.vertices_offset =
+      Align(header.meshes_offset + meshes.size() * sizeof(CookedMesh));
+  header.indices_offset =
+      Align(header.vertices_offset + header.vertex_count * sizeof(MeshVertex));
+  header.strings_offset =
+      header.indices_offset + header.index_count * sizeof(uint32_t);
+  header.strings_size = strings.size();
+
+  // write next to the destination and swap so readers never see a partial
+  // file, unique so loads of the same model could cook at the same time
+  fs::path temp_path = path;
+  temp_path += std::format(".{}.tmp", (uint64_t)UUID());
+
+  std::error_code error;
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+      return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    WritePadding(file, header.meshes_offset);
+    file.write(reinterpret_cast<const char*>(meshes.data()),
+               meshes.size() * sizeof(CookedMesh));
+
+    WritePadding(file, header.vertices_offset);
+    for (const MeshData& mesh : model.meshes) {
+      file.write(reinterpret_cast<const char*>(mesh.vertices.data()),
+                 mesh.vertices.size_bytes());
+    }
+
+    WritePadding(file, header.indices_offset);
+    for (const MeshData& mesh : model.meshes) {
+      file.write(reinterpret_cast<const char*>(mesh.indices.data()),
+                 mesh.indices.size_bytes());
+    }
+
+    file.write(strings.data(), strings.size());
+
+    if (!file.good()) {
+      file.close();
+      fs::remove(temp_path, error);
+      return false;
+    }
+  }
+
+  fs::rename(temp_path, path, error);
+  if (error) {
+    fs::remove(temp_path, error);
+    return false;
+  }
+
+  return true;
+}
+
+Ref<Model> LoadCookedModel(const fs::path& path) {
+  Ref<MappedFile> file = MappedFile::Open(path);
+  if (!file) {
+    EVE_LOG_ENGINE_ERROR("Unable to open cooked model: {}", path.string());
+    return nullptr;
+  }
+
+  const uint64_t file_size = file->GetSize();
+
+  const auto is_in_file = [file_size](uint64_t offset, uint64_t count,
+                                      uint64_t element_size) {
+    return offset <= file_size && count <= (file_size - offset) / element_size;
+  };
+
+  if (file_size < sizeof(CookedModelHeader)) {
+    EVE_LOG_ENGINE_ERROR("Cooked model is corrupted: {}", path.string());
+    return nullptr;
+  }
+
+  const CookedModelHeader& header = *file->As<CookedModelHeader>();
+  if (!std::equal(header.magic, header.magic + 4, kCookedModelMagic) ||
+      header.version != kCookedModelVersion ||
+      header.vertex_size != sizeof(MeshVertex)) {
+    EVE_LOG_ENGINE_ERROR("Cooked model is of an unsupported version: {}",
+                         path.string());
+    return nullptr;
+  }
+
+  if (!is_in_file(header.meshes_offset, header.mesh_count,
+                  sizeof(CookedMesh)) ||
+      !is_in_file(header.vertices_offset, header.vertex_count,
+                  sizeof(MeshVertex)) ||
+      !is_in_file(header.indices_offset, header.index_count,
+                  sizeof(uint32_t)) ||
+      !is_in_file(header.strings_offset, header.strings_size, 1)) {
+    EVE_LOG_ENGINE_ERROR("Cooked model is corrupted: {}", path.string());
+    return nullptr;
+  }
+
+  const CookedMesh* meshes = file->As<CookedMesh>(header.meshes_offset);
+  const MeshVertex* vertices = file->As<MeshVertex>(header.vertices_offset);
+  const uint32_t* indices = file->As<uint32_t>(header.indices_offset);
+  const char* strings = file->As<char>(header.strings_offset);
+
+  // textures are referenced relative to the source model
+  const fs::path directory = path.parent_path();
+
+  Ref<Model> model = CreateRef<Model>();
+  model->bounds = DeserializeBounds(header.bounds);
+  model->meshes.reserve(header.mesh_count);
+
+  for (uint32_t i = 0; i < header.mesh_count; i++) {
+    const CookedMesh& mesh = meshes[i];
+
+    if (mesh.first_vertex > header.vertex_count ||
+        mesh.vertex_count > header.vertex_count - mesh.first_vertex ||
+        mesh.first_index > header.index_count ||
+        mesh.index_count > header.index_count - mesh.first_index ||
+        mesh.diffuse_path_offset > header.strings_size ||
+        mesh.diffuse_path_size >
+            header.strings_size - mesh.diffuse_path_offset) {
+      EVE_LOG_ENGINE_ERROR("Cooked model is corrupted: {}", path.string());
+      return nullptr;
+    }
+
+    MeshData& mesh_data = model->meshes.emplace_back();
+    mesh_data.vertices = {vertices + mesh.first_vertex, mesh.vertex_count};
+    mesh_data.indices = {indices + mesh.first_index, mesh.index_count};
+    mesh_data.bounds = DeserializeBounds(mesh.bounds);
+
+    if (mesh.diffuse_path_size > 0) {
+      const std::string diffuse_path(strings + mesh.diffuse_path_offset,
+                                     mesh.diffuse_path_size);
+      mesh_data.diffuse_path = (directory / diffuse_path).string();
+    }
+  }
+
+  model->mapped_file = file;
+
+  return model;
+}
+
+}  // namespace eve
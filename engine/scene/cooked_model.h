@@ -0,0 +1,46 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "scene/model.h"
+
+namespace eve {
+
+constexpr uint32_t kCookedModelVersion = 1;
+constexpr const char* kCookedModelExtension = ".emdl";
+
+/**
+ * @brief Cooked model of @p source_path lives next to it, `model.fbx` is
+ * cooked into `model.fbx.emdl`.
+ */
+[[nodiscard]] fs::path GetCookedModelPath(const fs::path& source_path);
+
+/**
+ * @brief Cooked model is up to date if it is newer than its source, or if
+ * the source is not shipped at all.
+ */
+[[nodiscard]] bool IsCookedModelUpToDate(const fs::path& source_path,
+                                         const fs::path& cooked_path);
+
+/**
+ * @brief Writes meshes of @p model into a versioned binary file. Vertices
+ * and indices are stored as single blobs in their in memory layout so they
+ * can be used directly from the mapped file.
+ *
+ * @return true if the file is written successfully.
+ */
+bool CookModel(const Model& model, const fs::path& path);
+
+/**
+ * @brief Maps a cooked model file, meshes point into the mapped memory
+ * instead of copying it. Only texture paths are resolved, see
+ * Model::LoadTextures.
+ *
+ * @return Ref<Model> loaded model or @c nullptr if the file is missing,
+ * corrupted or of an other version.
+ */
+[[nodiscard]] Ref<Model> LoadCookedModel(const fs::path& path);
+
+}  // namespace eve
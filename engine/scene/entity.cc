@@ -54,6 +54,8 @@ void Entity::SetParent(Entity parent) {
   transform.local_scale = transform.GetScale() / parent_transform.GetScale();
 
   transform.parent = &parent_transform;
+
+  GetComponent<WorldTransform>().dirty = true;
 }
 
 bool Entity::IsParent() {
@@ -90,6 +92,7 @@ bool Entity::RemoveChild(Entity child) {
     child_transform.local_scale = child_transform.GetScale();
 
     child_transform.parent = nullptr;
+    child.GetComponent<WorldTransform>().dirty = true;
 
     // move child to top level
     child.GetRelation().parent_id = kInvalidUUID;
@@ -131,10 +134,42 @@ const std::string& Entity::GetName() {
   return GetComponent<TagComponent>().tag;
 }
 
+void Entity::SetName(const std::string& name) {
+  scene_->RenameEntity(*this, name);
+}
+
 Transform& Entity::GetTransform() {
   return GetComponent<Transform>();
 }
 
+const WorldTransform& Entity::GetWorldTransform() {
+  UpdateWorldTransform();
+  return GetComponent<WorldTransform>();
+}
+
+bool Entity::UpdateWorldTransform() {
+  Entity parent = GetParent();
+  const bool parent_updated = parent && parent.UpdateWorldTransform();
+
+  WorldTransform& world = GetComponent<WorldTransform>();
+  const Transform& transform = GetTransform();
+  if (!parent_updated && !world.IsOutdated(transform)) {
+    return false;
+  }
+
+  world.Update(transform,
+               parent ? &parent.GetComponent<WorldTransform>() : nullptr);
+
+  // siblings on the way are not visited, TransformSystem updates them
+  for (const UUID& child_id : GetRelation().children_ids) {
+    if (Entity child = scene_->TryGetEntityByUUID(child_id); child) {
+      child.GetComponent<WorldTransform>().dirty = true;
+    }
+  }
+
+  return true;
+}
+
 Entity::operator bool() const {
   return entity_handle_ != entt::null || scene_ != nullptr;
 }
@@ -70,8 +70,20 @@ class Entity {
 
   [[nodiscard]] const std::string& GetName();
 
+  /**
+   * @brief Renames the entity, the name is used as is even if it is not
+   * unique.
+   */
+  void SetName(const std::string& name);
+
   [[nodiscard]] Transform& GetTransform();
 
+  /**
+   * @brief World values of the entity, only the entity and its ancestors
+   * are recalculated if they have changed since TransformSystem has run.
+   */
+  [[nodiscard]] const WorldTransform& GetWorldTransform();
+
   operator bool() const;
 
   operator entt::entity() const;
@@ -82,6 +94,12 @@ class Entity {
 
   [[nodiscard]] bool operator!=(const Entity& other) const;
 
+ private:
+  /**
+   * @return Whether the world transform is recalculated.
+   */
+  bool UpdateWorldTransform();
+
  private:
   entt::entity entity_handle_{entt::null};
   Scene* scene_ = nullptr;
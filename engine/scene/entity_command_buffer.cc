@@ -0,0 +1,100 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "scene/entity_command_buffer.h"
+
+namespace eve {
+
+EntityCommandBuffer::EntityCommandBuffer(Scene* scene) : scene_(scene) {}
+
+UUID EntityCommandBuffer::CreateEntity(const EntityCreateInfo& info,
+                                       std::function<void(Entity)> on_created) {
+  const UUID entity_id;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  commands_.push_back({CommandType::kCreate, entity_id, info.parent_id,
+                       info.name, std::move(on_created)});
+
+  return entity_id;
+}
+
+void EntityCommandBuffer::DestroyEntity(UUID entity_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  destroyed_entities_.push_back(entity_id);
+}
+
+void EntityCommandBuffer::AddComponent(
+    UUID entity_id, std::function<void(Entity)> add_component) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  commands_.push_back({CommandType::kAddComponent, entity_id, kInvalidUUID,
+                       "", std::move(add_component)});
+}
+
+void EntityCommandBuffer::SetParent(UUID entity_id, UUID parent_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  commands_.push_back({CommandType::kSetParent, entity_id, parent_id});
+}
+
+void EntityCommandBuffer::Playback() {
+  std::vector<Command> commands;
+  std::vector<UUID> destroyed_entities;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    commands.swap(commands_);
+    destroyed_entities.swap(destroyed_entities_);
+  }
+
+  for (auto& command : commands) {
+    if (command.type == CommandType::kCreate) {
+      Entity entity = scene_->CreateEntityWithUUID(
+          command.entity_id, {std::move(command.name), command.parent_id});
+      if (command.callback) {
+        command.callback(entity);
+      }
+      continue;
+    }
+
+    Entity entity = scene_->TryGetEntityByUUID(command.entity_id);
+    if (!entity) {
+      continue;
+    }
+
+    switch (command.type) {
+      case CommandType::kAddComponent:
+        command.callback(entity);
+        break;
+      case CommandType::kSetParent: {
+        // a destroyed parent should not unparent the entity
+        Entity parent = scene_->TryGetEntityByUUID(command.parent_id);
+        if (command.parent_id && !parent) {
+          break;
+        }
+
+        entity.SetParent(parent);
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  if (destroyed_entities.empty()) {
+    return;
+  }
+
+  std::vector<Entity> entities;
+  entities.reserve(destroyed_entities.size());
+  for (UUID entity_id : destroyed_entities) {
+    if (Entity entity = scene_->TryGetEntityByUUID(entity_id); entity) {
+      entities.push_back(entity);
+    }
+  }
+
+  scene_->DestroyEntities(entities);
+}
+
+bool EntityCommandBuffer::IsEmpty() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return commands_.empty() && destroyed_entities_.empty();
+}
+
+}  // namespace eve
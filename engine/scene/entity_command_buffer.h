@@ -0,0 +1,84 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "core/uuid.h"
+#include "scene/entity.h"
+#include "scene/scene.h"
+
+namespace eve {
+
+/**
+ * @brief Records structural changes of a scene to be applied at once, so they
+ * could be requested while iterating the registry or from worker threads.
+ * Entities are referenced by UUID so ones created by the buffer can be used
+ * before the playback.
+ */
+class EntityCommandBuffer {
+ public:
+  EntityCommandBuffer(Scene* scene);
+
+  EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+  EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+  /**
+   * @brief Reserves a UUID for the entity to be created.
+   * @param on_created called right after the entity is created, e.g. to set
+   * its transform.
+   */
+  UUID CreateEntity(const EntityCreateInfo& info = {},
+                    std::function<void(Entity)> on_created = nullptr);
+
+  /**
+   * @brief Destroys the entity with its children, destroys are applied after
+   * every other command in a single batch.
+   */
+  void DestroyEntity(UUID entity_id);
+
+  template <typename T>
+    requires(!std::is_invocable_v<T, Entity>)
+  void AddComponent(UUID entity_id, T component = {}) {
+    AddComponent(entity_id, [component = std::move(component)](Entity entity) {
+      entity.AddOrReplaceComponent<T>(component);
+    });
+  }
+
+  /**
+   * @brief Runs @p add_component for the entity, used when the component type
+   * is not known at compile time.
+   */
+  void AddComponent(UUID entity_id, std::function<void(Entity)> add_component);
+
+  void SetParent(UUID entity_id, UUID parent_id);
+
+  /**
+   * @brief Applies the commands in the order they are recorded, commands of
+   * entities that no longer exist are skipped.
+   */
+  void Playback();
+
+  [[nodiscard]] bool IsEmpty();
+
+ private:
+  enum class CommandType { kCreate, kAddComponent, kSetParent };
+
+  struct Command {
+    CommandType type;
+    UUID entity_id;
+    // parent of created entities or the new parent
+    UUID parent_id = kInvalidUUID;
+    std::string name;
+    std::function<void(Entity)> callback;
+  };
+
+  Scene* scene_;
+
+  // commands could be recorded from parallel systems and scripts
+  std::mutex mutex_;
+  std::vector<Command> commands_;
+  std::vector<UUID> destroyed_entities_;
+};
+
+}  // namespace eve
@@ -2,175 +2,155 @@
 
 #include "scene/model.h"
 
-#include <assimp/postprocess.h>
-#include <assimp/scene.h>
-#include <assimp/Importer.hpp>
-
-#include "asset/asset_registry.h"
 #include "core/debug/log.h"
+#include "graphics/primitives/cube.h"
 #include "graphics/texture.h"
+#include "scene/cooked_model.h"
 
-namespace eve {
+#if EVE_ENABLE_MODEL_IMPORTER
+#include "scene/model_importer.h"
+#endif
 
-static std::vector<Ref<Texture>> loaded_textures{};
+namespace eve {
 
-static Ref<Texture> LoadMaterialTextures(aiMaterial* mat, aiTextureType type,
-                                         TextureType tex_type,
-                                         fs::path directory);
+// not owned so textures are released with the last model using them
+static std::unordered_map<std::string, std::weak_ptr<Texture>>
+    loaded_textures{};
 
 Ref<Model> Model::Create(const fs::path& path) {
-  Ref<Model> model = CreateRef<Model>();
+  Ref<Model> model = CreateWithoutTextures(path);
+  if (model) {
+    model->LoadTextures();
+  }
+  return model;
+}
 
-  Assimp::Importer importer;
-  const aiScene* scene = importer.ReadFile(
-      path.string(), aiProcess_Triangulate | aiProcess_GenSmoothNormals |
-                         aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
+Ref<Model> Model::CreateWithoutTextures(const fs::path& path) {
+  if (path.extension() == kCookedModelExtension) {
+    return LoadCookedModel(path);
+  }
 
-  if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE ||
-      !scene->mRootNode) {
-    EVE_LOG_ENGINE_ERROR("Unable to load model: {}", importer.GetErrorString());
-    return nullptr;
+  const fs::path cooked_path = GetCookedModelPath(path);
+  if (IsCookedModelUpToDate(path, cooked_path)) {
+    if (Ref<Model> model = LoadCookedModel(cooked_path)) {
+      return model;
+    }
   }
 
-  model->directory_ = path.parent_path();
+#if EVE_ENABLE_MODEL_IMPORTER
+  Ref<Model> model = ImportModel(path);
+  if (!model) {
+    return nullptr;
+  }
 
-  // process ASSIMP's root node recursively
-  model->ProcessNode(scene->mRootNode, scene);
+  // cook at import time so following loads skip the importer
+  if (!CookModel(*model, cooked_path)) {
+    EVE_LOG_ENGINE_WARNING("Unable to cook model to: {}",
+                           cooked_path.string());
+  }
 
   return model;
+#else
+  EVE_LOG_ENGINE_ERROR(
+      "Model is not cooked and the importer is not available: {}",
+      path.string());
+  return nullptr;
+#endif
 }
 
-void Model::ProcessNode(aiNode* node, const aiScene* scene) {
-  // process each mesh located at the current node
-  for (uint32_t i = 0; i < node->mNumMeshes; i++) {
-    aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-    meshes.push_back(ProcessMesh(mesh, scene));
-  }
-
-  for (uint32_t i = 0; i < node->mNumChildren; i++) {
-    ProcessNode(node->mChildren[i], scene);
-  }
+size_t Model::GetMemoryUsage() const {
+  // textures are shared between models so they are not counted
+  return vertex_storage.size() * sizeof(MeshVertex) +
+         index_storage.size() * sizeof(uint32_t) +
+         (mapped_file ? mapped_file->GetSize() : 0);
 }
 
-MeshData Model::ProcessMesh(aiMesh* mesh, const aiScene* scene) {
-  std::vector<MeshVertex> vertices;
-
-  // walk through each of the mesh's vertices
-  for (uint32_t i = 0; i < mesh->mNumVertices; i++) {
-    MeshVertex vertex;
-    glm::vec4 vector;
-
-    // positions
-    vector.x = mesh->mVertices[i].x;
-    vector.y = mesh->mVertices[i].y;
-    vector.z = mesh->mVertices[i].z;
-    vector.w = 1.0f;
-
-    vertex.position = vector;
-
-    // normals
-    if (mesh->HasNormals()) {
-      vector.x = mesh->mNormals[i].x;
-      vector.y = mesh->mNormals[i].y;
-      vector.z = mesh->mNormals[i].z;
-      vector.w = mesh->mNormals[i].z;
-      vertex.normal = vector;
+std::unordered_map<std::string, TextureImage> Model::DecodeTextures() const {
+  std::unordered_map<std::string, TextureImage> images;
+  for (const MeshData& mesh : meshes) {
+    if (mesh.diffuse_path.empty() || images.contains(mesh.diffuse_path)) {
+      continue;
     }
 
-    // texture coordinates
-    if (mesh->mTextureCoords[0]) {
-      glm::vec2 vec;
-      // a vertex can contain up to 8 different texture coordinates. We thus make the assumption that we won't
-      // use models where a vertex can have multiple texture coordinates so we always take the first set (0).
-      vec.x = mesh->mTextureCoords[0][i].x;
-      vec.y = mesh->mTextureCoords[0][i].y;
-      vertex.tex_coords = vec;
-
-      // TODO
-      // // tangent
-      // vector.x = mesh->mTangents[i].x;
-      // vector.y = mesh->mTangents[i].y;
-      // vector.z = mesh->mTangents[i].z;
-      // vertex.Tangent = vector;
-      // // bitangent
-      // vector.x = mesh->mBitangents[i].x;
-      // vector.y = mesh->mBitangents[i].y;
-      // vector.z = mesh->mBitangents[i].z;
-      // vertex.Bitangent = vector;
-    } else {
-      vertex.tex_coords = glm::vec2(0.0f, 0.0f);
+    TextureImage image;
+    if (LoadTextureImage(mesh.diffuse_path, image, TextureType::kDiffuse,
+                         true)) {
+      images[mesh.diffuse_path] = image;
     }
-
-    vertices.push_back(vertex);
   }
+  return images;
+}
 
-  std::vector<uint32_t> indices;
-
-  for (uint32_t i = 0; i < mesh->mNumFaces; i++) {
-    aiFace face = mesh->mFaces[i];
+void Model::LoadTextures(
+    const std::unordered_map<std::string, TextureImage>& images) {
+  for (MeshData& mesh : meshes) {
+    if (mesh.diffuse_path.empty() || mesh.diffuse_map) {
+      continue;
+    }
 
-    // retrieve all indices of the face and store them in the indices vector
-    for (uint32_t j = 0; j < face.mNumIndices; j++)
-      indices.push_back(face.mIndices[j]);
+    const auto it = images.find(mesh.diffuse_path);
+    mesh.diffuse_map = LoadModelTexture(
+        mesh.diffuse_path, it != images.end() ? &it->second : nullptr);
   }
+}
 
-  aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
-  // we assume a convention for sampler names in the shaders. Each diffuse texture should be named
-  // as 'texture_diffuseN' where N is a sequential number ranging from 1 to MAX_SAMPLER_NUMBER.
-  // Same applies to other texture as the following list summarizes:
-  // diffuse: texture_diffuseN
-  // specular: texture_specularN
-  // normal: texture_normalN
-
-  MeshData render_data;
-  render_data.vertices = vertices;
-  render_data.indices = indices;
-
-  render_data.diffuse_map = LoadMaterialTextures(
-      material, aiTextureType_DIFFUSE, TextureType::kDiffuse, directory_);
-
-  // render_data.specular_map = LoadMaterialTextures(
-  //     material, aiTextureType_SPECULAR, TextureType::kSpecular, directory_);
-
-  // render_data.normal_map = LoadMaterialTextures(
-  //     material, aiTextureType_HEIGHT, TextureType::kNormal, directory_);
-
-  // render_data.height_map = LoadMaterialTextures(
-  //     material, aiTextureType_AMBIENT, TextureType::kHeight, directory_);
+Ref<Model> Model::CreateCube() {
+  static const glm::vec3 face_normals[] = {
+      {0.0f, 0.0f, 1.0f},  {0.0f, 0.0f, -1.0f}, {-1.0f, 0.0f, 0.0f},
+      {1.0f, 0.0f, 0.0f},  {0.0f, 1.0f, 0.0f},  {0.0f, -1.0f, 0.0f},
+  };
 
-  return render_data;
-}
+  Ref<Model> model = CreateRef<Model>();
+  model->vertex_storage.resize(kCubeVertexCount);
+  model->index_storage.reserve(kCubeIndexCount);
+
+  for (uint32_t i = 0; i < kCubeVertexCount; i++) {
+    MeshVertex& vertex = model->vertex_storage[i];
+    vertex.position = kCubeVertexPositions[i];
+    vertex.albedo = kColorWhite;
+    vertex.normal = face_normals[i / 4];
+    vertex.tex_coords = kCubeVertexTexCoords[i];
+  }
 
-Ref<Texture> LoadMaterialTextures(aiMaterial* mat, aiTextureType type,
-                                  TextureType tex_type, fs::path directory) {
-  if (mat->GetTextureCount(type) <= 0) {
-    return nullptr;
+  // every face is a quad
+  for (uint32_t offset = 0; offset < kCubeVertexCount; offset += 4) {
+    model->index_storage.insert(
+        model->index_storage.end(),
+        {offset + 0, offset + 1, offset + 2, offset + 2, offset + 3,
+         offset + 0});
   }
 
-  // TODO multiple textures
-  // for(unsigned int i = 0; i < mat->GetTextureCount(type); i++)
-  // mat->GetTexture(type, i, &str);
+  MeshData mesh;
+  mesh.vertices = model->vertex_storage;
+  mesh.indices = model->index_storage;
+  mesh.bounds = {glm::vec3(-0.5f), glm::vec3(0.5f)};
 
-  aiString str;
-  mat->GetTexture(type, 0, &str);
+  model->meshes.push_back(mesh);
+  model->bounds = mesh.bounds;
 
-  fs::path file_path = directory / fs::path(str.C_Str()).filename();
+  return model;
+}
 
-  // check if texture was loaded before and if so, continue to next iteration: skip loading a new texture
-  const auto it = std::find_if(loaded_textures.begin(), loaded_textures.end(),
-                               [file_path](const Ref<Texture>& texture) {
-                                 return texture->path == file_path;
-                               });
+Ref<Texture> LoadModelTexture(const fs::path& path, const TextureImage* image) {
+  const std::string path_string = path.string();
 
+  // check if texture was loaded before to skip loading it again
+  const auto it = loaded_textures.find(path_string);
   if (it != loaded_textures.end()) {
-    return *it;
+    if (Ref<Texture> texture = it->second.lock()) {
+      return texture;
+    }
+  }
+
+  Ref<Texture> texture = image ? Texture::Create(*image)
+                               : Texture::Create(path, TextureType::kDiffuse);
+  if (!texture) {
+    return nullptr;
   }
 
-  // if texture hasn't been loaded already, load it
-  Ref<Texture> texture = Texture::Create(file_path, tex_type);
+  texture->path = path_string;
 
-  // store it as texture loaded for entire model, to ensure we won't unnecessary load duplicate textures.
-  loaded_textures.push_back(texture);
+  loaded_textures[path_string] = texture;
 
   return texture;
 }
@@ -5,11 +5,9 @@
 #include "pch_shared.h"
 
 #include "asset/asset.h"
+#include "core/mapped_file.h"
 #include "graphics/primitives/mesh.h"
-
-struct aiNode;
-struct aiMesh;
-struct aiScene;
+#include "graphics/texture.h"
 
 namespace eve {
 
@@ -19,17 +17,56 @@ struct Model : Asset {
   std::vector<MeshData> meshes;
   std::vector<AssetHandle> textures;
 
+  // local space bounds of all meshes
+  AABB bounds;
+
+  // memory the meshes point into, imported models own their vertices and
+  // indices while cooked ones keep their file mapped
+  std::vector<MeshVertex> vertex_storage;
+  std::vector<uint32_t> index_storage;
+  Ref<MappedFile> mapped_file;
+
+  size_t GetMemoryUsage() const override;
+
+  /**
+   * @brief Loads the cooked model of @p path if it is up to date, otherwise
+   * imports the source and cooks it for the next time.
+   */
   static Ref<Model> Create(const fs::path& path);
 
- private:
-  void ProcessNode(aiNode* node, const aiScene* scene);
+  /**
+   * @brief Same as Create but leaves the textures of the meshes unloaded,
+   * does not touch the graphics API so it could be called from any thread.
+   */
+  static Ref<Model> CreateWithoutTextures(const fs::path& path);
+
+  /**
+   * @brief Decodes the images referenced by the meshes, could be called
+   * from any thread.
+   */
+  [[nodiscard]] std::unordered_map<std::string, TextureImage> DecodeTextures()
+      const;
 
-  MeshData ProcessMesh(aiMesh* mesh, const aiScene* scene);
+  /**
+   * @brief Creates diffuse maps of the meshes, must be called from the main
+   * thread. Images found in @p images are uploaded without decoding again.
+   */
+  void LoadTextures(
+      const std::unordered_map<std::string, TextureImage>& images = {});
 
- private:
-  fs::path directory_;
+  /**
+   * @brief Unit cube without textures.
+   */
+  [[nodiscard]] static Ref<Model> CreateCube();
 };
 
+/**
+ * @brief Loads a texture referenced by a model, textures shared between
+ * models are only loaded once.
+ */
+[[nodiscard]] Ref<Texture> LoadModelTexture(const fs::path& path,
+                                           const TextureImage* image = nullptr);
+
 struct ModelComponent {
   AssetHandle model = 0;
 };
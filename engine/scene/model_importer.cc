@@ -0,0 +1,124 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "scene/model_importer.h"
+
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include "core/debug/log.h"
+
+namespace eve {
+
+static void CollectMeshes(const aiNode* node, const aiScene* scene,
+                          std::vector<const aiMesh*>& meshes) {
+  // process each mesh located at the current node
+  for (uint32_t i = 0; i < node->mNumMeshes; i++) {
+    meshes.push_back(scene->mMeshes[node->mMeshes[i]]);
+  }
+
+  for (uint32_t i = 0; i < node->mNumChildren; i++) {
+    CollectMeshes(node->mChildren[i], scene, meshes);
+  }
+}
+
+static std::string GetMaterialTexturePath(const aiMaterial* material,
+                                          aiTextureType type,
+                                          const fs::path& directory) {
+  if (material->GetTextureCount(type) <= 0) {
+    return "";
+  }
+
+  // TODO multiple textures
+  aiString str;
+  material->GetTexture(type, 0, &str);
+
+  return (directory / fs::path(str.C_Str()).filename()).string();
+}
+
+Ref<Model> ImportModel(const fs::path& path) {
+  Assimp::Importer importer;
+  const aiScene* scene = importer.ReadFile(
+      path.string(), aiProcess_Triangulate | aiProcess_GenSmoothNormals |
+                         aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
+
+  if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE ||
+      !scene->mRootNode) {
+    EVE_LOG_ENGINE_ERROR("Unable to load model: {}", importer.GetErrorString());
+    return nullptr;
+  }
+
+  std::vector<const aiMesh*> ai_meshes;
+  CollectMeshes(scene->mRootNode, scene, ai_meshes);
+
+  // allocate the storage once and write meshes in place
+  uint64_t vertex_count = 0;
+  uint64_t index_count = 0;
+  for (const aiMesh* ai_mesh : ai_meshes) {
+    vertex_count += ai_mesh->mNumVertices;
+    for (uint32_t i = 0; i < ai_mesh->mNumFaces; i++) {
+      index_count += ai_mesh->mFaces[i].mNumIndices;
+    }
+  }
+
+  Ref<Model> model = CreateRef<Model>();
+  model->vertex_storage.resize(vertex_count);
+  model->index_storage.resize(index_count);
+  model->meshes.reserve(ai_meshes.size());
+
+  const fs::path directory = path.parent_path();
+
+  MeshVertex* vertices = model->vertex_storage.data();
+  uint32_t* indices = model->index_storage.data();
+
+  for (const aiMesh* ai_mesh : ai_meshes) {
+    MeshData mesh;
+
+    for (uint32_t i = 0; i < ai_mesh->mNumVertices; i++) {
+      MeshVertex& vertex = vertices[i];
+
+      const aiVector3D& position = ai_mesh->mVertices[i];
+      vertex.position = {position.x, position.y, position.z, 1.0f};
+      mesh.bounds.Expand(glm::vec3(vertex.position));
+
+      if (ai_mesh->HasNormals()) {
+        const aiVector3D& normal = ai_mesh->mNormals[i];
+        vertex.normal = {normal.x, normal.y, normal.z};
+      }
+
+      // a vertex can contain up to 8 different texture coordinates, we
+      // always take the first set
+      if (ai_mesh->mTextureCoords[0]) {
+        const aiVector3D& tex_coords = ai_mesh->mTextureCoords[0][i];
+        vertex.tex_coords = {tex_coords.x, tex_coords.y};
+      } else {
+        vertex.tex_coords = glm::vec2(0.0f, 0.0f);
+      }
+    }
+
+    uint32_t mesh_index_count = 0;
+    for (uint32_t i = 0; i < ai_mesh->mNumFaces; i++) {
+      const aiFace& face = ai_mesh->mFaces[i];
+      std::copy_n(face.mIndices, face.mNumIndices,
+                  indices + mesh_index_count);
+      mesh_index_count += face.mNumIndices;
+    }
+
+    mesh.vertices = {vertices, ai_mesh->mNumVertices};
+    mesh.indices = {indices, mesh_index_count};
+
+    const aiMaterial* material = scene->mMaterials[ai_mesh->mMaterialIndex];
+    mesh.diffuse_path =
+        GetMaterialTexturePath(material, aiTextureType_DIFFUSE, directory);
+
+    model->bounds.Expand(mesh.bounds);
+    model->meshes.push_back(mesh);
+
+    vertices += ai_mesh->mNumVertices;
+    indices += mesh_index_count;
+  }
+
+  return model;
+}
+
+}  // namespace eve
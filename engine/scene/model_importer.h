@@ -0,0 +1,19 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include "scene/model.h"
+
+namespace eve {
+
+/**
+ * @brief Imports a model from an interchange format (fbx, gltf, obj...)
+ * through Assimp. Only available when built with the model importer, the
+ * runtime loads cooked models instead. Only texture paths are resolved, see
+ * Model::LoadTextures.
+ */
+[[nodiscard]] Ref<Model> ImportModel(const fs::path& path);
+
+}  // namespace eve
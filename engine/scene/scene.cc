@@ -5,14 +5,25 @@
 #include "physics/physics_system.h"
 #include "scene/components.h"
 #include "scene/entity.h"
+#include "scene/entity_command_buffer.h"
 #include "scene/transform.h"
+#include "scene/transform_system.h"
 #include "scripting/script.h"
 #include "scripting/script_engine.h"
 
 namespace eve {
 
-Scene::Scene(Ref<State> state, std::string name) : state_(state), name_(name) {
+Scene::Scene(Ref<State> state, std::string name)
+    : state_(state),
+      command_buffer_(CreateScope<EntityCommandBuffer>(this)),
+      name_(name) {
+  // physics reads world positions of the colliders
+  PushSystem<TransformSystem>();
   PushSystem<PhysicsSystem>();
+
+  // world transforms are ready for rendering after these
+  transform_system_ = PushSystem<TransformSystem>();
+  PushSystem<PhysicsInterpolationSystem>();
 }
 
 Scene::~Scene() {
@@ -66,22 +77,17 @@ bool Scene::OnRuntimeStart() {
 
 void Scene::OnUpdateRuntime(float ds) {
   if (is_paused_ && step_frames_-- <= 0) {
+    // transforms could still be modified from the editor
+    transform_system_->OnUpdate(ds);
     return;
   }
 
-  auto view = registry_.view<ScriptComponent>();
-  for (auto entity_id : view) {
-    Entity entity = {entity_id, this};
-    ScriptEngine::InvokeUpdateEntity(entity, ds);
-  }
+  ScriptEngine::UpdateEntities(ds, state_->job_system.get());
+  command_buffer_->Playback();
 
-  for (auto system : systems_) {
-    if (!system->IsRuntime()) {
-      continue;
-    }
-
-    system->OnUpdate(ds);
-  }
+  BuildSchedulers();
+  runtime_scheduler_.Run(ds, registry_, state_->job_system.get());
+  command_buffer_->Playback();
 }
 
 void Scene::OnRuntimeStop() {
@@ -105,13 +111,9 @@ void Scene::OnRuntimeStop() {
 }
 
 void Scene::OnUpdateEditor(float ds) {
-  for (auto system : systems_) {
-    if (!system->IsEditor()) {
-      continue;
-    }
-
-    system->OnUpdate(ds);
-  }
+  BuildSchedulers();
+  editor_scheduler_.Run(ds, registry_, state_->job_system.get());
+  command_buffer_->Playback();
 }
 
 void Scene::Step(int frames) {
@@ -123,15 +125,8 @@ Entity Scene::CreateEntity(const EntityCreateInfo& info) {
 }
 
 Entity Scene::CreateEntityWithUUID(UUID uuid, const EntityCreateInfo& info) {
-  Entity entity = {registry_.create(), this};
-
-  entity.AddComponent<IdComponent>(uuid);
-  entity.AddComponent<Transform>();
-  entity.AddComponent<RelationComponent>();
-
   // Set an unique tag
-  auto& tag = entity.AddComponent<TagComponent>();
-  tag.tag = GetEntityName(info.name);
+  Entity entity = InsertEntity(uuid, GetEntityName(info.name));
 
   // Set parent if provided.
   if (info.parent_id) {
@@ -141,22 +136,64 @@ Entity Scene::CreateEntityWithUUID(UUID uuid, const EntityCreateInfo& info) {
     }
   }
 
-  entity_map_[uuid] = entity;
-
   return entity;
 }
 
 void Scene::DestroyEntity(Entity entity) {
-  for (auto child : entity.GetChildren()) {
-    DestroyEntity(child);
+  DestroyEntities({entity});
+}
+
+void Scene::DestroyEntities(std::vector<Entity> entities) {
+  // children are destroyed with their parents, vector grows while iterating
+  for (size_t i = 0; i < entities.size(); i++) {
+    for (auto child : entities[i].GetChildren()) {
+      if (child) {
+        entities.push_back(child);
+      }
+    }
   }
 
-  if (IsRunning()) {
-    ScriptEngine::InvokeDestroyEntity(entity);
+  std::vector<entt::entity> handles(entities.begin(), entities.end());
+  std::sort(handles.begin(), handles.end());
+  handles.erase(std::unique(handles.begin(), handles.end()), handles.end());
+
+  const auto is_destroyed = [&](Entity entity) {
+    return std::binary_search(handles.begin(), handles.end(),
+                              static_cast<entt::entity>(entity));
+  };
+
+  for (auto handle : handles) {
+    // scripts could destroy entities from OnDestroy
+    if (!registry_.valid(handle)) {
+      continue;
+    }
+
+    Entity entity = {handle, this};
+
+    if (IsRunning() && entity.HasComponent<ScriptComponent>()) {
+      ScriptEngine::InvokeDestroyEntity(entity);
+    }
+
+    // parents staying alive should not refer to destroyed children
+    if (Entity parent = entity.GetParent(); parent && !is_destroyed(parent)) {
+      std::erase(parent.GetRelation().children_ids, entity.GetUUID());
+    }
+
+    const auto [begin, end] = entity_name_map_.equal_range(entity.GetName());
+    for (auto it = begin; it != end; it++) {
+      if (it->second == handle) {
+        entity_name_map_.erase(it);
+        break;
+      }
+    }
+
+    entity_map_.erase(entity.GetUUID());
   }
 
-  entity_map_.erase(entity.GetUUID());
-  registry_.destroy(entity);
+  std::erase_if(handles, [&](auto handle) { return !registry_.valid(handle); });
+
+  // removes the entities from every pool at once
+  registry_.destroy(handles.begin(), handles.end());
 }
 
 bool Scene::Exists(Entity entity) {
@@ -174,12 +211,18 @@ Entity Scene::TryGetEntityByUUID(UUID uuid) {
   return {};
 }
 
+Entity Scene::TryGetEntityByHandle(entt::entity handle) {
+  // handles carry the version so stale ones are not valid
+  if (registry_.valid(handle)) {
+    return {handle, this};
+  }
+  return {};
+}
+
 Entity Scene::TryGetEntityByName(std::string name) {
-  auto view = registry_.view<TagComponent>();
-  for (auto entity : view) {
-    const TagComponent& tc = view.get<TagComponent>(entity);
-    if (tc.tag == name)
-      return {entity, this};
+  const auto it = entity_name_map_.find(name);
+  if (it != entity_name_map_.end()) {
+    return {it->second, this};
   }
   return {};
 }
@@ -198,63 +241,106 @@ Entity Scene::GetSelectedEntity() {
   return selected_entity_ != nullptr ? *selected_entity_ : kInvalidEntity;
 }
 
+void Scene::RenameEntity(Entity entity, std::string name) {
+  auto& tag = entity.GetComponent<TagComponent>().tag;
+  if (tag == name) {
+    return;
+  }
+
+  const auto [begin, end] = entity_name_map_.equal_range(tag);
+  for (auto it = begin; it != end; it++) {
+    if (it->second == static_cast<entt::entity>(entity)) {
+      entity_name_map_.erase(it);
+      break;
+    }
+  }
+
+  tag = std::move(name);
+  entity_name_map_.emplace(tag, entity);
+}
+
 bool Scene::EntityNameExists(const std::string& name) {
-  const auto it =
-      std::find_if(entity_map_.begin(), entity_map_.end(), [&](auto& pair) {
-        const auto& tag_comp =
-            pair.second.template GetComponent<TagComponent>();
-        return tag_comp.tag == name;
-      });
-  return it != entity_map_.end();
+  return entity_name_map_.find(name) != entity_name_map_.end();
 }
 
 std::string Scene::GetEntityName(const std::string& name) {
-  static int default_counter = 0;
-  if (!name.empty()) {
+  const std::string& base_name = !name.empty() ? name : "Entity";
+  if (!EntityNameExists(base_name)) {
+    return base_name;
+  }
 
-    std::string name_unique = name;
-    int counter = 1;
+  // continue from the last suffix given so spawning many entities with the
+  // same name does not retry every previous one
+  int& counter = entity_name_counters_[base_name];
+  std::string name_unique;
+  do {
+    counter++;
+    name_unique = std::format("{0} ({1})", base_name, counter);
+  } while (EntityNameExists(name_unique));
 
-    while (EntityNameExists(name_unique)) {
-      name_unique = std::format("{0} ({1})", name, counter);
-      counter++;
-    }
+  return name_unique;
+}
 
-    return name_unique;
-  } else if (name.empty() && default_counter == 0) {
-    default_counter++;
+Entity Scene::InsertEntity(UUID uuid, std::string name) {
+  Entity entity = {registry_.create(), this};
 
-    return "Entity";
-  } else {
-    default_counter++;
+  entity.AddComponent<IdComponent>(uuid);
+  entity.AddComponent<Transform>();
+  entity.AddComponent<WorldTransform>();
+  entity.AddComponent<RelationComponent>();
+  entity_name_map_.emplace(name, entity);
+  entity.AddComponent<TagComponent>(std::move(name));
+
+  entity_map_[uuid] = entity;
+
+  return entity;
+}
 
-    return std::format("Entity ({0})", default_counter);
+void Scene::BuildSchedulers() {
+  if (!schedulers_outdated_) {
+    return;
+  }
+
+  std::vector<System*> runtime_systems;
+  std::vector<System*> editor_systems;
+  for (auto system : systems_) {
+    if (system->IsRuntime()) {
+      runtime_systems.push_back(system);
+    }
+    if (system->IsEditor()) {
+      editor_systems.push_back(system);
+    }
   }
+
+  runtime_scheduler_.Build(runtime_systems);
+  editor_scheduler_.Build(editor_systems);
+
+  schedulers_outdated_ = false;
 }
 
+/**
+ * @brief Copies whole component pools, entities must already exist in @p dst
+ * with the same identifiers as in @p src.
+ */
 template <typename... Component>
-static void CopyComponent(
-    entt::registry& dst, entt::registry& src,
-    const std::unordered_map<UUID, entt::entity>& entt_map) {
+static void CopyStorage(entt::registry& dst, entt::registry& src) {
   (
       [&]() {
-        auto view = src.view<Component>();
-        for (auto src_entity : view) {
-          entt::entity dst_entity =
-              entt_map.at(src.get<IdComponent>(src_entity).id);
-
-          auto& src_component = src.get<Component>(src_entity);
-          dst.emplace_or_replace<Component>(dst_entity, src_component);
-        }
+        auto& src_storage = src.storage<Component>();
+        const entt::sparse_set& src_entities = src_storage;
+
+        // both iterators walk the packed arrays in the same order
+        dst.storage<Component>().insert(src_entities.begin(),
+                                        src_entities.end(),
+                                        src_storage.begin());
       }(),
       ...);
 }
 
 template <typename... Component>
-static void CopyComponent(
-    ComponentGroup<Component...>, entt::registry& dst, entt::registry& src,
-    const std::unordered_map<UUID, entt::entity>& entt_map) {
-  CopyComponent<Component...>(dst, src, entt_map);
+static void CopyStorage(ComponentGroup<Component...>, entt::registry& dst,
+                        entt::registry& src) {
+  CopyStorage<Component...>(dst, src);
 }
 
 template <typename... Component>
@@ -278,37 +364,42 @@ Ref<Scene> Scene::Copy(Ref<Scene> src) {
 
   auto& src_scene_registry = src->registry_;
   auto& dst_scene_registry = dst_scene->registry_;
-  std::unordered_map<UUID, entt::entity> entt_map;
 
-  // Create entities in new scene
-  auto id_view = src_scene_registry.view<IdComponent>();
-  for (auto entity_id : id_view) {
-    UUID uuid = src_scene_registry.get<IdComponent>(entity_id).id;
-    const auto& name = src_scene_registry.get<TagComponent>(entity_id).tag;
+  // Create entities with the same identifiers so pools can be copied as is,
+  // names are already unique in the source scene.
+  for (const auto& [uuid, entity] : src->entity_map_) {
+    const entt::entity entity_id =
+        dst_scene_registry.create(static_cast<entt::entity>(entity));
+    EVE_ASSERT_ENGINE(entity_id == static_cast<entt::entity>(entity));
 
-    Entity new_entity =
-        dst_scene->CreateEntityWithUUID(uuid, {name, kInvalidUUID});
-
-    // set parent id but do not set children vectors
-    const auto& relation = src_scene_registry.get<RelationComponent>(entity_id);
-    new_entity.GetRelation().parent_id = relation.parent_id;
-
-    entt_map[uuid] = (entt::entity)new_entity;
+    dst_scene->entity_map_.emplace_hint(dst_scene->entity_map_.end(), uuid,
+                                        Entity{entity_id, dst_scene.get()});
   }
 
-  CopyComponent(AllComponents{}, dst_scene_registry, src_scene_registry,
-                entt_map);
-
-  // set child/parent relations
-  for (auto& [uuid, entity] : dst_scene->entity_map_) {
-    // Set parent entity
-    auto& relation = entity.GetRelation();
-    if (relation.parent_id) {
-      auto parent_entity = dst_scene->TryGetEntityByUUID(relation.parent_id);
-      if (parent_entity) {
-        entity.SetParent(parent_entity);
-      }
+  // identifiers are the same so the name index is still valid
+  dst_scene->entity_name_map_ = src->entity_name_map_;
+  dst_scene->entity_name_counters_ = src->entity_name_counters_;
+
+  CopyStorage<IdComponent, TagComponent, RelationComponent, WorldTransform>(
+      dst_scene_registry, src_scene_registry);
+  CopyStorage(AllComponents{}, dst_scene_registry, src_scene_registry);
+
+  // Copied transforms still point to the parents of the source scene,
+  // relations are copied as well so only the pointers need to be remapped.
+  auto transform_view =
+      dst_scene_registry.view<Transform, const RelationComponent>();
+  for (auto [entity_id, transform, relation] : transform_view.each()) {
+    if (!relation.parent_id) {
+      transform.parent = nullptr;
+      continue;
     }
+
+    const auto it = dst_scene->entity_map_.find(relation.parent_id);
+    transform.parent =
+        it != dst_scene->entity_map_.end()
+            ? &dst_scene_registry.get<Transform>(
+                  static_cast<entt::entity>(it->second))
+            : nullptr;
   }
 
   return dst_scene;
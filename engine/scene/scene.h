@@ -9,10 +9,13 @@
 #include "core/state.h"
 #include "core/uuid.h"
 #include "scene/system.h"
+#include "scene/system_scheduler.h"
 
 namespace eve {
 
 class Entity;
+class EntityCommandBuffer;
+class TransformSystem;
 
 struct EntityCreateInfo {
   std::string name = "";
@@ -48,9 +51,24 @@ class Scene {
 
   void DestroyEntity(Entity entity);
 
+  /**
+   * @brief Destroys the entities and their children in a single pass over
+   * the component pools.
+   */
+  void DestroyEntities(std::vector<Entity> entities);
+
+  /**
+   * @brief Structural changes recorded here are applied after scripts and
+   * systems are updated.
+   */
+  [[nodiscard]] EntityCommandBuffer& GetCommandBuffer() {
+    return *command_buffer_;
+  }
+
   [[nodiscard]] bool Exists(Entity entity);
 
   [[nodiscard]] Entity TryGetEntityByUUID(UUID uuid);
+  [[nodiscard]] Entity TryGetEntityByHandle(entt::entity handle);
   [[nodiscard]] Entity TryGetEntityByName(std::string name);
 
   [[nodiscard]] Entity GetPrimaryCameraEntity();
@@ -70,19 +88,31 @@ class Scene {
   // Systems
   template <typename T, typename... Args>
     requires std::is_base_of_v<System, T>
-  void PushSystem(Args&&... args) {
+  T* PushSystem(Args&&... args) {
     T* system = new T(std::forward<Args>(args)...);
     system->scene_ = this;
     systems_.push_back(system);
+    schedulers_outdated_ = true;
+    return system;
   }
 
   static Ref<Scene> Copy(Ref<Scene> other);
 
  private:
+  /**
+   * @brief Creates an entity without making its name unique or setting its
+   * parent, used when names are known to be unique like saved scenes.
+   */
+  Entity InsertEntity(UUID uuid, std::string name);
+
+  void RenameEntity(Entity entity, std::string name);
+
   bool EntityNameExists(const std::string& name);
 
   [[nodiscard]] std::string GetEntityName(const std::string& name);
 
+  void BuildSchedulers();
+
  private:
   Ref<State> state_;
 
@@ -90,7 +120,19 @@ class Scene {
   entt::registry registry_;
   std::map<UUID, Entity> entity_map_;
 
+  // names are not guaranteed to be unique, e.g. renamed from the editor
+  std::unordered_multimap<std::string, entt::entity> entity_name_map_;
+  // next suffix to try for each base name when making names unique
+  std::unordered_map<std::string, int> entity_name_counters_;
+
+  Scope<EntityCommandBuffer> command_buffer_;
+
   std::vector<System*> systems_;
+  TransformSystem* transform_system_;
+
+  SystemScheduler runtime_scheduler_;
+  SystemScheduler editor_scheduler_;
+  bool schedulers_outdated_ = true;
 
   // scene properties
   std::string name_;
@@ -101,6 +143,7 @@ class Scene {
 
   Entity* selected_entity_{nullptr};
 
+  friend class BinarySceneSerializer;
   friend class Entity;
   friend class HierarchyPanel;
   friend class SceneSerializer;
@@ -4,6 +4,10 @@
 
 #include "asset/asset_registry.h"
 #include "core/instance.h"
+#include "graphics/material.h"
+#include "scene/components.h"
+#include "scene/binary_scene_serializer.h"
+#include "scene/model.h"
 #include "scene/scene_serializer.h"
 
 namespace eve {
@@ -14,15 +18,71 @@ struct SceneManagerData {
   Ref<Scene> active_scene = nullptr;
   uint32_t active_index = 0;
   std::string active_path = "";
+
+  // assets acquired for the active scene
+  std::vector<AssetHandle> active_assets;
+
+  bool use_binary_scenes = false;
 };
 
 static SceneManagerData scene_data = {};
 
+static std::vector<AssetHandle> CollectSceneAssets(Scene& scene) {
+  std::unordered_set<AssetHandle> handles;
+
+  auto sprite_view = scene.GetAllEntitiesWith<SpriteRendererComponent>();
+  for (auto entity : sprite_view) {
+    handles.insert(sprite_view.get<SpriteRendererComponent>(entity).texture);
+  }
+
+  auto model_view = scene.GetAllEntitiesWith<ModelComponent>();
+  for (auto entity : model_view) {
+    handles.insert(model_view.get<ModelComponent>(entity).model);
+  }
+
+  auto material_view = scene.GetAllEntitiesWith<Material>();
+  for (auto entity : material_view) {
+    handles.insert(material_view.get<Material>(entity).shader);
+  }
+
+  handles.erase(0);
+
+  return {handles.begin(), handles.end()};
+}
+
+static bool DeserializeScene(Ref<Scene> scene, const fs::path& path) {
+  if (!scene_data.use_binary_scenes) {
+    SceneSerializer serializer(scene);
+    return serializer.Deserialize(path);
+  }
+
+  const fs::path binary_path = GetBinaryScenePath(path);
+  if (IsBinarySceneUpToDate(path, binary_path)) {
+    BinarySceneSerializer serializer(scene);
+    return serializer.Deserialize(binary_path);
+  }
+
+  SceneSerializer serializer(scene);
+  if (!serializer.Deserialize(path)) {
+    return false;
+  }
+
+  // convert for the next time, the json scene is already loaded
+  BinarySceneSerializer binary_serializer(scene);
+  if (!binary_serializer.Serialize(binary_path)) {
+    EVE_LOG_ENGINE_WARNING("Unable to write binary scene to: {}",
+                           binary_path.string());
+  }
+
+  return true;
+}
+
 void SceneManager::Init(Ref<Project> project) {
   scene_data.project = project;
   scene_data.active_scene = {};
   scene_data.active_index = 0;
   scene_data.active_path = "";
+  scene_data.active_assets.clear();
 }
 
 void SceneManager::SetActive(const uint32_t index) {
@@ -33,19 +93,37 @@ void SceneManager::SetActive(const uint32_t index) {
       scene_data.project->GetConfig().scenes[scene_data.active_index];
 
   Ref<Scene> new_scene = CreateRef<Scene>(Instance::Get().GetState());
-  SceneSerializer serializer(new_scene);
-  EVE_ASSERT_ENGINE(serializer.Deserialize(GetActivePath()));
+  EVE_ASSERT_ENGINE(DeserializeScene(new_scene, GetActivePath()));
+
+  // start loading the assets of the new scene right away
+  std::vector<AssetHandle> new_assets = CollectSceneAssets(*new_scene);
+  for (const AssetHandle& handle : new_assets) {
+    AssetRegistry::Acquire(handle);
+  }
+
+  const auto swap_assets = [new_assets]() {
+    // scripts of the previous scene are stopped by now
+    AssetRegistry::ReleaseRetrieved();
+
+    for (const AssetHandle& handle : scene_data.active_assets) {
+      AssetRegistry::Release(handle);
+    }
+    scene_data.active_assets = new_assets;
+  };
 
   // If scene is running enque the change to the next frame
   if (scene_data.active_scene && scene_data.active_scene->IsRunning()) {
     // Perform the scene change on the next frame
-    Instance::Get().EnqueueMain([new_scene]() {
+    Instance::Get().EnqueueMain([new_scene, swap_assets]() {
       scene_data.active_scene->OnRuntimeStop();
+      // before starting, so assets retrieved by the new scene are kept
+      swap_assets();
       new_scene->OnRuntimeStart();
       scene_data.active_scene = new_scene;
     });
   } else {
     scene_data.active_scene = new_scene;
+    swap_assets();
   }
 }
 
@@ -53,6 +131,14 @@ bool SceneManager::DoesIndexExists(const uint32_t index) {
   return scene_data.project->GetConfig().scenes.size() > index;
 }
 
+void SceneManager::SetUseBinaryScenes(bool use_binary_scenes) {
+  scene_data.use_binary_scenes = use_binary_scenes;
+}
+
+bool SceneManager::IsUsingBinaryScenes() {
+  return scene_data.use_binary_scenes;
+}
+
 const uint32_t SceneManager::GetRegisteredSceneCount() {
   return scene_data.project->GetConfig().scenes.size();
 }
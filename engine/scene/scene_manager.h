@@ -24,6 +24,14 @@ class SceneManager {
 
   static bool DoesIndexExists(uint32_t index);
 
+  /**
+   * @brief Load scenes from their binary form, json scenes are converted on
+   * first load if their binary form is missing or outdated.
+   */
+  static void SetUseBinaryScenes(bool use_binary_scenes);
+
+  [[nodiscard]] static bool IsUsingBinaryScenes();
+
   [[nodiscard]] static const uint32_t GetRegisteredSceneCount();
 
   [[nodiscard]] static Ref<Scene>& GetActive();
@@ -286,237 +286,400 @@ void SceneSerializer::Serialize(const fs::path& file_path) {
   fout << scene_json.dump(2);
 }
 
-bool SceneSerializer::Deserialize(const fs::path& file_path) {
-  json data;
-  std::ifstream file(file_path);
-  if (!file.is_open()) {
-    EVE_LOG_ENGINE_ERROR("Failed to load scene file '{0}'", file_path.string());
-    return false;
-  }
-  file >> data;
+static void DeserializeEntity(json& entity_json, Entity entity) {
+  if (auto transform_json = entity_json["transform"];
+      !transform_json.is_null()) {
+    auto& tc = entity.GetComponent<Transform>();
 
-  if (!data.contains("scene")) {
-    return false;
+    tc.local_position = transform_json["position"].get<glm::vec3>();
+    tc.local_rotation = transform_json["rotation"].get<glm::vec3>();
+    tc.local_scale = transform_json["scale"].get<glm::vec3>();
   }
 
-  std::string scene_name = data["scene"].get<std::string>();
-  EVE_LOG_ENGINE_TRACE("Deserializing scene: {0}", scene_name);
+  if (auto camera_comp_json = entity_json["camera_component"];
+      !camera_comp_json.is_null()) {
+    auto& camera_component =
+        entity.AddComponent<CameraComponent>();
+
+    auto ortho_camera_json = camera_comp_json["orthographic_camera"];
+    camera_component.ortho_camera.aspect_ratio =
+        ortho_camera_json["aspect_ratio"].get<float>();
+    camera_component.ortho_camera.zoom_level =
+        ortho_camera_json["zoom_level"].get<float>();
+    camera_component.ortho_camera.near_clip =
+        ortho_camera_json["near_clip"].get<float>();
+    camera_component.ortho_camera.far_clip =
+        ortho_camera_json["far_clip"].get<float>();
+
+    auto persp_camera_json = camera_comp_json["perspective_camera"];
+    camera_component.persp_camera.aspect_ratio =
+        persp_camera_json["aspect_ratio"].get<float>();
+    camera_component.persp_camera.fov = persp_camera_json["fov"].get<float>();
+    camera_component.persp_camera.near_clip =
+        persp_camera_json["near_clip"].get<float>();
+    camera_component.persp_camera.far_clip =
+        persp_camera_json["far_clip"].get<float>();
+
+    camera_component.is_orthographic =
+        camera_comp_json["is_orthographic"].get<bool>();
+    camera_component.is_primary = camera_comp_json["is_primary"].get<bool>();
+    camera_component.is_fixed_aspect_ratio =
+        camera_comp_json["is_fixed_aspect_ratio"].get<bool>();
+  }
 
-  scene_->name_ = scene_name;
+  if (auto sprite_comp_json = entity_json["sprite_component"];
+      !sprite_comp_json.is_null()) {
+    auto& sprite_component =
+        entity.AddComponent<SpriteRendererComponent>();
 
-  if (!data.contains("entities")) {
-    return false;
+    sprite_component.texture = sprite_comp_json["texture"].get<UUID>();
+    sprite_component.color = sprite_comp_json["color"].get<Color>();
+    sprite_component.tex_tiling =
+        sprite_comp_json["tex_tiling"].get<glm::vec2>();
   }
 
-  json entities_json = data["entities"];
+  if (auto model_comp_json = entity_json["model_component"];
+      !model_comp_json.is_null()) {
+    auto& model_component = entity.AddComponent<ModelComponent>();
 
-  // Create entities before adding components in order to build parent/child relations.
-  std::vector<Entity> entities;
-  for (const auto& entity_json : entities_json) {
-    UUID uuid = entity_json["id"].get<UUID>();
-    std::string name = entity_json["tag"].get<std::string>();
-    entities.push_back(
-        scene_->CreateEntityWithUUID(uuid, {name, kInvalidUUID}));
+    model_component.model = model_comp_json["model"].get<UUID>();
   }
 
-  for (uint32_t i = 0; i < entities.size(); i++) {
-    auto& entity_json = entities_json.at(i);
-    auto& deserialing_entity = entities.at(i);
+  if (auto material_json = entity_json["material_component"];
+      !material_json.is_null()) {
+    auto& material = entity.AddComponent<Material>();
 
-    // Set parent entity
-    UUID parent_id = entity_json["parent_id"].get<UUID>();
-    if (parent_id) {
-      auto parent_entity = scene_->TryGetEntityByUUID(parent_id);
-      if (parent_entity) {
-        deserialing_entity.SetParent(parent_entity);
+    material.albedo = material_json["albedo"].get<Color>();
+    if (material_json.contains("shader")) {
+      material.shader = material_json["shader"].get<UUID>();
+    } else {
+      material.shader = 0;
+    }
+
+    Ref<ShaderInstance> shader_instance =
+        material.shader != 0
+            ? AssetRegistry::Get<ShaderInstance>(material.shader)
+            : nullptr;
+    if (shader_instance) {
+      auto uniforms_json = material_json["uniform_fields"];
+      for (const auto& uniform_json : uniforms_json) {
+        ShaderUniform uniform;
+        uniform.name = uniform_json["name"].get<std::string>();
+        uniform.type = ConvertStringToShaderUniformType(
+            uniform_json["type"].get<std::string>());
+
+        // necessary for std::visit
+        uniform.value = GetDefaultShaderValue(uniform.type);
+        std::visit(
+            [&](auto& val) {
+              using ValueType = std::decay_t<decltype(val)>;
+              if constexpr (std::is_same_v<ValueType, float> ||
+                            std::is_same_v<ValueType, glm::vec2> ||
+                            std::is_same_v<ValueType, glm::vec3> ||
+                            std::is_same_v<ValueType, glm::vec4> ||
+                            std::is_same_v<ValueType, int> ||
+                            std::is_same_v<ValueType, bool>) {
+                val = uniform_json["value"].get<ValueType>();
+              }
+            },
+            uniform.value);
+
+        shader_instance->uniforms.push_back(uniform);
       }
     }
+  }
+
+  if (auto rigidbody_json = entity_json["rigidbody"];
+      !rigidbody_json.is_null()) {
+    auto& rb = entity.AddComponent<Rigidbody>();
+
+    rb.velocity = rigidbody_json["velocity"].get<glm::vec3>();
+    rb.acceleration = rigidbody_json["acceleration"].get<glm::vec3>();
+    rb.mass = rigidbody_json["mass"].get<float>();
+    rb.use_gravity = rigidbody_json["use_gravity"].get<bool>();
+    rb.position_constraints = {
+        rigidbody_json["position_constraints"]["freeze_x"].get<bool>(),
+        rigidbody_json["position_constraints"]["freeze_y"].get<bool>(),
+        rigidbody_json["position_constraints"]["freeze_z"].get<bool>()};
+    rb.rotation_constraints = {
+        rigidbody_json["rotation_constraints"]["freeze_pitch"].get<bool>(),
+        rigidbody_json["rotation_constraints"]["freeze_yaw"].get<bool>(),
+        rigidbody_json["rotation_constraints"]["freeze_roll"].get<bool>()};
+  }
+
+  if (auto box_collider_json = entity_json["box_collider"];
+      !box_collider_json.is_null()) {
+    auto& col = entity.AddComponent<BoxCollider>();
+
+    col.is_trigger = box_collider_json["is_trigger"].get<bool>();
+    col.local_position = box_collider_json["local_position"].get<glm::vec3>();
+    col.local_scale = box_collider_json["local_scale"].get<glm::vec3>();
+  }
 
-    if (auto transform_json = entity_json["transform"];
-        !transform_json.is_null()) {
-      auto& tc = deserialing_entity.GetComponent<Transform>();
+  if (auto script_component_json = entity_json["script_component"];
+      !script_component_json.is_null()) {
+    auto& sc = entity.AddComponent<ScriptComponent>();
+
+    sc.class_name = script_component_json["class_name"].get<std::string>();
+
+    auto script_fields_json = script_component_json["script_fields"];
+    if (!script_fields_json.is_null()) {
+      Ref<ScriptClass> entity_class =
+          ScriptEngine::GetEntityClass(sc.class_name);
+      if (entity_class) {
+        const auto& fields = entity_class->GetFields();
+        auto& entity_fields =
+            ScriptEngine::GetScriptFieldMap(entity);
+
+        for (const auto& script_field_json : script_fields_json) {
+          std::string name = script_field_json["name"].get<std::string>();
+          std::string type_string =
+              script_field_json["type"].get<std::string>();
+          ScriptFieldType type = DeserializeScriptField(type_string);
+
+          ScriptFieldInstance& field_instance = entity_fields[name];
+
+          EVE_ASSERT_ENGINE(fields.find(name) != fields.end());
+
+          if (fields.find(name) == fields.end()) {
+            continue;
+          }
 
-      tc.local_position = transform_json["position"].get<glm::vec3>();
-      tc.local_rotation = transform_json["rotation"].get<glm::vec3>();
-      tc.local_scale = transform_json["scale"].get<glm::vec3>();
+          field_instance.field = fields.at(name);
+
+          switch (type) {
+            READ_SCRIPT_FIELD(kFloat, float);
+            READ_SCRIPT_FIELD(kDouble, double);
+            READ_SCRIPT_FIELD(kBool, bool);
+            READ_SCRIPT_FIELD(kChar, char);
+            READ_SCRIPT_FIELD(kByte, int8_t);
+            READ_SCRIPT_FIELD(kShort, int16_t);
+            READ_SCRIPT_FIELD(kInt, int32_t);
+            READ_SCRIPT_FIELD(kLong, int64_t);
+            READ_SCRIPT_FIELD(kUByte, uint8_t);
+            READ_SCRIPT_FIELD(kUShort, uint16_t);
+            READ_SCRIPT_FIELD(kUInt, uint32_t);
+            READ_SCRIPT_FIELD(kULong, uint64_t);
+            READ_SCRIPT_FIELD(kVector2, glm::vec2);
+            READ_SCRIPT_FIELD(kVector3, glm::vec3);
+            READ_SCRIPT_FIELD(kVector4, glm::vec4);
+            READ_SCRIPT_FIELD(kColor, Color);
+            READ_SCRIPT_FIELD(kEntity, UUID);
+            default:
+              break;
+          }
+        }
+      }
     }
+  }
+}
+
+/**
+ * @brief Streams a scene file, only the entity being parsed is kept as a
+ * json value and handed to @p on_entity once it is complete.
+ */
+class SceneSaxHandler final : public nlohmann::json_sax<json> {
+ public:
+  using EntityCallback = std::function<void(json& entity_json)>;
+
+  SceneSaxHandler(EntityCallback on_entity) : on_entity_(on_entity) {}
+
+  bool null() override { return AddValue(nullptr); }
+
+  bool boolean(bool val) override { return AddValue(val); }
+
+  bool number_integer(number_integer_t val) override { return AddValue(val); }
+
+  bool number_unsigned(number_unsigned_t val) override {
+    return AddValue(val);
+  }
+
+  bool number_float(number_float_t val, const string_t&) override {
+    return AddValue(val);
+  }
 
-    if (auto camera_comp_json = entity_json["camera_component"];
-        !camera_comp_json.is_null()) {
-      auto& camera_component =
-          deserialing_entity.AddComponent<CameraComponent>();
-
-      auto ortho_camera_json = camera_comp_json["orthographic_camera"];
-      camera_component.ortho_camera.aspect_ratio =
-          ortho_camera_json["aspect_ratio"].get<float>();
-      camera_component.ortho_camera.zoom_level =
-          ortho_camera_json["zoom_level"].get<float>();
-      camera_component.ortho_camera.near_clip =
-          ortho_camera_json["near_clip"].get<float>();
-      camera_component.ortho_camera.far_clip =
-          ortho_camera_json["far_clip"].get<float>();
-
-      auto persp_camera_json = camera_comp_json["perspective_camera"];
-      camera_component.persp_camera.aspect_ratio =
-          persp_camera_json["aspect_ratio"].get<float>();
-      camera_component.persp_camera.fov = persp_camera_json["fov"].get<float>();
-      camera_component.persp_camera.near_clip =
-          persp_camera_json["near_clip"].get<float>();
-      camera_component.persp_camera.far_clip =
-          persp_camera_json["far_clip"].get<float>();
-
-      camera_component.is_orthographic =
-          camera_comp_json["is_orthographic"].get<bool>();
-      camera_component.is_primary = camera_comp_json["is_primary"].get<bool>();
-      camera_component.is_fixed_aspect_ratio =
-          camera_comp_json["is_fixed_aspect_ratio"].get<bool>();
+  bool string(string_t& val) override {
+    if (entity_stack_.empty() && depth_ == 1 && key_ == "scene") {
+      scene_name_ = val;
+      has_scene_ = true;
+      return true;
     }
+    return AddValue(val);
+  }
 
-    if (auto sprite_comp_json = entity_json["sprite_component"];
-        !sprite_comp_json.is_null()) {
-      auto& sprite_component =
-          deserialing_entity.AddComponent<SpriteRendererComponent>();
+  bool binary(binary_t& val) override { return AddValue(val); }
+
+  bool start_object(std::size_t) override {
+    if (!entity_stack_.empty()) {
+      entity_stack_.push_back(AddChild(json::object()));
+      return true;
+    }
 
-      sprite_component.texture = sprite_comp_json["texture"].get<UUID>();
-      sprite_component.color = sprite_comp_json["color"].get<Color>();
-      sprite_component.tex_tiling =
-          sprite_comp_json["tex_tiling"].get<glm::vec2>();
+    // each object in the entities array is an entity
+    if (in_entities_ && depth_ == 2) {
+      entity_ = json::object();
+      entity_stack_.push_back(&entity_);
+      return true;
     }
 
-    if (auto model_comp_json = entity_json["model_component"];
-        !model_comp_json.is_null()) {
-      auto& model_component = deserialing_entity.AddComponent<ModelComponent>();
+    depth_++;
+    return true;
+  }
 
-      model_component.model = model_comp_json["model"].get<UUID>();
+  bool key(string_t& val) override {
+    if (!entity_stack_.empty()) {
+      entity_key_ = val;
+    } else if (depth_ == 1) {
+      key_ = val;
     }
+    return true;
+  }
 
-    if (auto material_json = entity_json["material_component"];
-        !material_json.is_null()) {
-      auto& material = deserialing_entity.AddComponent<Material>();
+  bool end_object() override {
+    if (!entity_stack_.empty()) {
+      entity_stack_.pop_back();
 
-      material.albedo = material_json["albedo"].get<Color>();
-      if (material_json.contains("shader")) {
-        material.shader = material_json["shader"].get<UUID>();
-      } else {
-        material.shader = 0;
+      if (entity_stack_.empty()) {
+        on_entity_(entity_);
+        entity_ = nullptr;
       }
+      return true;
+    }
 
-      Ref<ShaderInstance> shader_instance =
-          material.shader != 0
-              ? AssetRegistry::Get<ShaderInstance>(material.shader)
-              : nullptr;
-      if (shader_instance) {
-        auto uniforms_json = material_json["uniform_fields"];
-        for (const auto& uniform_json : uniforms_json) {
-          ShaderUniform uniform;
-          uniform.name = uniform_json["name"].get<std::string>();
-          uniform.type = ConvertStringToShaderUniformType(
-              uniform_json["type"].get<std::string>());
-
-          // necessary for std::visit
-          uniform.value = GetDefaultShaderValue(uniform.type);
-          std::visit(
-              [&](auto& val) {
-                using ValueType = std::decay_t<decltype(val)>;
-                if constexpr (std::is_same_v<ValueType, float> ||
-                              std::is_same_v<ValueType, glm::vec2> ||
-                              std::is_same_v<ValueType, glm::vec3> ||
-                              std::is_same_v<ValueType, glm::vec4> ||
-                              std::is_same_v<ValueType, int> ||
-                              std::is_same_v<ValueType, bool>) {
-                  val = uniform_json["value"].get<ValueType>();
-                }
-              },
-              uniform.value);
-
-          shader_instance->uniforms.push_back(uniform);
-        }
-      }
+    depth_--;
+    return true;
+  }
+
+  bool start_array(std::size_t) override {
+    if (!entity_stack_.empty()) {
+      entity_stack_.push_back(AddChild(json::array()));
+      return true;
     }
 
-    if (auto rigidbody_json = entity_json["rigidbody"];
-        !rigidbody_json.is_null()) {
-      auto& rb = deserialing_entity.AddComponent<Rigidbody>();
-
-      rb.velocity = rigidbody_json["velocity"].get<glm::vec3>();
-      rb.acceleration = rigidbody_json["acceleration"].get<glm::vec3>();
-      rb.mass = rigidbody_json["mass"].get<float>();
-      rb.use_gravity = rigidbody_json["use_gravity"].get<bool>();
-      rb.position_constraints = {
-          rigidbody_json["position_constraints"]["freeze_x"].get<bool>(),
-          rigidbody_json["position_constraints"]["freeze_y"].get<bool>(),
-          rigidbody_json["position_constraints"]["freeze_z"].get<bool>()};
-      rb.rotation_constraints = {
-          rigidbody_json["rotation_constraints"]["freeze_pitch"].get<bool>(),
-          rigidbody_json["rotation_constraints"]["freeze_yaw"].get<bool>(),
-          rigidbody_json["rotation_constraints"]["freeze_roll"].get<bool>()};
+    depth_++;
+
+    if (depth_ == 2 && key_ == "entities") {
+      in_entities_ = true;
+      has_entities_ = true;
     }
+    return true;
+  }
 
-    if (auto box_collider_json = entity_json["box_collider"];
-        !box_collider_json.is_null()) {
-      auto& col = deserialing_entity.AddComponent<BoxCollider>();
+  bool end_array() override {
+    if (!entity_stack_.empty()) {
+      entity_stack_.pop_back();
+      return true;
+    }
 
-      col.is_trigger = box_collider_json["is_trigger"].get<bool>();
-      col.local_position = box_collider_json["local_position"].get<glm::vec3>();
-      col.local_scale = box_collider_json["local_scale"].get<glm::vec3>();
+    if (depth_ == 2) {
+      in_entities_ = false;
     }
 
-    if (auto script_component_json = entity_json["script_component"];
-        !script_component_json.is_null()) {
-      auto& sc = deserialing_entity.AddComponent<ScriptComponent>();
-
-      sc.class_name = script_component_json["class_name"].get<std::string>();
-
-      auto script_fields_json = script_component_json["script_fields"];
-      if (!script_fields_json.is_null()) {
-        Ref<ScriptClass> entity_class =
-            ScriptEngine::GetEntityClass(sc.class_name);
-        if (entity_class) {
-          const auto& fields = entity_class->GetFields();
-          auto& entity_fields =
-              ScriptEngine::GetScriptFieldMap(deserialing_entity);
-
-          for (const auto& script_field_json : script_fields_json) {
-            std::string name = script_field_json["name"].get<std::string>();
-            std::string type_string =
-                script_field_json["type"].get<std::string>();
-            ScriptFieldType type = DeserializeScriptField(type_string);
-
-            ScriptFieldInstance& field_instance = entity_fields[name];
-
-            EVE_ASSERT_ENGINE(fields.find(name) != fields.end());
-
-            if (fields.find(name) == fields.end()) {
-              continue;
-            }
-
-            field_instance.field = fields.at(name);
-
-            switch (type) {
-              READ_SCRIPT_FIELD(kFloat, float);
-              READ_SCRIPT_FIELD(kDouble, double);
-              READ_SCRIPT_FIELD(kBool, bool);
-              READ_SCRIPT_FIELD(kChar, char);
-              READ_SCRIPT_FIELD(kByte, int8_t);
-              READ_SCRIPT_FIELD(kShort, int16_t);
-              READ_SCRIPT_FIELD(kInt, int32_t);
-              READ_SCRIPT_FIELD(kLong, int64_t);
-              READ_SCRIPT_FIELD(kUByte, uint8_t);
-              READ_SCRIPT_FIELD(kUShort, uint16_t);
-              READ_SCRIPT_FIELD(kUInt, uint32_t);
-              READ_SCRIPT_FIELD(kULong, uint64_t);
-              READ_SCRIPT_FIELD(kVector2, glm::vec2);
-              READ_SCRIPT_FIELD(kVector3, glm::vec3);
-              READ_SCRIPT_FIELD(kVector4, glm::vec4);
-              READ_SCRIPT_FIELD(kColor, Color);
-              READ_SCRIPT_FIELD(kEntity, UUID);
-              default:
-                break;
-            }
-          }
-        }
-      }
+    depth_--;
+    return true;
+  }
+
+  bool parse_error(std::size_t position, const std::string&,
+                   const nlohmann::detail::exception& ex) override {
+    EVE_LOG_ENGINE_ERROR("Unable to parse scene at {}: {}", position,
+                         ex.what());
+    return false;
+  }
+
+  [[nodiscard]] bool IsValid() const { return has_scene_ && has_entities_; }
+
+  [[nodiscard]] const std::string& GetSceneName() const {
+    return scene_name_;
+  }
+
+ private:
+  template <typename Value>
+  bool AddValue(Value&& value) {
+    // values outside of entities are only read for the scene name
+    if (!entity_stack_.empty()) {
+      AddChild(json(std::forward<Value>(value)));
+    }
+    return true;
+  }
+
+  json* AddChild(json value) {
+    json* parent = entity_stack_.back();
+    if (parent->is_array()) {
+      parent->push_back(std::move(value));
+      return &parent->back();
     }
+
+    json& child = (*parent)[entity_key_];
+    child = std::move(value);
+    return &child;
+  }
+
+ private:
+  EntityCallback on_entity_;
+
+  // containers entered outside of an entity, 1 is the root object
+  uint32_t depth_ = 0;
+  std::string key_;
+  bool in_entities_ = false;
+
+  // entity being parsed and the containers entered in it
+  json entity_;
+  std::vector<json*> entity_stack_;
+  std::string entity_key_;
+
+  std::string scene_name_;
+  bool has_scene_ = false;
+  bool has_entities_ = false;
+};
+
+bool SceneSerializer::Deserialize(const fs::path& file_path) {
+  std::ifstream file(file_path);
+  if (!file.is_open()) {
+    EVE_LOG_ENGINE_ERROR("Failed to load scene file '{0}'", file_path.string());
+    return false;
+  }
+
+  // parents could be serialized after their children, relations are built
+  // once every entity is created
+  std::vector<std::pair<UUID, UUID>> parent_ids;
+
+  SceneSaxHandler handler([&](json& entity_json) {
+    UUID uuid = entity_json["id"].get<UUID>();
+    std::string name = entity_json["tag"].get<std::string>();
+
+    Entity entity = scene_->CreateEntityWithUUID(uuid, {name, kInvalidUUID});
+
+    UUID parent_id = entity_json["parent_id"].get<UUID>();
+    if (parent_id) {
+      parent_ids.emplace_back(uuid, parent_id);
+    }
+
+    DeserializeEntity(entity_json, entity);
+  });
+
+  if (!json::sax_parse(file, &handler) || !handler.IsValid()) {
+    return false;
+  }
+
+  scene_->name_ = handler.GetSceneName();
+  EVE_LOG_ENGINE_TRACE("Deserializing scene: {0}", scene_->name_);
+
+  for (const auto& [uuid, parent_id] : parent_ids) {
+    Entity entity = scene_->TryGetEntityByUUID(uuid);
+    Entity parent_entity = scene_->TryGetEntityByUUID(parent_id);
+    if (!parent_entity) {
+      continue;
+    }
+
+    // serialized transforms are already relative to the parent
+    Transform& transform = entity.GetTransform();
+    const Transform local_transform = transform;
+
+    entity.SetParent(parent_entity);
+
+    transform.local_position = local_transform.local_position;
+    transform.local_rotation = local_transform.local_rotation;
+    transform.local_scale = local_transform.local_scale;
   }
 
   return true;
@@ -18,4 +18,34 @@ bool System::IsSimulation() {
   return (run_type_ & SystemRunType_kSimulation) != 0;
 }
 
+static bool Intersects(const auto& lhs, const auto& rhs) {
+  for (const auto& lhs_access : lhs) {
+    for (const auto& rhs_access : rhs) {
+      if (lhs_access.id == rhs_access.id) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool System::ConflictsWith(const System& other) const {
+  if (!access_declared_ || !other.access_declared_) {
+    return true;
+  }
+
+  return Intersects(writes_, other.writes_) ||
+         Intersects(writes_, other.reads_) ||
+         Intersects(reads_, other.writes_);
+}
+
+void System::AssureStorages(entt::registry& registry) const {
+  for (const auto& access : reads_) {
+    access.assure_storage(registry);
+  }
+  for (const auto& access : writes_) {
+    access.assure_storage(registry);
+  }
+}
+
 }  // namespace eve
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #include "pch_shared.h"
 
+#include <entt/entt.hpp>
+
 namespace eve {
 
 class Scene;
@@ -17,7 +19,7 @@ enum SystemRunType : uint16_t {
 class System {
  public:
   System(uint16_t run_type);
-  ~System() = default;
+  virtual ~System() = default;
 
   [[nodiscard]] bool IsRuntime();
 
@@ -25,6 +27,14 @@ class System {
 
   [[nodiscard]] bool IsSimulation();
 
+  /**
+   * @brief Whether two systems could not be run at the same time, systems
+   * which did not declare their components conflict with every system.
+   */
+  [[nodiscard]] bool ConflictsWith(const System& other) const;
+
+  [[nodiscard]] bool IsMainThreadOnly() const { return main_thread_only_; }
+
  protected:
   virtual void OnStart() {}
 
@@ -34,11 +44,51 @@ class System {
 
   [[nodiscard]] Scene* GetScene() { return scene_; }
 
+  // Component access declarations, should be called from constructors
+  template <typename... Components>
+  void Reads() {
+    (reads_.push_back(ComponentAccess::Create<Components>()), ...);
+    access_declared_ = true;
+  }
+
+  template <typename... Components>
+  void Writes() {
+    (writes_.push_back(ComponentAccess::Create<Components>()), ...);
+    access_declared_ = true;
+  }
+
+  /**
+   * @brief Prevents system to be run from worker threads, for systems
+   * calling into scripts or graphics API.
+   */
+  void SetMainThreadOnly() { main_thread_only_ = true; }
+
+ private:
+  struct ComponentAccess {
+    entt::id_type id;
+    // creates the storage so it won't be created from worker threads
+    void (*assure_storage)(entt::registry&);
+
+    template <typename T>
+    static ComponentAccess Create() {
+      return {entt::type_hash<T>::value(),
+              [](entt::registry& registry) { registry.storage<T>(); }};
+    }
+  };
+
+  void AssureStorages(entt::registry& registry) const;
+
  private:
   Scene* scene_;
   uint16_t run_type_ = SystemRunType_kRuntime;
 
+  std::vector<ComponentAccess> reads_;
+  std::vector<ComponentAccess> writes_;
+  bool access_declared_ = false;
+  bool main_thread_only_ = false;
+
   friend class Scene;
+  friend class SystemScheduler;
 };
 
 }  // namespace eve
@@ -0,0 +1,96 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "scene/system_scheduler.h"
+
+namespace eve {
+
+void SystemScheduler::Build(const std::vector<System*>& systems) {
+  nodes_.clear();
+  nodes_.resize(systems.size());
+
+  for (uint32_t i = 0; i < systems.size(); i++) {
+    Node& node = nodes_[i];
+    node.system = systems[i];
+
+    for (uint32_t j = 0; j < i; j++) {
+      if (!systems[j]->ConflictsWith(*systems[i])) {
+        continue;
+      }
+
+      nodes_[j].dependents.push_back(i);
+      node.dependency_count++;
+    }
+  }
+
+  remaining_dependencies_ =
+      CreateScope<std::atomic<uint32_t>[]>(nodes_.size());
+}
+
+void SystemScheduler::Run(float ds, entt::registry& registry,
+                          JobSystem* job_system) {
+  if (!job_system || nodes_.size() <= 1) {
+    for (Node& node : nodes_) {
+      node.system->OnUpdate(ds);
+    }
+    return;
+  }
+
+  job_system_ = job_system;
+
+  for (uint32_t i = 0; i < nodes_.size(); i++) {
+    nodes_[i].system->AssureStorages(registry);
+    remaining_dependencies_[i].store(nodes_[i].dependency_count);
+  }
+
+  unfinished_count_.store(static_cast<uint32_t>(nodes_.size()));
+
+  for (uint32_t i = 0; i < nodes_.size(); i++) {
+    if (nodes_[i].dependency_count == 0) {
+      Enqueue(i, ds);
+    }
+  }
+
+  std::vector<uint32_t> ready_nodes;
+  while (unfinished_count_.load(std::memory_order_acquire) > 0) {
+    {
+      std::scoped_lock<std::mutex> lock(main_thread_queue_mutex_);
+      ready_nodes.swap(main_thread_queue_);
+    }
+
+    if (ready_nodes.empty()) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    for (uint32_t index : ready_nodes) {
+      RunNode(index, ds);
+    }
+    ready_nodes.clear();
+  }
+}
+
+void SystemScheduler::Enqueue(uint32_t index, float ds) {
+  if (nodes_[index].system->IsMainThreadOnly()) {
+    std::scoped_lock<std::mutex> lock(main_thread_queue_mutex_);
+    main_thread_queue_.push_back(index);
+    return;
+  }
+
+  job_system_->Submit([this, index, ds]() { RunNode(index, ds); });
+}
+
+void SystemScheduler::RunNode(uint32_t index, float ds) {
+  Node& node = nodes_[index];
+  node.system->OnUpdate(ds);
+
+  for (uint32_t dependent : node.dependents) {
+    if (remaining_dependencies_[dependent].fetch_sub(
+            1, std::memory_order_acq_rel) == 1) {
+      Enqueue(dependent, ds);
+    }
+  }
+
+  unfinished_count_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+}  // namespace eve
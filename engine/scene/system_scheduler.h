@@ -0,0 +1,63 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include <entt/entt.hpp>
+
+#include "core/job_system.h"
+#include "scene/system.h"
+
+namespace eve {
+
+/**
+ * @brief Runs systems whose component accesses do not conflict in parallel.
+ * Conflicting systems keep the order they were given in.
+ */
+class SystemScheduler {
+ public:
+  SystemScheduler() = default;
+
+  SystemScheduler(const SystemScheduler&) = delete;
+  SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+  /**
+   * @brief Builds the dependency graph, every system depends on the
+   * previous ones it conflicts with.
+   */
+  void Build(const std::vector<System*>& systems);
+
+  /**
+   * @brief Updates the systems, runs serially if @p job_system is null.
+   */
+  void Run(float ds, entt::registry& registry, JobSystem* job_system);
+
+  [[nodiscard]] uint32_t GetDependencyCount(uint32_t index) const {
+    return nodes_[index].dependency_count;
+  }
+
+ private:
+  void Enqueue(uint32_t index, float ds);
+
+  void RunNode(uint32_t index, float ds);
+
+ private:
+  struct Node {
+    System* system;
+    std::vector<uint32_t> dependents;
+    uint32_t dependency_count = 0;
+  };
+
+  std::vector<Node> nodes_;
+
+  // per frame state
+  JobSystem* job_system_ = nullptr;
+  Scope<std::atomic<uint32_t>[]> remaining_dependencies_;
+  std::atomic<uint32_t> unfinished_count_{0};
+
+  std::mutex main_thread_queue_mutex_;
+  std::vector<uint32_t> main_thread_queue_;
+};
+
+}  // namespace eve
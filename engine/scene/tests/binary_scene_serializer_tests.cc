@@ -0,0 +1,106 @@
+#include "catch2/catch_all.hpp"
+
+#include "scene/binary_scene_serializer.h"
+#include "scene/components.h"
+#include "scene/entity.h"
+#include "scene/scene_serializer.h"
+
+using namespace eve;
+
+static Ref<Scene> CreateTestScene(uint32_t entity_count) {
+  Ref<Scene> scene = CreateRef<Scene>(CreateRef<State>(), "test");
+
+  for (uint32_t i = 0; i < entity_count; i++) {
+    Entity entity =
+        scene->CreateEntityWithUUID(i + 1, {std::format("entity {}", i)});
+    entity.GetTransform().local_position = {float(i), 1.0f, 2.0f};
+
+    if (i % 2 == 0) {
+      auto& sprite = entity.AddComponent<SpriteRendererComponent>();
+      sprite.color = {0.5f, 0.25f, 1.0f, 1.0f};
+    }
+
+    if (i % 3 == 0) {
+      auto& rb = entity.AddComponent<Rigidbody>();
+      rb.mass = 2.0f;
+      rb.position_constraints.freeze_y = true;
+    }
+  }
+
+  return scene;
+}
+
+TEST_CASE("BinarySceneSerializer round trip", "[BinarySceneSerializer]") {
+  const fs::path path = fs::temp_directory_path() / "eve_binary_scene.escb";
+
+  Ref<Scene> scene = CreateTestScene(8);
+
+  Entity parent = scene->TryGetEntityByUUID(1);
+  Entity child = scene->CreateEntityWithUUID(100, {"child", parent.GetUUID()});
+  child.GetTransform().local_scale = {2.0f, 2.0f, 2.0f};
+
+  BinarySceneSerializer serializer(scene);
+  REQUIRE(serializer.Serialize(path));
+
+  Ref<Scene> loaded_scene = CreateRef<Scene>(CreateRef<State>());
+  BinarySceneSerializer loaded_serializer(loaded_scene);
+  REQUIRE(loaded_serializer.Deserialize(path));
+
+  REQUIRE(loaded_scene->GetName() == "test");
+  REQUIRE(loaded_scene->GetAllEntities().size() ==
+          scene->GetAllEntities().size());
+
+  for (auto& [uuid, entity] : scene->GetAllEntities()) {
+    Entity loaded_entity = loaded_scene->TryGetEntityByUUID(uuid);
+    REQUIRE(loaded_entity);
+    REQUIRE(loaded_entity.GetName() == entity.GetName());
+
+    const Transform& transform = entity.GetTransform();
+    const Transform& loaded_transform = loaded_entity.GetTransform();
+    REQUIRE(loaded_transform.local_position == transform.local_position);
+    REQUIRE(loaded_transform.local_scale == transform.local_scale);
+
+    REQUIRE(loaded_entity.HasComponent<SpriteRendererComponent>() ==
+            entity.HasComponent<SpriteRendererComponent>());
+    REQUIRE(loaded_entity.HasComponent<Rigidbody>() ==
+            entity.HasComponent<Rigidbody>());
+  }
+
+  Entity loaded_child = loaded_scene->TryGetEntityByUUID(100);
+  REQUIRE(loaded_child.GetParent().GetUUID() == parent.GetUUID());
+  REQUIRE(loaded_child.GetParent().GetRelation().children_ids.size() == 1);
+
+  const auto& rb =
+      loaded_scene->TryGetEntityByUUID(1).GetComponent<Rigidbody>();
+  REQUIRE(rb.mass == 2.0f);
+  REQUIRE(rb.position_constraints.freeze_y);
+
+  fs::remove(path);
+}
+
+TEST_CASE("Scene loading benchmark", "[BinarySceneSerializer][!benchmark]") {
+  const fs::path json_path = fs::temp_directory_path() / "eve_benchmark.escn";
+  const fs::path binary_path = GetBinaryScenePath(json_path);
+
+  Ref<Scene> scene = CreateTestScene(100000);
+
+  SceneSerializer json_serializer(scene);
+  json_serializer.Serialize(json_path);
+
+  REQUIRE(ConvertSceneToBinary(json_path, binary_path));
+
+  BENCHMARK("Load 100k entities from json") {
+    Ref<Scene> loaded_scene = CreateRef<Scene>(CreateRef<State>());
+    SceneSerializer serializer(loaded_scene);
+    return serializer.Deserialize(json_path);
+  };
+
+  BENCHMARK("Load 100k entities from binary") {
+    Ref<Scene> loaded_scene = CreateRef<Scene>(CreateRef<State>());
+    BinarySceneSerializer serializer(loaded_scene);
+    return serializer.Deserialize(binary_path);
+  };
+
+  fs::remove(json_path);
+  fs::remove(binary_path);
+}
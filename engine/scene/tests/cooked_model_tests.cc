@@ -0,0 +1,85 @@
+#include "catch2/catch_all.hpp"
+
+#include "scene/cooked_model.h"
+
+using namespace eve;
+
+static Ref<Model> CreateTestModel() {
+  Ref<Model> model = CreateRef<Model>();
+  model->vertex_storage = {{{0, 0, 0, 1}}, {{1, 0, 0, 1}}, {{0, 1, 0, 1}},
+                           {{0, 0, 1, 1}}};
+  model->index_storage = {0, 1, 2, 0, 2, 3};
+
+  const std::span<const MeshVertex> vertices = model->vertex_storage;
+  const std::span<const uint32_t> indices = model->index_storage;
+
+  MeshData first;
+  first.vertices = vertices.subspan(0, 3);
+  first.indices = indices.subspan(0, 3);
+  first.bounds = {{0, 0, 0}, {1, 1, 0}};
+  model->meshes.push_back(first);
+
+  MeshData second;
+  second.vertices = vertices;
+  second.indices = indices.subspan(3, 3);
+  second.bounds = {{0, 0, 0}, {1, 1, 1}};
+  model->meshes.push_back(second);
+
+  model->bounds = AABB::Merge(first.bounds, second.bounds);
+
+  return model;
+}
+
+TEST_CASE("Cooked models", "[CookedModel]") {
+  const fs::path cooked_path = "test_model.emdl";
+
+  Ref<Model> model = CreateTestModel();
+  REQUIRE(CookModel(*model, cooked_path));
+
+  SECTION("Meshes are loaded back from mapped memory") {
+    Ref<Model> loaded = LoadCookedModel(cooked_path);
+
+    REQUIRE(loaded);
+    REQUIRE(loaded->mapped_file);
+    REQUIRE(loaded->meshes.size() == model->meshes.size());
+    REQUIRE(loaded->bounds.max == model->bounds.max);
+
+    const uint8_t* file_begin = loaded->mapped_file->GetData();
+    const uint8_t* file_end = file_begin + loaded->mapped_file->GetSize();
+
+    for (uint32_t i = 0; i < model->meshes.size(); i++) {
+      const MeshData& expected = model->meshes[i];
+      const MeshData& mesh = loaded->meshes[i];
+
+      REQUIRE(mesh.vertices.size() == expected.vertices.size());
+      REQUIRE(mesh.indices.size() == expected.indices.size());
+      REQUIRE(mesh.bounds.min == expected.bounds.min);
+      REQUIRE(mesh.bounds.max == expected.bounds.max);
+
+      for (uint32_t j = 0; j < mesh.vertices.size(); j++) {
+        REQUIRE(mesh.vertices[j].position == expected.vertices[j].position);
+      }
+      REQUIRE(std::equal(mesh.indices.begin(), mesh.indices.end(),
+                         expected.indices.begin()));
+
+      // wrapped without copying
+      const uint8_t* data =
+          reinterpret_cast<const uint8_t*>(mesh.vertices.data());
+      REQUIRE((data >= file_begin && data < file_end));
+    }
+  }
+
+  SECTION("Other versions are rejected") {
+    {
+      std::fstream file(cooked_path,
+                        std::ios::binary | std::ios::in | std::ios::out);
+      const uint32_t version = kCookedModelVersion + 1;
+      file.seekp(4);
+      file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+
+    REQUIRE_FALSE(LoadCookedModel(cooked_path));
+  }
+
+  std::remove(cooked_path.string().c_str());
+}
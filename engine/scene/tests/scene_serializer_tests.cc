@@ -0,0 +1,121 @@
+#include "catch2/catch_all.hpp"
+
+#include "scene/components.h"
+#include "scene/entity.h"
+#include "scene/scene_serializer.h"
+
+using namespace eve;
+
+TEST_CASE("SceneSerializer round trip", "[SceneSerializer]") {
+  const fs::path path = fs::temp_directory_path() / "eve_scene_test.escn";
+
+  SECTION("Saved scenes load back") {
+    Ref<Scene> scene = CreateRef<Scene>(CreateRef<State>());
+
+    Entity root = scene->CreateEntityWithUUID(1, {"root"});
+    root.GetTransform().local_position = {10.0f, 0.0f, 0.0f};
+
+    Entity child = scene->CreateEntityWithUUID(2, {"child", root.GetUUID()});
+    child.GetTransform().local_position = {1.0f, 2.0f, 3.0f};
+
+    auto& sprite = child.AddComponent<SpriteRendererComponent>();
+    sprite.color = {1.0f, 0.5f, 0.25f, 1.0f};
+    sprite.tex_tiling = {2.0f, 3.0f};
+
+    auto& rb = child.AddComponent<Rigidbody>();
+    rb.velocity = {0.0f, 1.0f, 0.0f};
+    rb.acceleration = {0.0f, 0.0f, 0.0f};
+    rb.mass = 2.0f;
+    rb.position_constraints.freeze_y = true;
+
+    SceneSerializer serializer(scene);
+    serializer.Serialize(path);
+
+    Ref<Scene> loaded_scene = CreateRef<Scene>(CreateRef<State>());
+    SceneSerializer loaded_serializer(loaded_scene);
+    REQUIRE(loaded_serializer.Deserialize(path));
+
+    REQUIRE(loaded_scene->GetName() == "eve_scene_test");
+    REQUIRE(loaded_scene->GetAllEntities().size() == 2);
+
+    Entity loaded_child = loaded_scene->TryGetEntityByUUID(2);
+    REQUIRE(loaded_child);
+    REQUIRE(loaded_child.GetName() == "child");
+    REQUIRE(loaded_child.GetParent().GetUUID() == root.GetUUID());
+    REQUIRE(loaded_child.GetTransform().local_position ==
+            glm::vec3(1.0f, 2.0f, 3.0f));
+
+    const auto& loaded_sprite =
+        loaded_child.GetComponent<SpriteRendererComponent>();
+    REQUIRE(loaded_sprite.color.g == sprite.color.g);
+    REQUIRE(loaded_sprite.color.b == sprite.color.b);
+    REQUIRE(loaded_sprite.tex_tiling == sprite.tex_tiling);
+
+    const auto& loaded_rb = loaded_child.GetComponent<Rigidbody>();
+    REQUIRE(loaded_rb.velocity == rb.velocity);
+    REQUIRE(loaded_rb.mass == 2.0f);
+    REQUIRE(loaded_rb.position_constraints.freeze_y);
+  }
+
+  SECTION("Children listed before their parents and nested arrays") {
+    {
+      std::ofstream file(path);
+      file << R"({
+  "entities": [
+    {
+      "id": 2,
+      "parent_id": 1,
+      "tag": "child",
+      "transform": {
+        "position": [1.0, 2.0, 3.0],
+        "rotation": [0.0, 0.0, 0.0],
+        "scale": [1.0, 1.0, 1.0]
+      },
+      "unknown_component": {
+        "values": [[1, 2], [3, [4, 5]], []],
+        "name": "ignored"
+      },
+      "sprite_component": {
+        "texture": 0,
+        "color": [1.0, 0.5, 0.25, 1.0],
+        "tex_tiling": [2.0, 3.0]
+      }
+    },
+    {
+      "id": 1,
+      "parent_id": 0,
+      "tag": "root",
+      "transform": {
+        "position": [10.0, 0.0, 0.0],
+        "rotation": [0.0, 0.0, 0.0],
+        "scale": [1.0, 1.0, 1.0]
+      }
+    }
+  ],
+  "scene": "handwritten"
+})";
+    }
+
+    Ref<Scene> scene = CreateRef<Scene>(CreateRef<State>());
+    SceneSerializer serializer(scene);
+    REQUIRE(serializer.Deserialize(path));
+
+    REQUIRE(scene->GetName() == "handwritten");
+    REQUIRE(scene->GetAllEntities().size() == 2);
+
+    Entity child = scene->TryGetEntityByUUID(2);
+    REQUIRE(child.GetParent().GetUUID() == UUID(1));
+    REQUIRE(child.GetParent().GetRelation().children_ids.size() == 1);
+
+    // serialized transforms are relative to the parent already
+    REQUIRE(child.GetTransform().local_position ==
+            glm::vec3(1.0f, 2.0f, 3.0f));
+
+    // keys after nested arrays are still read into the same entity
+    REQUIRE(child.HasComponent<SpriteRendererComponent>());
+    REQUIRE(child.GetComponent<SpriteRendererComponent>().tex_tiling ==
+            glm::vec2(2.0f, 3.0f));
+  }
+
+  fs::remove(path);
+}
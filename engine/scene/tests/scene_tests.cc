@@ -0,0 +1,174 @@
+#include "catch2/catch_all.hpp"
+
+#include "scene/components.h"
+#include "scene/entity.h"
+#include "scene/entity_command_buffer.h"
+#include "scene/scene.h"
+
+using namespace eve;
+
+TEST_CASE("Scene copy", "[Scene]") {
+  Ref<State> state = CreateRef<State>();
+  Ref<Scene> scene = CreateRef<Scene>(state);
+
+  Entity root = scene->CreateEntity({"root"});
+  Entity child = scene->CreateEntity({"child", root.GetUUID()});
+  child.GetTransform().local_position = {1.0f, 2.0f, 3.0f};
+  child.AddComponent<Rigidbody>().mass = 5.0f;
+
+  Ref<Scene> copy = Scene::Copy(scene);
+
+  Entity root_copy = copy->TryGetEntityByUUID(root.GetUUID());
+  Entity child_copy = copy->TryGetEntityByUUID(child.GetUUID());
+  REQUIRE(root_copy);
+  REQUIRE(child_copy);
+
+  REQUIRE(child_copy.GetName() == "child");
+  REQUIRE(child_copy.GetParent() == root_copy);
+  REQUIRE(root_copy.GetRelation().children_ids ==
+          std::vector<UUID>{child.GetUUID()});
+
+  // parent pointers belong to the copied scene
+  REQUIRE(child_copy.GetTransform().parent == &root_copy.GetTransform());
+  REQUIRE(child_copy.GetTransform().local_position ==
+          glm::vec3(1.0f, 2.0f, 3.0f));
+
+  REQUIRE(child_copy.GetComponent<Rigidbody>().mass == 5.0f);
+  REQUIRE_FALSE(root_copy.HasComponent<Rigidbody>());
+}
+
+TEST_CASE("Scene entity names", "[Scene]") {
+  Ref<State> state = CreateRef<State>();
+  Scene scene(state);
+
+  Entity first = scene.CreateEntity({"enemy"});
+  Entity second = scene.CreateEntity({"enemy"});
+  Entity third = scene.CreateEntity({"enemy"});
+
+  REQUIRE(first.GetName() == "enemy");
+  REQUIRE(second.GetName() == "enemy (1)");
+  REQUIRE(third.GetName() == "enemy (2)");
+
+  REQUIRE(scene.TryGetEntityByName("enemy (1)") == second);
+
+  SECTION("Renamed entities are found by their new name") {
+    second.SetName("boss");
+
+    REQUIRE(scene.TryGetEntityByName("boss") == second);
+    REQUIRE_FALSE(scene.TryGetEntityByName("enemy (1)"));
+  }
+
+  SECTION("Destroyed entities are not found") {
+    scene.DestroyEntity(third);
+
+    REQUIRE_FALSE(scene.TryGetEntityByName("enemy (2)"));
+  }
+}
+
+TEST_CASE("Scene entity spawn benchmark", "[Scene][!benchmark]") {
+  Ref<State> state = CreateRef<State>();
+
+  BENCHMARK("Spawn 100k entities with the same name") {
+    Scene scene(state);
+    for (int i = 0; i < 100000; i++) {
+      scene.CreateEntity({"enemy"});
+    }
+    return scene.GetAllEntities().size();
+  };
+
+  BENCHMARK_ADVANCED("Find entities by name in 100k")
+  (Catch::Benchmark::Chronometer meter) {
+    Scene scene(state);
+    for (int i = 0; i < 100000; i++) {
+      scene.CreateEntity({"enemy"});
+    }
+
+    meter.measure(
+        [&] { return scene.TryGetEntityByName("enemy (99999)"); });
+  };
+}
+
+TEST_CASE("EntityCommandBuffer playback", "[EntityCommandBuffer]") {
+  Ref<State> state = CreateRef<State>();
+  Scene scene(state);
+
+  Entity root = scene.CreateEntity({"root"});
+  Entity child = scene.CreateEntity({"child", root.GetUUID()});
+
+  EntityCommandBuffer& commands = scene.GetCommandBuffer();
+
+  const UUID created_id =
+      commands.CreateEntity({"created"}, [](Entity entity) {
+        entity.GetTransform().local_position = {1.0f, 2.0f, 3.0f};
+      });
+  commands.AddComponent<Rigidbody>(created_id);
+  commands.SetParent(created_id, child.GetUUID());
+
+  // nothing is applied before the playback
+  REQUIRE_FALSE(scene.TryGetEntityByUUID(created_id));
+
+  commands.Playback();
+  REQUIRE(commands.IsEmpty());
+
+  Entity created = scene.TryGetEntityByUUID(created_id);
+  REQUIRE(created);
+  REQUIRE(created.GetName() == "created");
+  REQUIRE(created.HasComponent<Rigidbody>());
+  REQUIRE(created.GetParent() == child);
+
+  SECTION("Destroys remove children") {
+    Entity other = scene.CreateEntity({"other"});
+
+    commands.DestroyEntity(root.GetUUID());
+    commands.DestroyEntity(child.GetUUID());
+    commands.Playback();
+
+    REQUIRE_FALSE(scene.TryGetEntityByUUID(created_id));
+    REQUIRE_FALSE(scene.TryGetEntityByName("root"));
+    REQUIRE(scene.GetAllEntities().size() == 1);
+    REQUIRE(scene.TryGetEntityByName("other") == other);
+  }
+
+  SECTION("Commands of entities destroyed before playback are skipped") {
+    const UUID destroyed_id = created.GetUUID();
+
+    bool callback_called = false;
+    commands.AddComponent(destroyed_id,
+                          [&](Entity) { callback_called = true; });
+    commands.SetParent(destroyed_id, root.GetUUID());
+    commands.DestroyEntity(destroyed_id);
+
+    scene.DestroyEntity(created);
+    commands.Playback();
+
+    REQUIRE_FALSE(callback_called);
+    REQUIRE_FALSE(scene.TryGetEntityByUUID(destroyed_id));
+    REQUIRE(root.GetChildren().size() == 1);
+    REQUIRE(scene.GetAllEntities().size() == 2);
+ 
+
+  SECTION("Parents destroyed before playback are skipped") {
+    Entity parent = scene.CreateEntity({"parent"});
+    commands.SetParent(created_id, parent.GetUUID());
+
+    scene.DestroyEntity(parent);
+    commands.Playback();
+
+    REQUIRE(created.GetParent() == child);
+    REQUIRE(child.GetChildren().size() == 1);
+  }
+}
+
+TEST_CASE("Scene copy benchmark", "[Scene][!benchmark]") {
+  Ref<State> state = CreateRef<State>();
+  Ref<Scene> scene = CreateRef<Scene>(state);
+
+  // 50k entities in chains of 10
+  Entity parent;
+  for (int i = 0; i < 50000; i++) {
+    parent = scene->CreateEntity(
+        {"", i % 10 != 0 ? parent.GetUUID() : kInvalidUUID});
+  }
+
+  BENCHMARK("Copy 50k entities") { return Scene::Copy(scene); };
+}
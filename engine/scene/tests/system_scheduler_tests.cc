@@ -0,0 +1,128 @@
+#include "catch2/catch_all.hpp"
+
+#include "scene/system_scheduler.h"
+
+using namespace eve;
+
+namespace {
+
+struct PositionComponent {
+  float value;
+};
+
+struct VelocityComponent {
+  float value;
+};
+
+class TestSystem : public System {
+ public:
+  TestSystem(std::function<void()> on_update = nullptr)
+      : System(SystemRunType_kRuntime), on_update_(on_update) {}
+
+  using System::Reads;
+  using System::SetMainThreadOnly;
+  using System::Writes;
+
+ protected:
+  void OnUpdate(float ds) override {
+    if (on_update_) {
+      on_update_();
+    }
+  }
+
+ private:
+  std::function<void()> on_update_;
+};
+
+}  // namespace
+
+TEST_CASE("SystemScheduler dependency graph", "[SystemScheduler]") {
+  TestSystem movement;
+  movement.Reads<VelocityComponent>();
+  movement.Writes<PositionComponent>();
+
+  TestSystem velocity_reader;
+  velocity_reader.Reads<VelocityComponent>();
+
+  TestSystem position_reader;
+  position_reader.Reads<PositionComponent>();
+
+  // systems not declaring their accesses conflict with everything
+  TestSystem undeclared;
+
+  SystemScheduler scheduler;
+  scheduler.Build({&movement, &velocity_reader, &position_reader, &undeclared});
+
+  REQUIRE(scheduler.GetDependencyCount(0) == 0);
+  REQUIRE(scheduler.GetDependencyCount(1) == 0);
+  REQUIRE(scheduler.GetDependencyCount(2) == 1);
+  REQUIRE(scheduler.GetDependencyCount(3) == 3);
+}
+
+TEST_CASE("SystemScheduler runs systems", "[SystemScheduler]") {
+  entt::registry registry;
+  JobSystem job_system(2);
+
+  SECTION("Non conflicting systems run concurrently") {
+    std::atomic<uint32_t> started_count = 0;
+
+    const auto wait_for_other = [&]() {
+      started_count++;
+
+      const auto start = std::chrono::steady_clock::now();
+      while (started_count < 2 &&
+             std::chrono::steady_clock::now() - start <
+                 std::chrono::seconds(1)) {
+        std::this_thread::yield();
+      }
+    };
+
+    std::atomic<uint32_t> overlapped_count = 0;
+
+    TestSystem position_writer([&]() {
+      wait_for_other();
+      overlapped_count += started_count == 2;
+    });
+    position_writer.Writes<PositionComponent>();
+
+    TestSystem velocity_writer([&]() {
+      wait_for_other();
+      overlapped_count += started_count == 2;
+    });
+    velocity_writer.Writes<VelocityComponent>();
+
+    SystemScheduler scheduler;
+    scheduler.Build({&position_writer, &velocity_writer});
+    scheduler.Run(0.0f, registry, &job_system);
+
+    REQUIRE(overlapped_count == 2);
+  }
+
+  SECTION("Conflicting systems keep their order") {
+    std::vector<uint32_t> order;
+    std::mutex order_mutex;
+
+    const auto push_order = [&](uint32_t index) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+      std::scoped_lock<std::mutex> lock(order_mutex);
+      order.push_back(index);
+    };
+
+    TestSystem writer([&]() { push_order(0); });
+    writer.Writes<PositionComponent>();
+
+    TestSystem main_thread_reader([&]() { push_order(1); });
+    main_thread_reader.Reads<PositionComponent>();
+    main_thread_reader.SetMainThreadOnly();
+
+    TestSystem second_writer([&]() { push_order(2); });
+    second_writer.Writes<PositionComponent>();
+
+    SystemScheduler scheduler;
+    scheduler.Build({&writer, &main_thread_reader, &second_writer});
+    scheduler.Run(0.0f, registry, &job_system);
+
+    REQUIRE(order == std::vector<uint32_t>{0, 1, 2});
+  }
+}
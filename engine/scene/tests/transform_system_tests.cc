@@ -0,0 +1,99 @@
+#include "catch2/catch_all.hpp"
+
+#include "scene/entity.h"
+#include "scene/scene.h"
+
+using namespace eve;
+
+TEST_CASE("TransformSystem world transforms", "[TransformSystem]") {
+  Ref<State> state = CreateRef<State>();
+  Scene scene(state);
+
+  Entity root = scene.CreateEntity({"root"});
+  Entity child = scene.CreateEntity({"child", root.GetUUID()});
+  Entity grand_child = scene.CreateEntity({"grand_child", child.GetUUID()});
+
+  root.GetTransform().local_position = {1.0f, 0.0f, 0.0f};
+  child.GetTransform().local_position = {0.0f, 2.0f, 0.0f};
+  grand_child.GetTransform().local_position = {0.0f, 0.0f, 3.0f};
+  grand_child.GetTransform().local_scale = {2.0f, 2.0f, 2.0f};
+
+  scene.OnUpdateEditor(0.0f);
+
+  SECTION("World values match recursive transform values") {
+    for (Entity entity : {root, child, grand_child}) {
+      const Transform& transform = entity.GetTransform();
+      const WorldTransform& world = entity.GetComponent<WorldTransform>();
+
+      REQUIRE(world.position == transform.GetPosition());
+      REQUIRE(world.rotation == transform.GetRotation());
+      REQUIRE(world.scale == transform.GetScale());
+      REQUIRE(world.matrix == transform.GetTransformMatrix());
+    }
+  }
+
+  SECTION("Parent changes are propagated to children") {
+    root.GetTransform().local_position = {5.0f, 0.0f, 0.0f};
+
+    scene.OnUpdateEditor(0.0f);
+
+    const WorldTransform& world = grand_child.GetComponent<WorldTransform>();
+    REQUIRE(world.position == glm::vec3(5.0f, 2.0f, 3.0f));
+    REQUIRE(world.matrix == grand_child.GetTransform().GetTransformMatrix());
+  }
+
+  SECTION("Entities are updated on demand with their ancestors") {
+    Entity sibling = scene.CreateEntity({"sibling", child.GetUUID()});
+    scene.OnUpdateEditor(0.0f);
+
+    root.GetTransform().local_position = {5.0f, 0.0f, 0.0f};
+    REQUIRE(grand_child.GetWorldTransform().position ==
+            glm::vec3(5.0f, 2.0f, 3.0f));
+
+    // siblings skipped on the way are left to the system
+    scene.OnUpdateEditor(0.0f);
+    REQUIRE(sibling.GetComponent<WorldTransform>().position ==
+            glm::vec3(5.0f, 2.0f, 0.0f));
+  }
+
+  SECTION("Clean entities are not outdated") {
+    for (Entity entity : {root, child, grand_child}) {
+      REQUIRE_FALSE(entity.GetComponent<WorldTransform>().IsOutdated(
+          entity.GetTransform()));
+    }
+  }
+}
+
+TEST_CASE("TransformSystem deep hierarchy", "[TransformSystem][!benchmark]") {
+  Ref<State> state = CreateRef<State>();
+  Scene scene(state);
+
+  // 100 chains with depth of 100
+  std::vector<Entity> leaves;
+  for (int i = 0; i < 100; i++) {
+    Entity parent = scene.CreateEntity();
+    for (int depth = 0; depth < 100; depth++) {
+      parent = scene.CreateEntity({"", parent.GetUUID()});
+      parent.GetTransform().local_position = {1.0f, 0.0f, 0.0f};
+    }
+    leaves.push_back(parent);
+  }
+
+  BENCHMARK("Recursive GetTransformMatrix") {
+    glm::mat4 sum(0.0f);
+    for (Entity leaf : leaves) {
+      sum += leaf.GetTransform().GetTransformMatrix();
+    }
+    return sum;
+  };
+
+  BENCHMARK("TransformSystem update") {
+    scene.OnUpdateEditor(0.0f);
+
+    glm::mat4 sum(0.0f);
+    for (Entity leaf : leaves) {
+      sum += leaf.GetComponent<WorldTransform>().matrix;
+    }
+    return sum;
+  };
+}
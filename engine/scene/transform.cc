@@ -4,6 +4,12 @@
 
 namespace eve {
 
+[[nodiscard]] static glm::vec3 RotateDirection(const glm::vec3& rotation,
+                                               const glm::vec3& direction) {
+  glm::fquat orientation = glm::fquat(glm::radians(rotation));
+  return glm::normalize(orientation * direction);
+}
+
 glm::vec3 Transform::GetPosition() const {
   if (parent) {
     return local_position + parent->GetPosition();
@@ -47,21 +53,28 @@ void Transform::LookAt(const glm::vec3& target) {
 }
 
 glm::vec3 Transform::GetForward() const {
-  glm::fquat orientation = glm::fquat(glm::radians(local_rotation));
-  return glm::normalize(orientation * kVec3Forward);
+  return RotateDirection(local_rotation, kVec3Forward);
 }
 
 glm::vec3 Transform::GetRight() const {
-  glm::fquat orientation = glm::fquat(glm::radians(local_rotation));
-  return glm::normalize(orientation * kVec3Right);
+  return RotateDirection(local_rotation, kVec3Right);
 }
 
 glm::vec3 Transform::GetUp() const {
-  glm::fquat orientation = glm::fquat(glm::radians(local_rotation));
-  return glm::normalize(orientation * kVec3Up);
+  return RotateDirection(local_rotation, kVec3Up);
 }
 
 glm::mat4 Transform::GetTransformMatrix() const {
+  glm::mat4 transform = GetLocalTransformMatrix();
+
+  if (parent) {
+    transform = parent->GetTransformMatrix() * transform;
+  }
+
+  return transform;
+}
+
+glm::mat4 Transform::GetLocalTransformMatrix() const {
   glm::mat4 transform = glm::translate(glm::mat4(1.0f), local_position);
   transform =
       glm::rotate(transform, glm::radians(local_rotation.x), kVec3Right);
@@ -70,10 +83,6 @@ glm::mat4 Transform::GetTransformMatrix() const {
       glm::rotate(transform, glm::radians(local_rotation.z), kVec3Forward);
   transform = glm::scale(transform, local_scale);
 
-  if (parent) {
-    transform = parent->GetTransformMatrix() * transform;
-  }
-
   return transform;
 }
 
@@ -85,4 +94,45 @@ glm::vec3 Transform::GetDirection() const {
   return direction;
 }
 
+bool WorldTransform::IsOutdated(const Transform& transform) const {
+  return dirty || local_position_ != transform.local_position ||
+         local_rotation_ != transform.local_rotation ||
+         local_scale_ != transform.local_scale;
+}
+
+void WorldTransform::Update(const Transform& transform,
+                            const WorldTransform* parent) {
+  local_position_ = transform.local_position;
+  local_rotation_ = transform.local_rotation;
+  local_scale_ = transform.local_scale;
+
+  matrix = transform.GetLocalTransformMatrix();
+
+  // same rules with Transform::GetPosition, GetRotation and GetScale
+  if (parent) {
+    matrix = parent->matrix * matrix;
+    position = local_position_ + parent->position;
+    rotation = local_rotation_ + parent->rotation;
+    scale = local_scale_ * parent->scale;
+  } else {
+    position = local_position_;
+    rotation = local_rotation_;
+    scale = local_scale_;
+  }
+
+  dirty = false;
+}
+
+glm::vec3 WorldTransform::GetForward() const {
+  return RotateDirection(rotation, kVec3Forward);
+}
+
+glm::vec3 WorldTransform::GetRight() const {
+  return RotateDirection(rotation, kVec3Right);
+}
+
+glm::vec3 WorldTransform::GetUp() const {
+  return RotateDirection(rotation, kVec3Up);
+}
+
 }  // namespace eve
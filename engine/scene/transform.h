@@ -45,7 +45,54 @@ struct Transform final {
 
   [[nodiscard]] glm::mat4 GetTransformMatrix() const;
 
+  [[nodiscard]] glm::mat4 GetLocalTransformMatrix() const;
+
   [[nodiscard]] glm::vec3 GetDirection() const;
 };
 
+/**
+ * @brief Cached world space values of a Transform, kept up to date once per
+ * frame by TransformSystem.
+ */
+struct WorldTransform final {
+  glm::mat4 matrix = glm::mat4(1.0f);
+
+  glm::vec3 position = kVec3Zero;
+  glm::vec3 rotation = kVec3Zero;
+  glm::vec3 scale = kVec3One;
+
+  // forces an update even if local values did not change (e.g. re-parenting)
+  bool dirty = true;
+
+  /**
+   * @brief Checks if local values have changed since the last update.
+   */
+  [[nodiscard]] bool IsOutdated(const Transform& transform) const;
+
+  /**
+   * @brief Recalculates world values, parent must be up to date.
+   */
+  void Update(const Transform& transform, const WorldTransform* parent);
+
+  /**
+   * @brief World position of @p transform whose local position might have
+   * changed since the last update, e.g. during physics steps. Parents must be
+   * unchanged.
+   */
+  [[nodiscard]] glm::vec3 GetPosition(const Transform& transform) const {
+    return position + transform.local_position - local_position_;
+  }
+
+  [[nodiscard]] glm::vec3 GetForward() const;
+
+  [[nodiscard]] glm::vec3 GetRight() const;
+
+  [[nodiscard]] glm::vec3 GetUp() const;
+
+ private:
+  glm::vec3 local_position_ = kVec3Zero;
+  glm::vec3 local_rotation_ = kVec3Zero;
+  glm::vec3 local_scale_ = kVec3One;
+};
+
 }  // namespace eve
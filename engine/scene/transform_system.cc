@@ -0,0 +1,56 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#include "scene/transform_system.h"
+
+#include "scene/components.h"
+#include "scene/entity.h"
+#include "scene/scene.h"
+
+namespace eve {
+
+TransformSystem::TransformSystem()
+    : System(SystemRunType_kEditor | SystemRunType_kRuntime |
+             SystemRunType_kSimulation) {
+  Reads<Transform, RelationComponent>();
+  Writes<WorldTransform>();
+}
+
+void TransformSystem::OnUpdate(float ds) {
+  Scene* scene = GetScene();
+
+  auto view = scene->GetAllEntitiesWith<Transform, WorldTransform,
+                                        RelationComponent>();
+
+  for (auto entity_id : view) {
+    // start from top level entities and walk down the hierarchy
+    if (view.get<RelationComponent>(entity_id).parent_id != kInvalidUUID) {
+      continue;
+    }
+
+    stack_.push_back({entity_id, nullptr, false});
+
+    while (!stack_.empty()) {
+      const Node node = stack_.back();
+      stack_.pop_back();
+
+      auto [transform, world, relation] =
+          view.get<Transform, WorldTransform, RelationComponent>(node.entity);
+
+      const bool updated = node.parent_updated || world.IsOutdated(transform);
+      if (updated) {
+        world.Update(transform, node.parent);
+      }
+
+      for (const UUID& child_id : relation.children_ids) {
+        Entity child = scene->TryGetEntityByUUID(child_id);
+        if (!child) {
+          continue;
+        }
+
+        stack_.push_back({(entt::entity)child, &world, updated});
+      }
+    }
+  }
+}
+
+}  // namespace eve
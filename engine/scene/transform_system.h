@@ -0,0 +1,39 @@
+// Copyright (c) 2023 Berke Umut Biricik All Rights Reserved
+
+#pragma once
+
+#include "pch_shared.h"
+
+#include <entt/entt.hpp>
+
+#include "scene/system.h"
+#include "scene/transform.h"
+
+namespace eve {
+
+/**
+ * @brief Updates WorldTransform components of the scene in parent before
+ * child order, only entities whose local values or parents have changed
+ * are recalculated.
+ */
+class TransformSystem : public System {
+ public:
+  TransformSystem();
+
+ protected:
+  void OnUpdate(float ds) override;
+
+ private:
+  struct Node {
+    entt::entity entity;
+    const WorldTransform* parent;
+    bool parent_updated;
+  };
+
+  // kept between frames to prevent reallocations
+  std::vector<Node> stack_;
+
+  friend class Scene;
+};
+
+}  // namespace eve
@@ -42,7 +42,7 @@ ScriptInstance::ScriptInstance(Ref<ScriptClass> script_class,
     : script_class_(script_class) {
   instance_ = managed_object;
 
-  ctor_ = ScriptEngine::GetEntityClass().GetMethod(".ctor", 1);
+  ctor_ = ScriptEngine::GetEntityClass().GetMethod(".ctor", 2);
   on_create_method_ = script_class->GetMethod("OnCreate", 0);
   on_update_method_ = script_class->GetMethod("OnUpdate", 1);
   on_destroy_method_ = script_class->GetMethod("OnDestroy", 0);
@@ -52,16 +52,18 @@ ScriptInstance::ScriptInstance(Ref<ScriptClass> script_class, Entity entity)
     : script_class_(script_class) {
   instance_ = script_class->Instantiate();
 
-  ctor_ = ScriptEngine::GetEntityClass().GetMethod(".ctor", 1);
+  ctor_ = ScriptEngine::GetEntityClass().GetMethod(".ctor", 2);
   on_create_method_ = script_class->GetMethod("OnCreate", 0);
   on_update_method_ = script_class->GetMethod("OnUpdate", 1);
   on_destroy_method_ = script_class->GetMethod("OnDestroy", 0);
 
-  // Call Entity constructor
+  // Call Entity constructor, native handle is passed so internal calls
+  // won't need to look the entity up by its UUID
   {
     UUID entity_id = entity.GetUUID();
-    void* param = &entity_id;
-    script_class_->InvokeMethod(instance_, ctor_, &param);
+    entt::entity entity_handle = entity;
+    void* params[] = {&entity_id, &entity_handle};
+    script_class_->InvokeMethod(instance_, ctor_, params);
   }
 }
 
@@ -94,6 +94,16 @@ class ScriptClass {
 
   MonoClass* GetMonoClass() { return mono_class_; }
 
+  const std::string& GetNamespace() const { return class_namespace_; }
+
+  const std::string& GetName() const { return class_name_; }
+
+  /**
+   * @brief Whether the class is marked with [ParallelUpdate], so its
+   * instances could be updated from worker threads.
+   */
+  [[nodiscard]] bool IsParallelUpdate() const { return is_parallel_update_; }
+
  private:
   std::string class_namespace_;
   std::string class_name_;
@@ -102,6 +112,8 @@ class ScriptClass {
 
   MonoClass* mono_class_ = nullptr;
 
+  bool is_parallel_update_ = false;
+
   friend class ScriptEngine;
 };
 
@@ -152,6 +164,9 @@ class ScriptInstance {
   MonoMethod* on_update_method_ = nullptr;
   MonoMethod* on_destroy_method_ = nullptr;
 
+  static constexpr size_t kNotInUpdateBatch = SIZE_MAX;
+  size_t update_batch_index_ = kNotInUpdateBatch;
+
   inline static char field_value_buffer_[16];
 
   friend class ScriptEngine;
@@ -7,9 +7,11 @@
 #include <mono/metadata/assembly.h>
 #include <mono/metadata/mono-debug.h>
 #include <mono/metadata/object.h>
+#include <mono/metadata/reflection.h>
 #include <mono/metadata/tabledefs.h>
 #include <mono/metadata/threads.h>
 #include <FileWatcher.hpp>
+#include <latch>
 
 #include "core/file_system.h"
 #include "core/instance.h"
@@ -76,9 +78,49 @@ static MonoAssembly* LoadMonoAssembly(const fs::path& assembly_path,
   return assembly;
 }
 
+#if _WIN32
+#define EVE_MONO_THUNK_CALL __stdcall
+#else
+#define EVE_MONO_THUNK_CALL
+#endif
+
+// signature of the unmanaged thunk of `void OnUpdate(float ds)`
+using OnUpdateThunk = void(EVE_MONO_THUNK_CALL*)(MonoObject* instance,
+                                                 float ds,
+                                                 MonoException** exception);
+
+/**
+ * @brief Instances of the same script class updated through the cached
+ * unmanaged thunk of their OnUpdate method.
+ */
+struct ScriptUpdateBatch {
+  OnUpdateThunk on_update = nullptr;
+  bool is_parallel = false;
+  std::vector<ScriptInstance*> instances;
+  // instances destroyed while updating leave a hole to be removed afterwards
+  bool has_holes = false;
+};
+
+/**
+ * @brief Orders batches by class name so scripts are updated in the same
+ * order on every run, addresses of the classes differ between runs.
+ */
+struct ScriptClassNameLess {
+  bool operator()(const ScriptClass* lhs, const ScriptClass* rhs) const {
+    return std::tie(lhs->GetNamespace(), lhs->GetName()) <
+           std::tie(rhs->GetNamespace(), rhs->GetName());
+  }
+};
+
 struct ScriptEngineData {
   MonoDomain* root_domain = nullptr;
   MonoDomain* app_domain = nullptr;
+  // incremented for every app domain, domain pointers could be reused
+  uint32_t domain_generation = 0;
+
+  std::thread::id main_thread_id;
+  // job system whose workers could be attached to the app domain
+  JobSystem* attached_job_system = nullptr;
 
   MonoAssembly* core_assembly = nullptr;
   MonoImage* core_assembly_image = nullptr;
@@ -95,6 +137,12 @@ struct ScriptEngineData {
   std::unordered_map<UUID, Ref<ScriptInstance>> entity_instances;
   std::unordered_map<UUID, ScriptFieldMap> entity_script_fields;
 
+  // ordered map so batches created while updating won't invalidate iterators
+  std::map<ScriptClass*, ScriptUpdateBatch, ScriptClassNameLess>
+      update_batches;
+  bool is_updating = false;
+  bool is_updating_in_parallel = false;
+
   std::vector<Scope<filewatch::FileWatch<std::string>>> script_file_watchers;
   bool assembly_reload_pending = false;
 
@@ -107,6 +155,40 @@ struct ScriptEngineData {
 
 static ScriptEngineData* data = nullptr;
 
+// worker threads are attached before running scripts and detached before
+// the app domain they are attached to is unloaded
+static thread_local MonoThread* tls_attached_thread = nullptr;
+static thread_local uint32_t tls_attached_generation = 0;
+
+static void AttachCurrentThread() {
+  // main thread is attached since the runtime is initialized
+  if (std::this_thread::get_id() == data->main_thread_id) {
+    return;
+  }
+
+  if (tls_attached_thread &&
+      tls_attached_generation == data->domain_generation) {
+    return;
+  }
+
+  tls_attached_thread = mono_thread_attach(data->app_domain);
+  tls_attached_generation = data->domain_generation;
+}
+
+// number of instances updated by a single job
+constexpr uint32_t kParallelUpdateGroupSize = 64;
+
+static void InvokeUpdateThunk(const ScriptUpdateBatch& batch,
+                              ScriptInstance* instance, float ds) {
+  MonoException* exception = nullptr;
+  batch.on_update(instance->GetManagedObject(), ds, &exception);
+
+  // thunks do not report exceptions thrown from scripts by themselves
+  if (exception) {
+    mono_print_unhandled_exception((MonoObject*)exception);
+  }
+}
+
 inline ScriptFieldType MonoTypeToScriptFieldType(MonoType* mono_type) {
   std::string type_name = mono_type_get_name(mono_type);
 
@@ -228,9 +310,12 @@ void ScriptEngine::InitMono() {
   }
 
   mono_thread_set_main(mono_thread_current());
+  data->main_thread_id = std::this_thread::get_id();
 }
 
 void ScriptEngine::ShutdownMono() {
+  DetachWorkerThreads();
+
   mono_domain_set(mono_get_root_domain(), false);
 
   mono_domain_unload(data->app_domain);
@@ -248,6 +333,7 @@ bool ScriptEngine::LoadAssembly(const fs::path& filepath) {
   // Create an App Domain
   char friendly_name[] = "EveScriptRuntime";
   data->app_domain = mono_domain_create_appdomain(friendly_name, nullptr);
+  data->domain_generation++;
   mono_domain_set(data->app_domain, true);
 
   data->core_assembly_path = filepath;
@@ -290,6 +376,8 @@ bool ScriptEngine::LoadAppAssembly(const fs::path& filepath) {
 }
 
 void ScriptEngine::ReloadAssembly() {
+  DetachWorkerThreads();
+
   mono_domain_set(mono_get_root_domain(), false);
 
   mono_domain_unload(data->app_domain);
@@ -316,11 +404,17 @@ void ScriptEngine::CreateEntityInstance(Entity entity) {
 
   UUID entity_id = entity.GetUUID();
 
+  if (auto old_instance = GetEntityScriptInstance(entity_id); old_instance) {
+    RemoveFromUpdateBatch(old_instance.get());
+  }
+
   Ref<ScriptInstance> instance =
       CreateRef<ScriptInstance>(data->entity_classes[sc.class_name], entity);
 
   data->entity_instances[entity_id] = instance;
 
+  AddToUpdateBatch(instance.get());
+
   if (data->entity_script_fields.find(entity_id) !=
       data->entity_script_fields.end()) {
     const ScriptFieldMap& field_map = data->entity_script_fields.at(entity_id);
@@ -360,6 +454,106 @@ void ScriptEngine::InvokeCreateEntity(Entity entity) {
   instance->InvokeOnCreate();
 }
 
+void ScriptEngine::UpdateEntities(float ds, JobSystem* job_system) {
+  data->is_updating = true;
+
+  for (auto& [script_class, batch] : data->update_batches) {
+    if (batch.is_parallel && job_system) {
+      continue;
+    }
+
+    // instances created while updating will be updated the next frame
+    const size_t instance_count = batch.instances.size();
+    for (size_t i = 0; i < instance_count; i++) {
+      ScriptInstance* instance = batch.instances[i];
+      if (!instance) {
+        continue;
+      }
+
+      InvokeUpdateThunk(batch, instance, ds);
+    }
+  }
+
+  if (job_system) {
+    data->is_updating_in_parallel = true;
+    data->attached_job_system = job_system;
+
+    JobCounter counter;
+    for (auto& [script_class, batch] : data->update_batches) {
+      if (!batch.is_parallel || batch.instances.empty()) {
+        continue;
+      }
+
+      job_system->Dispatch(
+          static_cast<uint32_t>(batch.instances.size()),
+          kParallelUpdateGroupSize,
+          [&batch, ds](uint32_t index) {
+            AttachCurrentThread();
+
+            ScriptInstance* instance = batch.instances[index];
+            if (!instance) {
+              return;
+            }
+
+            InvokeUpdateThunk(batch, instance, ds);
+          },
+          &counter);
+    }
+    job_system->Wait(counter);
+
+    data->is_updating_in_parallel = false;
+  }
+
+  data->is_updating = false;
+
+  for (auto& [script_class, batch] : data->update_batches) {
+    if (!batch.has_holes) {
+      continue;
+    }
+
+    std::erase(batch.instances, nullptr);
+    for (size_t i = 0; i < batch.instances.size(); i++) {
+      batch.instances[i]->update_batch_index_ = i;
+    }
+    batch.has_holes = false;
+  }
+}
+
+void ScriptEngine::DetachWorkerThreads() {
+  JobSystem* job_system = data->attached_job_system;
+  if (!job_system) {
+    return;
+  }
+  data->attached_job_system = nullptr;
+
+  // every job blocks until all of them are running, so each worker and the
+  // waiting main thread run exactly one of them
+  const uint32_t job_count = job_system->GetWorkerCount() + 1;
+  std::latch all_running(job_count);
+
+  JobCounter counter;
+  for (uint32_t i = 0; i < job_count; i++) {
+    job_system->Submit(
+        [&all_running]() {
+          if (tls_attached_thread) {
+            mono_thread_detach(tls_attached_thread);
+            tls_attached_thread = nullptr;
+          }
+          all_running.arrive_and_wait();
+        },
+        &counter);
+  }
+  job_system->Wait(counter);
+}
+
+bool ScriptEngine::IsUpdating() {
+  return data->is_updating;
+}
+
+bool ScriptEngine::IsUpdatingInParallel() {
+  return data->is_updating_in_parallel;
+}
+
 void ScriptEngine::InvokeUpdateEntity(Entity entity, float ds) {
   UUID entity_uuid = entity.GetUUID();
   if (auto instance = GetEntityScriptInstance(entity_uuid); instance) {
@@ -374,6 +568,7 @@ void ScriptEngine::InvokeDestroyEntity(Entity entity) {
   UUID entity_uuid = entity.GetUUID();
   if (auto instance = GetEntityScriptInstance(entity_uuid); instance) {
     instance->InvokeOnDestroy();
+    RemoveFromUpdateBatch(instance.get());
   } else {
     EVE_LOG_ENGINE_ERROR("Could not find ScriptInstance for entity {}",
                          (uint64_t)entity_uuid);
@@ -411,6 +606,7 @@ void ScriptEngine::OnRuntimeStart(Scene* scene) {
 
 void ScriptEngine::OnRuntimeStop() {
   data->scene_context = nullptr;
+  data->update_batches.clear();
   data->entity_instances.clear();
 }
 
@@ -436,6 +632,8 @@ void ScriptEngine::LoadAssemblyClasses() {
 
   MonoClass* entity_class =
       mono_class_from_name(data->core_assembly_image, "EveEngine", "Entity");
+  MonoClass* parallel_update_attribute = mono_class_from_name(
+      data->core_assembly_image, "EveEngine", "ParallelUpdateAttribute");
 
   for (int32_t i = 0; i < num_types; i++) {
     uint32_t cols[MONO_TYPEDEF_SIZE];
@@ -469,6 +667,18 @@ void ScriptEngine::LoadAssemblyClasses() {
         CreateRef<ScriptClass>(class_namespace, class_name);
     data->entity_classes[full_name] = script_class;
 
+    // the attribute is inherited, so base scripts are checked as well
+    for (MonoClass* current_class = mono_class;
+         current_class != entity_class && !script_class->is_parallel_update_;
+         current_class = mono_class_get_parent(current_class)) {
+      if (MonoCustomAttrInfo* attributes =
+              mono_custom_attrs_from_class(current_class)) {
+        script_class->is_parallel_update_ =
+            mono_custom_attrs_has_attr(attributes, parallel_update_attribute);
+        mono_custom_attrs_free(attributes);
+      }
+    }
+
     int field_count = mono_class_num_fields(mono_class);
 
 #ifdef _DEBUG
@@ -521,6 +731,49 @@ MonoObject* ScriptEngine::GetManagedInstance(UUID uuid) {
   return data->entity_instances.at(uuid)->GetManagedObject();
 }
 
+void ScriptEngine::AddToUpdateBatch(ScriptInstance* instance) {
+  if (!instance->on_update_method_) {
+    return;
+  }
+
+  ScriptUpdateBatch& batch =
+      data->update_batches[instance->script_class_.get()];
+  if (!batch.on_update) {
+    batch.on_update = (OnUpdateThunk)mono_method_get_unmanaged_thunk(
+        instance->on_update_method_);
+    batch.is_parallel = instance->script_class_->IsParallelUpdate();
+  }
+
+  instance->update_batch_index_ = batch.instances.size();
+  batch.instances.push_back(instance);
+}
+
+void ScriptEngine::RemoveFromUpdateBatch(ScriptInstance* instance) {
+  if (instance->update_batch_index_ == ScriptInstance::kNotInUpdateBatch) {
+    return;
+  }
+
+  auto it = data->update_batches.find(instance->script_class_.get());
+  EVE_ASSERT_ENGINE(it != data->update_batches.end());
+
+  ScriptUpdateBatch& batch = it->second;
+  const size_t index = instance->update_batch_index_;
+  instance->update_batch_index_ = ScriptInstance::kNotInUpdateBatch;
+
+  // keep indices stable until the update loop is over
+  if (data->is_updating) {
+    batch.instances[index] = nullptr;
+    batch.has_holes = true;
+    return;
+  }
+
+  if (index != batch.instances.size() - 1) {
+    batch.instances[index] = batch.instances.back();
+    batch.instances[index]->update_batch_index_ = index;
+  }
+  batch.instances.pop_back();
+}
+
 MonoString* ScriptEngine::CreateMonoString(const char* string) {
   return mono_string_new(data->app_domain, string);
 }
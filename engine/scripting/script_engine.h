@@ -4,6 +4,7 @@
 
 #include "pch_shared.h"
 
+#include "core/job_system.h"
 #include "scripting/script.h"
 
 namespace eve {
@@ -34,6 +35,25 @@ class ScriptEngine {
 
   static void InvokeCreateEntity(Entity entity);
 
+  /**
+   * @brief Updates every script instance, instances of the same class are
+   * updated together through a cached unmanaged thunk. Classes marked with
+   * [ParallelUpdate] are updated on @p job_system if given.
+   */
+  static void UpdateEntities(float ds, JobSystem* job_system = nullptr);
+
+  /**
+   * @brief Whether scripts are being updated, structural changes must be
+   * recorded to the scene's command buffer meanwhile.
+   */
+  static bool IsUpdating();
+
+  /**
+   * @brief Whether [ParallelUpdate] scripts are being updated from worker
+   * threads, main thread only calls must be deferred meanwhile.
+   */
+  static bool IsUpdatingInParallel();
+
   static void InvokeUpdateEntity(Entity entity, float ds);
 
   static void InvokeDestroyEntity(Entity entity);
@@ -67,6 +87,15 @@ class ScriptEngine {
 
   static void LoadAssemblyClasses();
 
+  /**
+   * @brief Detaches worker threads which ran parallel updates from the
+   * runtime, must be called before the app domain is unloaded.
+   */
+  static void DetachWorkerThreads();
+
+  static void AddToUpdateBatch(ScriptInstance* instance);
+  static void RemoveFromUpdateBatch(ScriptInstance* instance);
+
   friend class ScriptClass;
 };
 
@@ -16,6 +16,7 @@
 #include "physics/rigidbody.h"
 #include "scene/components.h"
 #include "scene/entity.h"
+#include "scene/entity_command_buffer.h"
 #include "scene/scene.h"
 #include "scene/scene_manager.h"
 #include "scene/transform.h"
@@ -36,9 +37,79 @@ static std::unordered_map<MonoType*, std::function<bool(Entity)>>
 static std::unordered_map<MonoType*, std::function<void(Entity)>>
     entity_add_component_funcs;
 
+static std::unordered_map<MonoType*, std::function<MonoArray*(Scene*)>>
+    entity_get_entities_with_funcs;
+
 #define ADD_INTERNAL_CALL(Name) \
   mono_add_internal_call("EveEngine.Interop::" #Name, Name)
 
+/**
+ * @brief Resolves the native handle cached by script instances, handles keep
+ * the entity version so destroyed entities are not resolved.
+ */
+static Entity GetEntity(entt::entity entity_handle) {
+  Scene* scene = ScriptEngine::GetSceneContext();
+  EVE_ASSERT_ENGINE(scene);
+  Entity entity = scene->TryGetEntityByHandle(entity_handle);
+  EVE_ASSERT_ENGINE(entity);
+  return entity;
+}
+
+/**
+ * @brief Copies @p Member of every entity in @p entity_handles into
+ * @p out_values, entities without the component are left untouched.
+ */
+template <typename Component, auto Member>
+static void GetComponentValues(MonoArray* entity_handles,
+                               MonoArray* out_values) {
+  using ValueType =
+      std::remove_cvref_t<decltype(std::declval<Component>().*Member)>;
+
+  Scene* scene = ScriptEngine::GetSceneContext();
+  EVE_ASSERT_ENGINE(scene);
+
+  const uintptr_t count = mono_array_length(entity_handles);
+  EVE_ASSERT_ENGINE(mono_array_length(out_values) >= count);
+
+  auto view = scene->GetAllEntitiesWith<Component>();
+  for (uintptr_t i = 0; i < count; i++) {
+    const auto handle = mono_array_get(entity_handles, entt::entity, i);
+    if (!view.contains(handle)) {
+      continue;
+    }
+
+    mono_array_set(out_values, ValueType, i,
+                   view.template get<Component>(handle).*Member);
+  }
+}
+
+/**
+ * @brief Copies @p values into @p Member of every entity in
+ * @p entity_handles, entities without the component are skipped.
+ */
+template <typename Component, auto Member>
+static void SetComponentValues(MonoArray* entity_handles, MonoArray* values) {
+  using ValueType =
+      std::remove_cvref_t<decltype(std::declval<Component>().*Member)>;
+
+  Scene* scene = ScriptEngine::GetSceneContext();
+  EVE_ASSERT_ENGINE(scene);
+
+  const uintptr_t count = mono_array_length(entity_handles);
+  EVE_ASSERT_ENGINE(mono_array_length(values) >= count);
+
+  auto view = scene->GetAllEntitiesWith<Component>();
+  for (uintptr_t i = 0; i < count; i++) {
+    const auto handle = mono_array_get(entity_handles, entt::entity, i);
+    if (!view.contains(handle)) {
+      continue;
+    }
+
+    view.template get<Component>(handle).*Member =
+        mono_array_get(values, ValueType, i);
+  }
+}
+
 static MonoObject* GetScriptInstance(UUID entity_id) {
   return ScriptEngine::GetManagedInstance(entity_id);
 }
@@ -58,6 +129,12 @@ static CursorMode Window_GetCursorMode() {
 }
 
 static void Window_SetCursorMode(CursorMode mode) {
+  // windowing calls are main thread only
+  if (ScriptEngine::IsUpdatingInParallel()) {
+    Instance::Get().EnqueueMain([mode]() { Window_SetCursorMode(mode); });
+    return;
+  }
+
   auto state = Instance::Get().GetState();
   state->window->SetCursorMode(mode);
 }
@@ -88,41 +165,42 @@ static void Debug_LogFatal(MonoString* string) {
 #pragma endregion
 #pragma region Entity
 
-static void Entity_Destroy(UUID entity_id) {
+static entt::entity Entity_GetHandle(UUID entity_id) {
   Scene* scene = ScriptEngine::GetSceneContext();
   EVE_ASSERT_ENGINE(scene);
   auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
 
-  scene->DestroyEntity(entity);
+  return entity ? static_cast<entt::entity>(entity) : entt::null;
 }
 
-static uint64_t Entity_GetParent(UUID entity_id) {
+static void Entity_Destroy(entt::entity entity_handle) {
+  Entity entity = GetEntity(entity_handle);
+
   Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  if (ScriptEngine::IsUpdating()) {
+    scene->GetCommandBuffer().DestroyEntity(entity.GetUUID());
+  } else {
+    scene->DestroyEntity(entity);
+  }
+}
+
+static uint64_t Entity_GetParent(entt::entity entity_handle) {
+  Entity entity = GetEntity(entity_handle);
 
   Entity parent_entity = entity.GetParent();
 
   return parent_entity ? parent_entity.GetUUID() : kInvalidUUID;
 }
 
-static MonoString* Entity_GetName(UUID entity_id) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static MonoString* Entity_GetName(entt::entity entity_handle) {
+  Entity entity = GetEntity(entity_handle);
 
   return ScriptEngine::CreateMonoString(entity.GetName().c_str());
 }
 
-static bool Entity_HasComponent(UUID entity_id,
+static bool Entity_HasComponent(entt::entity entity_handle,
                                 MonoReflectionType* component_type) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   MonoType* managed_type = mono_reflection_type_get_type(component_type);
   EVE_ASSERT_ENGINE(entity_has_component_funcs.find(managed_type) !=
@@ -130,18 +208,20 @@ static bool Entity_HasComponent(UUID entity_id,
   return entity_has_component_funcs.at(managed_type)(entity);
 }
 
-static void Entity_AddComponent(UUID entity_id,
+static void Entity_AddComponent(entt::entity entity_handle,
                                 MonoReflectionType* component_type) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   MonoType* managed_type = mono_reflection_type_get_type(component_type);
   EVE_ASSERT_ENGINE(entity_add_component_funcs.find(managed_type) !=
                     entity_add_component_funcs.end());
 
-  entity_add_component_funcs.at(managed_type)(entity);
+  if (ScriptEngine::IsUpdating()) {
+    ScriptEngine::GetSceneContext()->GetCommandBuffer().AddComponent(
+        entity.GetUUID(), entity_add_component_funcs.at(managed_type));
+  } else {
+    entity_add_component_funcs.at(managed_type)(entity);
+  }
 }
 
 static uint64_t Entity_TryGetEntityByName(MonoString* name) {
@@ -165,410 +245,383 @@ static uint64_t Entity_Instantiate(MonoString* name, UUID parent_id,
   Scene* scene = ScriptEngine::GetSceneContext();
   EVE_ASSERT_ENGINE(scene);
 
+  const auto set_transform = [position = *position, rotation = *rotation,
+                              scale = *scale](Entity entity) {
+    Transform& tc = entity.GetTransform();
+    tc.local_position = position;
+    tc.local_rotation = rotation;
+    tc.local_scale = scale;
+  };
+
+  // id is reserved so it could be returned before the entity is created
+  if (ScriptEngine::IsUpdating()) {
+    return scene->GetCommandBuffer().CreateEntity(
+        {MonoStringToString(name), parent_id}, set_transform);
+  }
+
   Entity created_entity =
       scene->CreateEntity({MonoStringToString(name), parent_id});
   if (!created_entity) {
     return 0;
   }
 
-  Transform& tc = created_entity.GetTransform();
-  tc.local_position = *position;
-  tc.local_rotation = *rotation;
-  tc.local_scale = *scale;
+  set_transform(created_entity);
 
   return created_entity.GetUUID();
 }
 
+static void AssignScript(Entity entity, const std::string& class_name) {
+  auto& sc = entity.AddComponent<ScriptComponent>();
+  sc.class_name = class_name;
+
+  // Register entity to the scripting engine
+  ScriptEngine::CreateEntityInstance(entity);
+  // ScriptEngine::SetEntityFieldValues(entity);
+  ScriptEngine::InvokeCreateEntity(entity);
+}
+
 static void Entity_AssignScript(UUID entity_id, MonoString* class_name) {
   Scene* scene = ScriptEngine::GetSceneContext();
   EVE_ASSERT_ENGINE(scene);
+
+  // entity could be instantiated by the same script and not created yet
+  if (ScriptEngine::IsUpdating()) {
+    scene->GetCommandBuffer().AddComponent(
+        entity_id, [class_name = MonoStringToString(class_name)](
+                       Entity entity) { AssignScript(entity, class_name); });
+    return;
+  }
+
   auto entity = scene->TryGetEntityByUUID(entity_id);
   EVE_ASSERT_ENGINE(entity);
 
-  auto& sc = entity.AddComponent<ScriptComponent>();
-  sc.class_name = MonoStringToString(class_name);
+  AssignScript(entity, MonoStringToString(class_name));
+}
 
-  // Register entity to the scripting engine
-  ScriptEngine::CreateEntityInstance(entity);
-  // ScriptEngine::SetEntityFieldValues(entity);
-  ScriptEngine::InvokeCreateEntity(entity);
+static MonoArray* Entity_GetEntitiesWith(MonoReflectionType* component_type) {
+  Scene* scene = ScriptEngine::GetSceneContext();
+  EVE_ASSERT_ENGINE(scene);
+
+  MonoType* managed_type = mono_reflection_type_get_type(component_type);
+  EVE_ASSERT_ENGINE(entity_get_entities_with_funcs.find(managed_type) !=
+                    entity_get_entities_with_funcs.end());
+
+  return entity_get_entities_with_funcs.at(managed_type)(scene);
 }
 
 #pragma endregion
 #pragma region TransformComponent
 
-static void TransformComponent_GetLocalPosition(UUID entity_id,
+static void TransformComponent_GetLocalPosition(entt::entity entity_handle,
                                                 glm::vec3* out_position) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   *out_position = entity.GetComponent<Transform>().local_position;
 }
 
-static void TransformComponent_SetLocalPosition(UUID entity_id,
+static void TransformComponent_SetLocalPosition(entt::entity entity_handle,
                                                 glm::vec3* position) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Transform>().local_position = *position;
 }
 
-static void TransformComponent_GetLocalRotation(UUID entity_id,
+static void TransformComponent_GetLocalRotation(entt::entity entity_handle,
                                                 glm::vec3* out_rotation) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   *out_rotation = entity.GetComponent<Transform>().local_rotation;
 }
 
-static void TransformComponent_SetLocalRotation(UUID entity_id,
+static void TransformComponent_SetLocalRotation(entt::entity entity_handle,
                                                 glm::vec3* rotation) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Transform>().local_rotation = *rotation;
 }
 
-static void TransformComponent_GetLocalScale(UUID entity_id,
+static void TransformComponent_GetLocalScale(entt::entity entity_handle,
                                              glm::vec3* out_scale) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   *out_scale = entity.GetComponent<Transform>().local_scale;
 }
 
-static void TransformComponent_SetLocalScale(UUID entity_id, glm::vec3* scale) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void TransformComponent_SetLocalScale(entt::entity entity_handle,
+                                             glm::vec3* scale) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Transform>().local_scale = *scale;
 }
 
-static void TransformComponent_GetPosition(UUID entity_id,
+static void TransformComponent_GetPosition(entt::entity entity_handle,
                                            glm::vec3* out_position) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
-  *out_position = entity.GetComponent<Transform>().GetPosition();
+  // world transforms of shared parents could not be updated from workers
+  *out_position = ScriptEngine::IsUpdatingInParallel()
+                  ? entity.GetTransform().GetPosition()
+                  : entity.GetWorldTransform().position;
 }
 
-static void TransformComponent_GetRotation(UUID entity_id,
+static void TransformComponent_GetRotation(entt::entity entity_handle,
                                            glm::vec3* out_rotation) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
-  *out_rotation = entity.GetComponent<Transform>().GetRotation();
+  *out_rotation = ScriptEngine::IsUpdatingInParallel()
+                  ? entity.GetTransform().GetRotation()
+                  : entity.GetWorldTransform().rotation;
 }
 
-static void TransformComponent_GetScale(UUID entity_id, glm::vec3* out_scale) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void TransformComponent_GetScale(entt::entity entity_handle,
+                                        glm::vec3* out_scale) {
+  Entity entity = GetEntity(entity_handle);
 
-  *out_scale = entity.GetComponent<Transform>().GetScale();
+  *out_scale = ScriptEngine::IsUpdatingInParallel()
+               ? entity.GetTransform().GetScale()
+               : entity.GetWorldTransform().scale;
 }
 
-static void TransformComponent_GetForward(UUID entity_id,
+static void TransformComponent_GetForward(entt::entity entity_handle,
                                           glm::vec3* out_forward) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   *out_forward = entity.GetComponent<Transform>().GetForward();
 }
 
-static void TransformComponent_GetRight(UUID entity_id, glm::vec3* out_right) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void TransformComponent_GetRight(entt::entity entity_handle,
+                                        glm::vec3* out_right) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_right = entity.GetComponent<Transform>().GetRight();
 }
 
-static void TransformComponent_GetUp(UUID entity_id, glm::vec3* out_up) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void TransformComponent_GetUp(entt::entity entity_handle,
+                                     glm::vec3* out_up) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_up = entity.GetComponent<Transform>().GetUp();
 }
 
-static void TransformComponent_Translate(UUID entity_id,
+static void TransformComponent_Translate(entt::entity entity_handle,
                                          glm::vec3* translation) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetTransform().Translate(*translation);
 }
 
-static void TransformComponent_Rotate(UUID entity_id, const float angle,
-                                      glm::vec3* axis) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void TransformComponent_Rotate(entt::entity entity_handle,
+                                      const float angle, glm::vec3* axis) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetTransform().Rotate(angle, *axis);
 }
 
-static void TransformComponent_LookAt(UUID entity_id, glm::vec3* target) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void TransformComponent_LookAt(entt::entity entity_handle,
+                                      glm::vec3* target) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetTransform().LookAt(*target);
 }
 
+static void TransformComponent_GetLocalPositions(MonoArray* entity_handles,
+                                                 MonoArray* out_positions) {
+  GetComponentValues<Transform, &Transform::local_position>(entity_handles,
+                                                            out_positions);
+}
+
+static void TransformComponent_SetLocalPositions(MonoArray* entity_handles,
+                                                 MonoArray* positions) {
+  SetComponentValues<Transform, &Transform::local_position>(entity_handles,
+                                                            positions);
+}
+
+static void TransformComponent_GetLocalRotations(MonoArray* entity_handles,
+                                                 MonoArray* out_rotations) {
+  GetComponentValues<Transform, &Transform::local_rotation>(entity_handles,
+                                                            out_rotations);
+}
+
+static void TransformComponent_SetLocalRotations(MonoArray* entity_handles,
+                                                 MonoArray* rotations) {
+  SetComponentValues<Transform, &Transform::local_rotation>(entity_handles,
+                                                            rotations);
+}
+
+static void TransformComponent_GetLocalScales(MonoArray* entity_handles,
+                                              MonoArray* out_scales) {
+  GetComponentValues<Transform, &Transform::local_scale>(entity_handles,
+                                                         out_scales);
+}
+
+static void TransformComponent_SetLocalScales(MonoArray* entity_handles,
+                                              MonoArray* scales) {
+  SetComponentValues<Transform, &Transform::local_scale>(entity_handles,
+                                                         scales);
+}
+
 #pragma endregion
 #pragma region CameraComponent
 
 static void CameraComponent_OrthographicCamera_GetAspectRatio(
-    UUID entity_id, float* out_aspect_ratio) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, float* out_aspect_ratio) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_aspect_ratio =
       entity.GetComponent<CameraComponent>().ortho_camera.aspect_ratio;
 }
 
 static void CameraComponent_OrthographicCamera_SetAspectRatio(
-    UUID entity_id, float* aspect_ratio) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, float* aspect_ratio) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().ortho_camera.aspect_ratio =
       *aspect_ratio;
 }
 
 static void CameraComponent_OrthographicCamera_GetZoomLevel(
-    UUID entity_id, float* out_zoom_level) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, float* out_zoom_level) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_zoom_level =
       entity.GetComponent<CameraComponent>().ortho_camera.zoom_level;
 }
 
-static void CameraComponent_OrthographicCamera_SetZoomLevel(UUID entity_id,
-                                                            float* zoom_level) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void CameraComponent_OrthographicCamera_SetZoomLevel(
+    entt::entity entity_handle, float* zoom_level) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().ortho_camera.zoom_level = *zoom_level;
 }
 
 static void CameraComponent_OrthographicCamera_GetNearClip(
-    UUID entity_id, float* out_near_clip) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, float* out_near_clip) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_near_clip =
       entity.GetComponent<CameraComponent>().ortho_camera.near_clip;
 }
 
-static void CameraComponent_OrthographicCamera_SetNearClip(UUID entity_id,
-                                                           float* near_clip) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void CameraComponent_OrthographicCamera_SetNearClip(
+    entt::entity entity_handle, float* near_clip) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().ortho_camera.near_clip = *near_clip;
 }
 
-static void CameraComponent_OrthographicCamera_GetFarClip(UUID entity_id,
-                                                          float* out_far_clip) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void CameraComponent_OrthographicCamera_GetFarClip(
+    entt::entity entity_handle, float* out_far_clip) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_far_clip = entity.GetComponent<CameraComponent>().ortho_camera.far_clip;
 }
 
-static void CameraComponent_OrthographicCamera_SetFarClip(UUID entity_id,
-                                                          float* far_clip) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void CameraComponent_OrthographicCamera_SetFarClip(
+    entt::entity entity_handle, float* far_clip) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().ortho_camera.far_clip = *far_clip;
 }
 
 static void CameraComponent_PerspectiveCamera_GetAspectRatio(
-    UUID entity_id, float* out_aspect_ratio) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, float* out_aspect_ratio) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_aspect_ratio =
       entity.GetComponent<CameraComponent>().persp_camera.aspect_ratio;
 }
 
 static void CameraComponent_PerspectiveCamera_SetAspectRatio(
-    UUID entity_id, float* aspect_ratio) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, float* aspect_ratio) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().persp_camera.aspect_ratio =
       *aspect_ratio;
 }
 
-static void CameraComponent_PerspectiveCamera_GetFov(UUID entity_id,
+static void CameraComponent_PerspectiveCamera_GetFov(entt::entity entity_handle,
                                                      float* out_fov) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   *out_fov = entity.GetComponent<CameraComponent>().persp_camera.fov;
 }
 
-static void CameraComponent_PerspectiveCamera_SetFov(UUID entity_id,
+static void CameraComponent_PerspectiveCamera_SetFov(entt::entity entity_handle,
                                                      float* fov) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().persp_camera.fov = *fov;
 }
 
 static void CameraComponent_PerspectiveCamera_GetNearClip(
-    UUID entity_id, float* out_near_clip) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, float* out_near_clip) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_near_clip =
       entity.GetComponent<CameraComponent>().persp_camera.near_clip;
 }
 
-static void CameraComponent_PerspectiveCamera_SetNearClip(UUID entity_id,
-                                                          float* near_clip) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void CameraComponent_PerspectiveCamera_SetNearClip(
+    entt::entity entity_handle, float* near_clip) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().persp_camera.near_clip = *near_clip;
 }
 
-static void CameraComponent_PerspectiveCamera_GetFarClip(UUID entity_id,
-                                                         float* out_far_clip) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void CameraComponent_PerspectiveCamera_GetFarClip(
+    entt::entity entity_handle, float* out_far_clip) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_far_clip = entity.GetComponent<CameraComponent>().persp_camera.far_clip;
 }
 
-static void CameraComponent_PerspectiveCamera_SetFarClip(UUID entity_id,
-                                                         float* far_clip) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void CameraComponent_PerspectiveCamera_SetFarClip(
+    entt::entity entity_handle, float* far_clip) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().persp_camera.far_clip = *far_clip;
   ;
 }
 
-static void CameraComponent_GetIsOrthographic(UUID entity_id,
+static void CameraComponent_GetIsOrthographic(entt::entity entity_handle,
                                               float* out_is_orthographic) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   *out_is_orthographic = entity.GetComponent<CameraComponent>().is_orthographic;
 }
 
-static void CameraComponent_SetIsOrthographic(UUID entity_id,
+static void CameraComponent_SetIsOrthographic(entt::entity entity_handle,
                                               float* is_orthographic) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().is_orthographic = *is_orthographic;
 }
 
-static void CameraComponent_GetIsPrimary(UUID entity_id,
+static void CameraComponent_GetIsPrimary(entt::entity entity_handle,
                                          float* out_is_primary) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   *out_is_primary = entity.GetComponent<CameraComponent>().is_primary;
 }
 
-static void CameraComponent_SetIsPrimary(UUID entity_id, float* is_primary) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void CameraComponent_SetIsPrimary(entt::entity entity_handle,
+                                         float* is_primary) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().is_primary = *is_primary;
 }
 
 static void CameraComponent_GetIsFixedAspectRato(
-    UUID entity_id, float* out_is_fixed_aspect_ratio) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, float* out_is_fixed_aspect_ratio) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_is_fixed_aspect_ratio =
       entity.GetComponent<CameraComponent>().is_fixed_aspect_ratio;
 }
 
-static void CameraComponent_SetIsFixedAspectRato(UUID entity_id,
+static void CameraComponent_SetIsFixedAspectRato(entt::entity entity_handle,
                                                  float* is_fixed_aspect_ratio) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<CameraComponent>().is_fixed_aspect_ratio =
       *is_fixed_aspect_ratio;
@@ -577,32 +630,32 @@ static void CameraComponent_SetIsFixedAspectRato(UUID entity_id,
 #pragma endregion
 #pragma region Material
 
-static void Material_GetAlbedo(UUID entity_id, Color* out_albedo) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void Material_GetAlbedo(entt::entity entity_handle, Color* out_albedo) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_albedo = entity.GetComponent<Material>().albedo;
 }
 
-static void Material_SetAlbedo(UUID entity_id, Color* albedo) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void Material_SetAlbedo(entt::entity entity_handle, Color* albedo) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Material>().albedo = *albedo;
 }
 
+static void Material_GetAlbedos(MonoArray* entity_handles,
+                                MonoArray* out_albedos) {
+  GetComponentValues<Material, &Material::albedo>(entity_handles, out_albedos);
+}
+
+static void Material_SetAlbedos(MonoArray* entity_handles, MonoArray* albedos) {
+  SetComponentValues<Material, &Material::albedo>(entity_handles, albedos);
+}
+
 #pragma endregion
 #pragma region ScriptComponent
 
-static MonoString* ScriptComponent_GetClassName(UUID entity_id) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static MonoString* ScriptComponent_GetClassName(entt::entity entity_handle) {
+  Entity entity = GetEntity(entity_handle);
 
   const auto& sc = entity.GetComponent<ScriptComponent>();
   return ScriptEngine::CreateMonoString(sc.class_name.c_str());
@@ -611,209 +664,170 @@ static MonoString* ScriptComponent_GetClassName(UUID entity_id) {
 #pragma endregion
 #pragma region RigidbodyComponent
 
-static void Rigidbody_GetVelocity(UUID entity_id, glm::vec3* out_velocity) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void Rigidbody_GetVelocity(entt::entity entity_handle,
+                                  glm::vec3* out_velocity) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_velocity = entity.GetComponent<Rigidbody>().velocity;
 }
 
-static void Rigidbody_SetVelocity(UUID entity_id, glm::vec3* velocity) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void Rigidbody_SetVelocity(entt::entity entity_handle,
+                                  glm::vec3* velocity) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Rigidbody>().velocity = *velocity;
 }
 
-static void Rigidbody_GetAcceleration(UUID entity_id,
+static void Rigidbody_GetAcceleration(entt::entity entity_handle,
                                       glm::vec3* out_acceleration) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   *out_acceleration = entity.GetComponent<Rigidbody>().acceleration;
 }
 
-static void Rigidbody_SetAcceleration(UUID entity_id, glm::vec3* acceleration) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void Rigidbody_SetAcceleration(entt::entity entity_handle,
+                                      glm::vec3* acceleration) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Rigidbody>().acceleration = *acceleration;
 }
 
-static void Rigidbody_GetMass(UUID entity_id, float* out_mass) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void Rigidbody_GetMass(entt::entity entity_handle, float* out_mass) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_mass = entity.GetComponent<Rigidbody>().mass;
 }
 
-static void Rigidbody_SetMass(UUID entity_id, float* mass) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void Rigidbody_SetMass(entt::entity entity_handle, float* mass) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Rigidbody>().mass = *mass;
 }
 
-static void Rigidbody_GetUseGravity(UUID entity_id, bool* out_use_gravity) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void Rigidbody_GetUseGravity(entt::entity entity_handle,
+                                    bool* out_use_gravity) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_use_gravity = entity.GetComponent<Rigidbody>().use_gravity;
 }
 
-static void Rigidbody_SetUseGravity(UUID entity_id, bool* use_gravity) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void Rigidbody_SetUseGravity(entt::entity entity_handle,
+                                    bool* use_gravity) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Rigidbody>().use_gravity = *use_gravity;
 }
 
 static void Rigidbody_GetPositionConstraints(
-    UUID entity_id, PositionConstraints* out_position_constraints) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, PositionConstraints* out_position_constraints) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_position_constraints =
       entity.GetComponent<Rigidbody>().position_constraints;
 }
 
 static void Rigidbody_SetPositionConstraints(
-    UUID entity_id, PositionConstraints* position_constraints) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, PositionConstraints* position_constraints) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Rigidbody>().position_constraints = *position_constraints;
 }
 
 static void Rigidbody_GetRotationConstraints(
-    UUID entity_id, RotationConstraints* out_rotation_constraints) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, RotationConstraints* out_rotation_constraints) {
+  Entity entity = GetEntity(entity_handle);
 
   *out_rotation_constraints =
       entity.GetComponent<Rigidbody>().rotation_constraints;
 }
 
 static void Rigidbody_SetRotationConstraints(
-    UUID entity_id, RotationConstraints* rotation_constraints) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+    entt::entity entity_handle, RotationConstraints* rotation_constraints) {
+  Entity entity = GetEntity(entity_handle);
 
   entity.GetComponent<Rigidbody>().rotation_constraints = *rotation_constraints;
 }
 
+static void Rigidbody_GetVelocities(MonoArray* entity_handles,
+                                    MonoArray* out_velocities) {
+  GetComponentValues<Rigidbody, &Rigidbody::velocity>(entity_handles,
+                                                      out_velocities);
+}
+
+static void Rigidbody_SetVelocities(MonoArray* entity_handles,
+                                    MonoArray* velocities) {
+  SetComponentValues<Rigidbody, &Rigidbody::velocity>(entity_handles,
+                                                      velocities);
+}
+
 #pragma endregion
 #pragma region BoxCollider
 
-static bool BoxCollider_GetIsTrigger(UUID entity_id) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static bool BoxCollider_GetIsTrigger(entt::entity entity_handle) {
+  Entity entity = GetEntity(entity_handle);
 
   BoxCollider& box_collider = entity.GetComponent<BoxCollider>();
 
   return box_collider.is_trigger;
 }
 
-static void BoxCollider_SetIsTrigger(UUID entity_id, bool is_trigger) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void BoxCollider_SetIsTrigger(entt::entity entity_handle,
+                                     bool is_trigger) {
+  Entity entity = GetEntity(entity_handle);
 
   BoxCollider& box_collider = entity.GetComponent<BoxCollider>();
 
   box_collider.is_trigger = is_trigger;
 }
 
-static void BoxCollider_GetLocalPosition(UUID entity_id,
+static void BoxCollider_GetLocalPosition(entt::entity entity_handle,
                                          glm::vec3* out_position) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   BoxCollider& box_collider = entity.GetComponent<BoxCollider>();
 
   *out_position = box_collider.local_position;
 }
 
-static void BoxCollider_SetLocalPosition(UUID entity_id, glm::vec3* position) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void BoxCollider_SetLocalPosition(entt::entity entity_handle,
+                                         glm::vec3* position) {
+  Entity entity = GetEntity(entity_handle);
 
   BoxCollider& box_collider = entity.GetComponent<BoxCollider>();
 
   box_collider.local_position = *position;
 }
 
-static void BoxCollider_GetLocalScale(UUID entity_id, glm::vec3* out_scale) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void BoxCollider_GetLocalScale(entt::entity entity_handle,
+                                      glm::vec3* out_scale) {
+  Entity entity = GetEntity(entity_handle);
 
   BoxCollider& box_collider = entity.GetComponent<BoxCollider>();
 
   *out_scale = box_collider.local_scale;
 }
 
-static void BoxCollider_SetLocalScale(UUID entity_id, glm::vec3* scale) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+static void BoxCollider_SetLocalScale(entt::entity entity_handle,
+                                      glm::vec3* scale) {
+  Entity entity = GetEntity(entity_handle);
 
   BoxCollider& box_collider = entity.GetComponent<BoxCollider>();
 
   box_collider.local_scale = *scale;
 }
 
-static void BoxCollider_GetOnTrigger(UUID entity_id,
+static void BoxCollider_GetOnTrigger(entt::entity entity_handle,
                                      BoxCollider::TriggerFunc out_on_trigger) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   BoxCollider& box_collider = entity.GetComponent<BoxCollider>();
 
   out_on_trigger = box_collider.on_trigger;
 }
 
-static void BoxCollider_SetOnTrigger(UUID entity_id,
+static void BoxCollider_SetOnTrigger(entt::entity entity_handle,
                                      BoxCollider::TriggerFunc on_trigger) {
-  Scene* scene = ScriptEngine::GetSceneContext();
-  EVE_ASSERT_ENGINE(scene);
-  auto entity = scene->TryGetEntityByUUID(entity_id);
-  EVE_ASSERT_ENGINE(entity);
+  Entity entity = GetEntity(entity_handle);
 
   BoxCollider& box_collider = entity.GetComponent<BoxCollider>();
 
@@ -863,6 +877,12 @@ static void Input_GetMousePosition(glm::vec2* out_position) {
 #pragma region SceneManager
 
 static void SceneManager_SetActive(int index) {
+  // loads the scene and acquires its assets, which is not thread safe
+  if (ScriptEngine::IsUpdatingInParallel()) {
+    Instance::Get().EnqueueMain([index]() { SceneManager::SetActive(index); });
+    return;
+  }
+
   SceneManager::SetActive(index);
 }
 
@@ -896,6 +916,19 @@ static void RegisterComponent() {
           entity.AddComponent<Component>();
           EVE_ASSERT_ENGINE(entity.HasComponent<Component>());
         };
+        entity_get_entities_with_funcs[managed_type] = [](Scene* scene) {
+          auto view = scene->GetAllEntitiesWith<Component>();
+
+          MonoArray* entity_handles = mono_array_new(
+              mono_domain_get(), mono_get_uint32_class(), view.size());
+
+          uintptr_t index = 0;
+          for (auto entity_id : view) {
+            mono_array_set(entity_handles, entt::entity, index++, entity_id);
+          }
+
+          return entity_handles;
+        };
       }(),
       ...);
 }
@@ -909,6 +942,7 @@ namespace script_glue {
 
 void RegisterComponents() {
   entity_has_component_funcs.clear();
+  entity_get_entities_with_funcs.clear();
   RegisterComponent(AllComponents{});
 }
 
@@ -930,6 +964,7 @@ void RegisterFunctions() {
   ADD_INTERNAL_CALL(Debug_LogFatal);
 
   // Begin Entity
+  ADD_INTERNAL_CALL(Entity_GetHandle);
   ADD_INTERNAL_CALL(Entity_Destroy);
   ADD_INTERNAL_CALL(Entity_GetParent);
   ADD_INTERNAL_CALL(Entity_GetName);
@@ -938,6 +973,7 @@ void RegisterFunctions() {
   ADD_INTERNAL_CALL(Entity_TryGetEntityByName);
   ADD_INTERNAL_CALL(Entity_Instantiate);
   ADD_INTERNAL_CALL(Entity_AssignScript);
+  ADD_INTERNAL_CALL(Entity_GetEntitiesWith);
 
   // Begin Transform Component
   ADD_INTERNAL_CALL(TransformComponent_GetLocalPosition);
@@ -955,6 +991,12 @@ void RegisterFunctions() {
   ADD_INTERNAL_CALL(TransformComponent_Translate);
   ADD_INTERNAL_CALL(TransformComponent_Rotate);
   ADD_INTERNAL_CALL(TransformComponent_LookAt);
+  ADD_INTERNAL_CALL(TransformComponent_GetLocalPositions);
+  ADD_INTERNAL_CALL(TransformComponent_SetLocalPositions);
+  ADD_INTERNAL_CALL(TransformComponent_GetLocalRotations);
+  ADD_INTERNAL_CALL(TransformComponent_SetLocalRotations);
+  ADD_INTERNAL_CALL(TransformComponent_GetLocalScales);
+  ADD_INTERNAL_CALL(TransformComponent_SetLocalScales);
 
   // Begin Camera Component
   ADD_INTERNAL_CALL(CameraComponent_OrthographicCamera_GetAspectRatio);
@@ -983,6 +1025,8 @@ void RegisterFunctions() {
   // Begin Material
   ADD_INTERNAL_CALL(Material_GetAlbedo);
   ADD_INTERNAL_CALL(Material_SetAlbedo);
+  ADD_INTERNAL_CALL(Material_GetAlbedos);
+  ADD_INTERNAL_CALL(Material_SetAlbedos);
 
   // Begin ScriptComponent
   ADD_INTERNAL_CALL(ScriptComponent_GetClassName);
@@ -1000,6 +1044,8 @@ void RegisterFunctions() {
   ADD_INTERNAL_CALL(Rigidbody_SetPositionConstraints);
   ADD_INTERNAL_CALL(Rigidbody_GetRotationConstraints);
   ADD_INTERNAL_CALL(Rigidbody_SetRotationConstraints);
+  ADD_INTERNAL_CALL(Rigidbody_GetVelocities);
+  ADD_INTERNAL_CALL(Rigidbody_SetVelocities);
 
   // Begin BoxCollider
   ADD_INTERNAL_CALL(BoxCollider_GetIsTrigger);
@@ -2,6 +2,7 @@
 
 #include "launch/prelude.h"
 
+#include "asset/asset_registry.h"
 #include "project/project.h"
 #include "scene/scene_manager.h"
 #include "scripting/script_engine.h"
@@ -22,6 +23,10 @@ class EditorInstance : public Instance {
     }
 
     EnqueueMain([this, path]() {
+      // only keep assets of the active scene in memory
+      AssetRegistry::SetLoadOnDemand(true);
+      SceneManager::SetUseBinaryScenes(true);
+
       Ref<Project> project = Project::Load(path);
       if (!project) {
         GetState()->running = false;
@@ -33,12 +33,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.CameraComponent_OrthographicCamera_GetAspectRatio(Entity.Id, out float aspectRatio);
+        Interop.CameraComponent_OrthographicCamera_GetAspectRatio(Entity.Handle, out float aspectRatio);
         return aspectRatio;
       }
       set
       {
-        Interop.CameraComponent_OrthographicCamera_SetAspectRatio(Entity.Id, ref value);
+        Interop.CameraComponent_OrthographicCamera_SetAspectRatio(Entity.Handle, ref value);
       }
     }
 
@@ -49,12 +49,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.CameraComponent_OrthographicCamera_GetNearClip(Entity.Id, out float nearClip);
+        Interop.CameraComponent_OrthographicCamera_GetNearClip(Entity.Handle, out float nearClip);
         return nearClip;
       }
       set
       {
-        Interop.CameraComponent_OrthographicCamera_SetNearClip(Entity.Id, ref value);
+        Interop.CameraComponent_OrthographicCamera_SetNearClip(Entity.Handle, ref value);
       }
     }
 
@@ -65,12 +65,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.CameraComponent_OrthographicCamera_GetFarClip(Entity.Id, out float farClip);
+        Interop.CameraComponent_OrthographicCamera_GetFarClip(Entity.Handle, out float farClip);
         return farClip;
       }
       set
       {
-        Interop.CameraComponent_OrthographicCamera_SetFarClip(Entity.Id, ref value);
+        Interop.CameraComponent_OrthographicCamera_SetFarClip(Entity.Handle, ref value);
       }
     }
   }
@@ -87,12 +87,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.CameraComponent_PerspectiveCamera_GetFov(Entity.Id, out float fov);
+        Interop.CameraComponent_PerspectiveCamera_GetFov(Entity.Handle, out float fov);
         return fov;
       }
       set
       {
-        Interop.CameraComponent_PerspectiveCamera_SetFov(Entity.Id, ref value);
+        Interop.CameraComponent_PerspectiveCamera_SetFov(Entity.Handle, ref value);
       }
     }
 
@@ -103,12 +103,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.CameraComponent_PerspectiveCamera_GetNearClip(Entity.Id, out float nearClip);
+        Interop.CameraComponent_PerspectiveCamera_GetNearClip(Entity.Handle, out float nearClip);
         return nearClip;
       }
       set
       {
-        Interop.CameraComponent_PerspectiveCamera_SetNearClip(Entity.Id, ref value);
+        Interop.CameraComponent_PerspectiveCamera_SetNearClip(Entity.Handle, ref value);
       }
     }
 
@@ -120,12 +120,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.CameraComponent_PerspectiveCamera_GetFarClip(Entity.Id, out float farClip);
+        Interop.CameraComponent_PerspectiveCamera_GetFarClip(Entity.Handle, out float farClip);
         return farClip;
       }
       set
       {
-        Interop.CameraComponent_PerspectiveCamera_SetFarClip(Entity.Id, ref value);
+        Interop.CameraComponent_PerspectiveCamera_SetFarClip(Entity.Handle, ref value);
       }
     }
   }
@@ -28,8 +28,8 @@ namespace EveEngine
     /// </summary>
     public bool IsTrigger
     {
-      get => Interop.BoxCollider_GetIsTrigger(Entity.Id);
-      set => Interop.BoxCollider_SetIsTrigger(Entity.Id, value);
+      get => Interop.BoxCollider_GetIsTrigger(Entity.Handle);
+      set => Interop.BoxCollider_SetIsTrigger(Entity.Handle, value);
     }
 
     /// <summary>
@@ -40,10 +40,10 @@ namespace EveEngine
     {
       get
       {
-        Interop.BoxCollider_GetLocalPosition(Entity.Id, out Vector3 position);
+        Interop.BoxCollider_GetLocalPosition(Entity.Handle, out Vector3 position);
         return position;
       }
-      set => Interop.BoxCollider_SetLocalPosition(Entity.Id, ref value);
+      set => Interop.BoxCollider_SetLocalPosition(Entity.Handle, ref value);
     }
 
     /// <summary>
@@ -54,10 +54,10 @@ namespace EveEngine
     {
       get
       {
-        Interop.BoxCollider_GetLocalScale(Entity.Id, out Vector3 scale);
+        Interop.BoxCollider_GetLocalScale(Entity.Handle, out Vector3 scale);
         return scale;
       }
-      set => Interop.BoxCollider_SetLocalScale(Entity.Id, ref value);
+      set => Interop.BoxCollider_SetLocalScale(Entity.Handle, ref value);
     }
 
     /// <summary>
@@ -67,7 +67,7 @@ namespace EveEngine
     {
       get
       {
-        Interop.BoxCollider_GetOnTrigger(Entity.Id, out IntPtr onTrigger);
+        Interop.BoxCollider_GetOnTrigger(Entity.Handle, out IntPtr onTrigger);
         if (onTrigger != IntPtr.Zero)
         {
           return Marshal.GetDelegateForFunctionPointer<BoxColliderOnTriggerDelegate>(onTrigger);
@@ -75,7 +75,7 @@ namespace EveEngine
 
         return null;
       }
-      set => Interop.BoxCollider_SetOnTrigger(Entity.Id, Marshal.GetFunctionPointerForDelegate<BoxColliderOnTriggerDelegate>(value));
+      set => Interop.BoxCollider_SetOnTrigger(Entity.Handle, Marshal.GetFunctionPointerForDelegate<BoxColliderOnTriggerDelegate>(value));
     }
 
   }
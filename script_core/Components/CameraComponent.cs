@@ -36,10 +36,10 @@ namespace EveEngine
     {
       get
       {
-        Interop.CameraComponent_GetIsOrthographic(Entity.Id, out bool isOrthographic);
+        Interop.CameraComponent_GetIsOrthographic(Entity.Handle, out bool isOrthographic);
         return isOrthographic;
       }
-      set => Interop.CameraComponent_SetIsOrthographic(Entity.Id, ref value);
+      set => Interop.CameraComponent_SetIsOrthographic(Entity.Handle, ref value);
     }
 
     /// <summary>
@@ -49,10 +49,10 @@ namespace EveEngine
     {
       get
       {
-        Interop.CameraComponent_GetIsPrimary(Entity.Id, out bool isPrimary);
+        Interop.CameraComponent_GetIsPrimary(Entity.Handle, out bool isPrimary);
         return isPrimary;
       }
-      set => Interop.CameraComponent_SetIsPrimary(Entity.Id, ref value);
+      set => Interop.CameraComponent_SetIsPrimary(Entity.Handle, ref value);
     }
 
     /// <summary>
@@ -62,10 +62,10 @@ namespace EveEngine
     {
       get
       {
-        Interop.CameraComponent_GetIsFixedAspectRatio(Entity.Id, out bool isFixedAspectRatio);
+        Interop.CameraComponent_GetIsFixedAspectRatio(Entity.Handle, out bool isFixedAspectRatio);
         return isFixedAspectRatio;
       }
-      set => Interop.CameraComponent_SetIsFixedAspectRatio(Entity.Id, ref value);
+      set => Interop.CameraComponent_SetIsFixedAspectRatio(Entity.Handle, ref value);
     }
   }
 }
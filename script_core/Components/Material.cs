@@ -12,10 +12,10 @@ namespace EveEngine
     {
       get
       {
-        Interop.Material_GetAlbedo(Entity.Id, out Color albedo);
+        Interop.Material_GetAlbedo(Entity.Handle, out Color albedo);
         return albedo;
       }
-      set => Interop.Material_SetAlbedo(Entity.Id, ref value);
+      set => Interop.Material_SetAlbedo(Entity.Handle, ref value);
     }
   }
 }
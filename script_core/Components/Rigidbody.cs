@@ -54,12 +54,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.Rigidbody_GetVelocity(Entity.Id, out Vector3 velocity);
+        Interop.Rigidbody_GetVelocity(Entity.Handle, out Vector3 velocity);
         return velocity;
       }
       set
       {
-        Interop.Rigidbody_SetVelocity(Entity.Id, ref value);
+        Interop.Rigidbody_SetVelocity(Entity.Handle, ref value);
       }
     }
 
@@ -70,12 +70,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.Rigidbody_GetAcceleration(Entity.Id, out Vector3 acceleration);
+        Interop.Rigidbody_GetAcceleration(Entity.Handle, out Vector3 acceleration);
         return acceleration;
       }
       set
       {
-        Interop.Rigidbody_SetAcceleration(Entity.Id, ref value);
+        Interop.Rigidbody_SetAcceleration(Entity.Handle, ref value);
       }
     }
 
@@ -86,12 +86,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.Rigidbody_GetMass(Entity.Id, out float mass);
+        Interop.Rigidbody_GetMass(Entity.Handle, out float mass);
         return mass;
       }
       set
       {
-        Interop.Rigidbody_SetMass(Entity.Id, ref value);
+        Interop.Rigidbody_SetMass(Entity.Handle, ref value);
       }
     }
 
@@ -102,12 +102,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.Rigidbody_GetUseGravity(Entity.Id, out bool useGravity);
+        Interop.Rigidbody_GetUseGravity(Entity.Handle, out bool useGravity);
         return useGravity;
       }
       set
       {
-        Interop.Rigidbody_SetUseGravity(Entity.Id, ref value);
+        Interop.Rigidbody_SetUseGravity(Entity.Handle, ref value);
       }
     }
 
@@ -118,12 +118,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.Rigidbody_GetPositionConstraints(Entity.Id, out RigidbodyPositionConstraints positionConstraints);
+        Interop.Rigidbody_GetPositionConstraints(Entity.Handle, out RigidbodyPositionConstraints positionConstraints);
         return positionConstraints;
       }
       set
       {
-        Interop.Rigidbody_SetPositionConstraints(Entity.Id, ref value);
+        Interop.Rigidbody_SetPositionConstraints(Entity.Handle, ref value);
       }
     }
 
@@ -134,12 +134,12 @@ namespace EveEngine
     {
       get
       {
-        Interop.Rigidbody_GetRotationConstraints(Entity.Id, out RigidbodyRotationConstraints rotationConstraints);
+        Interop.Rigidbody_GetRotationConstraints(Entity.Handle, out RigidbodyRotationConstraints rotationConstraints);
         return rotationConstraints;
       }
       set
       {
-        Interop.Rigidbody_SetRotationConstraints(Entity.Id, ref value);
+        Interop.Rigidbody_SetRotationConstraints(Entity.Handle, ref value);
       }
     }
   };
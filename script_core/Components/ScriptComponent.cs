@@ -11,7 +11,7 @@ namespace EveEngine
     /// </summary>
     public string ClassName
     {
-      get => Interop.ScriptComponent_GetClassName(Entity.Id);
+      get => Interop.ScriptComponent_GetClassName(Entity.Handle);
     }
   }
 }
\ No newline at end of file
@@ -28,10 +28,10 @@ namespace EveEngine
     {
       get
       {
-        Interop.TransformComponent_GetLocalPosition(Entity.Id, out Vector3 position);
+        Interop.TransformComponent_GetLocalPosition(Entity.Handle, out Vector3 position);
         return position;
       }
-      set => Interop.TransformComponent_SetLocalPosition(Entity.Id, ref value);
+      set => Interop.TransformComponent_SetLocalPosition(Entity.Handle, ref value);
     }
 
     /// <summary>
@@ -41,10 +41,10 @@ namespace EveEngine
     {
       get
       {
-        Interop.TransformComponent_GetLocalRotation(Entity.Id, out Vector3 rotation);
+        Interop.TransformComponent_GetLocalRotation(Entity.Handle, out Vector3 rotation);
         return rotation;
       }
-      set => Interop.TransformComponent_SetLocalRotation(Entity.Id, ref value);
+      set => Interop.TransformComponent_SetLocalRotation(Entity.Handle, ref value);
     }
 
     /// <summary>
@@ -54,10 +54,10 @@ namespace EveEngine
     {
       get
       {
-        Interop.TransformComponent_GetLocalScale(Entity.Id, out Vector3 scale);
+        Interop.TransformComponent_GetLocalScale(Entity.Handle, out Vector3 scale);
         return scale;
       }
-      set => Interop.TransformComponent_SetLocalScale(Entity.Id, ref value);
+      set => Interop.TransformComponent_SetLocalScale(Entity.Handle, ref value);
     }
 
     /// <summary>
@@ -67,7 +67,7 @@ namespace EveEngine
     {
       get
       {
-        Interop.TransformComponent_GetPosition(Entity.Id, out Vector3 position);
+        Interop.TransformComponent_GetPosition(Entity.Handle, out Vector3 position);
         return position;
       }
     }
@@ -79,7 +79,7 @@ namespace EveEngine
     {
       get
       {
-        Interop.TransformComponent_GetRotation(Entity.Id, out Vector3 rotation);
+        Interop.TransformComponent_GetRotation(Entity.Handle, out Vector3 rotation);
         return rotation;
       }
     }
@@ -91,7 +91,7 @@ namespace EveEngine
     {
       get
       {
-        Interop.TransformComponent_GetScale(Entity.Id, out Vector3 scale);
+        Interop.TransformComponent_GetScale(Entity.Handle, out Vector3 scale);
         return scale;
       }
     }
@@ -105,7 +105,7 @@ namespace EveEngine
     {
       get
       {
-        Interop.TransformComponent_GetForward(Entity.Id, out Vector3 forward);
+        Interop.TransformComponent_GetForward(Entity.Handle, out Vector3 forward);
         return forward;
       }
     }
@@ -118,7 +118,7 @@ namespace EveEngine
     {
       get
       {
-        Interop.TransformComponent_GetRight(Entity.Id, out Vector3 right);
+        Interop.TransformComponent_GetRight(Entity.Handle, out Vector3 right);
         return right;
       }
     }
@@ -131,7 +131,7 @@ namespace EveEngine
     {
       get
       {
-        Interop.TransformComponent_GetUp(Entity.Id, out Vector3 up);
+        Interop.TransformComponent_GetUp(Entity.Handle, out Vector3 up);
         return up;
       }
     }
@@ -142,7 +142,7 @@ namespace EveEngine
     /// <param name="translation">Value to translate for.</param>
     public void Translate(Vector3 translation)
     {
-      Interop.TransformComponent_Translate(Entity.Id, ref translation);
+      Interop.TransformComponent_Translate(Entity.Handle, ref translation);
     }
 
     /// <summary>
@@ -152,7 +152,7 @@ namespace EveEngine
     /// <param name="axis">Axis to rotate on.</param>
     public void Rotate(float angle, Vector3 axis)
     {
-      Interop.TransformComponent_Rotate(Entity.Id, angle, ref axis);
+      Interop.TransformComponent_Rotate(Entity.Handle, angle, ref axis);
     }
 
     /// <summary>
@@ -161,7 +161,7 @@ namespace EveEngine
     /// <param name="target">Target to look at.</param>
     public void LookAt(Vector3 target)
     {
-      Interop.TransformComponent_LookAt(Entity.Id, ref target);
+      Interop.TransformComponent_LookAt(Entity.Handle, ref target);
     }
   }
 }
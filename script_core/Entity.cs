@@ -10,6 +10,26 @@ namespace EveEngine
     /// </summary>
     public ulong Id { get; private set; }
 
+    /// <summary>
+    /// Native entity handle, cached so internal calls do not look the entity up by its id.
+    /// Resolved on first use since entities instantiated from parallel scripts are created later.
+    /// </summary>
+    internal uint Handle
+    {
+      get
+      {
+        if (_handle == InvalidHandle && Id != 0)
+        {
+          _handle = Interop.Entity_GetHandle(Id);
+        }
+        return _handle;
+      }
+    }
+
+    private const uint InvalidHandle = uint.MaxValue;
+
+    private uint _handle = InvalidHandle;
+
     /// <summary>
     /// Parent entity of current's.
     /// </summary>
@@ -17,7 +37,7 @@ namespace EveEngine
     {
       get
       {
-        return new Entity(Interop.Entity_GetParent(Id));
+        return new Entity(Interop.Entity_GetParent(Handle));
       }
     }
 
@@ -26,7 +46,7 @@ namespace EveEngine
     /// </summary>
     public string Name
     {
-      get => Interop.Entity_GetName(Id);
+      get => Interop.Entity_GetName(Handle);
     }
 
     /// <summary>
@@ -48,10 +68,19 @@ namespace EveEngine
     /// Initializes a new instance of the <see cref="Entity"/> class with a specified ID.
     /// </summary>
     /// <param name="id">The unique identifier to assign to the entity.</param>
-    public Entity(ulong id)
+    public Entity(ulong id) : this(id, InvalidHandle) { }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="Entity"/> class with a specified ID and native handle.
+    /// </summary>
+    /// <param name="id">The unique identifier to assign to the entity.</param>
+    /// <param name="handle">The native handle of the entity.</param>
+    internal Entity(ulong id, uint handle)
     {
       Id = id;
-      Transform = GetComponent<Transform>();
+      _handle = handle;
+      // every entity has a transform
+      Transform = new Transform() { Entity = this };
     }
 
     /// <summary>
@@ -76,7 +105,7 @@ namespace EveEngine
     public void Destroy()
     {
       // this will destroy this object as well
-      Interop.Entity_Destroy(Id);
+      Interop.Entity_Destroy(Handle);
     }
 
     /// <summary>
@@ -86,7 +115,7 @@ namespace EveEngine
     /// <returns><c>true</c> if found <c>else</c> otherwise.</returns>
     public bool HasComponent<T>() where T : Component, new()
     {
-      return Interop.Entity_HasComponent(Id, typeof(T));
+      return Interop.Entity_HasComponent(Handle, typeof(T));
     }
 
     /// <summary>
@@ -119,8 +148,10 @@ namespace EveEngine
         throw new DuplicateComponentException(string.Format("Entity already has component of: {0}", componentType.FullName));
       }
 
-      Interop.Entity_AddComponent(Id, componentType);
-      return GetComponent<T>();
+      Interop.Entity_AddComponent(Handle, componentType);
+
+      // adding could be deferred so existence is not checked
+      return new T() { Entity = this };
     }
 
     /// <summary>
@@ -0,0 +1,157 @@
+using System;
+
+namespace EveEngine
+{
+  /// <summary>
+  /// A fixed set of entities whose component values are read and written in bulk.
+  /// Every get or set is a single native call for the whole batch instead of one per entity.
+  /// </summary>
+  /// <remarks>
+  /// Entities which do not have the component are skipped, their array elements are left untouched.
+  /// </remarks>
+  public class EntityBatch
+  {
+    private readonly uint[] _handles;
+
+    /// <summary>
+    /// Number of entities in the batch, arrays passed to the batch must be at least this long.
+    /// </summary>
+    public int Count => _handles.Length;
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="EntityBatch"/> class with the given entities.
+    /// </summary>
+    /// <param name="entities">Entities to include in the batch.</param>
+    public EntityBatch(Entity[] entities)
+    {
+      _handles = new uint[entities.Length];
+      for (int i = 0; i < entities.Length; i++)
+      {
+        _handles[i] = entities[i].Handle;
+      }
+    }
+
+    private EntityBatch(uint[] handles)
+    {
+      _handles = handles;
+    }
+
+    /// <summary>
+    /// Creates a batch of every entity in the scene having component of type T.
+    /// </summary>
+    /// <typeparam name="T">Component to look for.</typeparam>
+    /// <returns>Batch of the entities found.</returns>
+    public static EntityBatch With<T>() where T : Component, new()
+    {
+      return new EntityBatch(Interop.Entity_GetEntitiesWith(typeof(T)));
+    }
+
+    /// <summary>
+    /// Reads transform positions of the entities.
+    /// </summary>
+    /// <param name="positions">Array to write the positions into.</param>
+    public void GetPositions(Vector3[] positions)
+    {
+      CheckLength(positions);
+      Interop.TransformComponent_GetLocalPositions(_handles, positions);
+    }
+
+    /// <summary>
+    /// Writes transform positions of the entities.
+    /// </summary>
+    /// <param name="positions">Positions to assign in batch order.</param>
+    public void SetPositions(Vector3[] positions)
+    {
+      CheckLength(positions);
+      Interop.TransformComponent_SetLocalPositions(_handles, positions);
+    }
+
+    /// <summary>
+    /// Reads transform rotations of the entities.
+    /// </summary>
+    /// <param name="rotations">Array to write the rotations into.</param>
+    public void GetRotations(Vector3[] rotations)
+    {
+      CheckLength(rotations);
+      Interop.TransformComponent_GetLocalRotations(_handles, rotations);
+    }
+
+    /// <summary>
+    /// Writes transform rotations of the entities.
+    /// </summary>
+    /// <param name="rotations">Rotations to assign in batch order.</param>
+    public void SetRotations(Vector3[] rotations)
+    {
+      CheckLength(rotations);
+      Interop.TransformComponent_SetLocalRotations(_handles, rotations);
+    }
+
+    /// <summary>
+    /// Reads transform scales of the entities.
+    /// </summary>
+    /// <param name="scales">Array to write the scales into.</param>
+    public void GetScales(Vector3[] scales)
+    {
+      CheckLength(scales);
+      Interop.TransformComponent_GetLocalScales(_handles, scales);
+    }
+
+    /// <summary>
+    /// Writes transform scales of the entities.
+    /// </summary>
+    /// <param name="scales">Scales to assign in batch order.</param>
+    public void SetScales(Vector3[] scales)
+    {
+      CheckLength(scales);
+      Interop.TransformComponent_SetLocalScales(_handles, scales);
+    }
+
+    /// <summary>
+    /// Reads rigidbody velocities of the entities.
+    /// </summary>
+    /// <param name="velocities">Array to write the velocities into.</param>
+    public void GetVelocities(Vector3[] velocities)
+    {
+      CheckLength(velocities);
+      Interop.Rigidbody_GetVelocities(_handles, velocities);
+    }
+
+    /// <summary>
+    /// Writes rigidbody velocities of the entities.
+    /// </summary>
+    /// <param name="velocities">Velocities to assign in batch order.</param>
+    public void SetVelocities(Vector3[] velocities)
+    {
+      CheckLength(velocities);
+      Interop.Rigidbody_SetVelocities(_handles, velocities);
+    }
+
+    /// <summary>
+    /// Reads material albedos of the entities.
+    /// </summary>
+    /// <param name="albedos">Array to write the albedos into.</param>
+    public void GetAlbedos(Color[] albedos)
+    {
+      CheckLength(albedos);
+      Interop.Material_GetAlbedos(_handles, albedos);
+    }
+
+    /// <summary>
+    /// Writes material albedos of the entities.
+    /// </summary>
+    /// <param name="albedos">Albedos to assign in batch order.</param>
+    public void SetAlbedos(Color[] albedos)
+    {
+      CheckLength(albedos);
+      Interop.Material_SetAlbedos(_handles, albedos);
+    }
+
+    private void CheckLength(Array values)
+    {
+      if (values.Length < _handles.Length)
+      {
+        throw new ArgumentException(string.Format("Array of {0} elements is smaller than the batch of {1} entities.", values.Length, _handles.Length));
+      }
+    }
+  }
+}
@@ -48,18 +48,21 @@ namespace EveEngine
     #region Entity
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static string Entity_Destroy(ulong entityId);
+    internal extern static uint Entity_GetHandle(ulong entityId);
+
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static string Entity_Destroy(uint entityHandle);
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static ulong Entity_GetParent(ulong entityId);
+    internal extern static ulong Entity_GetParent(uint entityHandle);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static string Entity_GetName(ulong entityId);
+    internal extern static string Entity_GetName(uint entityHandle);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static bool Entity_HasComponent(ulong entityId, Type component_type);
+    internal extern static bool Entity_HasComponent(uint entityHandle, Type component_type);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Entity_AddComponent(ulong entityId, Type component_type);
+    internal extern static void Entity_AddComponent(uint entityHandle, Type component_type);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
     internal extern static ulong Entity_TryGetEntityByName(string name);
@@ -70,6 +73,9 @@ namespace EveEngine
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
     internal extern static void Entity_AssignScript(ulong entityId, string name);
 
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static uint[] Entity_GetEntitiesWith(Type componentType);
+
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
     internal extern static object GetScriptInstance(ulong entityId);
 
@@ -77,194 +83,224 @@ namespace EveEngine
     #region TransformComponent
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_GetLocalPosition(ulong entityId, out Vector3 position);
+    internal extern static void TransformComponent_GetLocalPosition(uint entityHandle, out Vector3 position);
+
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void TransformComponent_SetLocalPosition(uint entityHandle, ref Vector3 position);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_SetLocalPosition(ulong entityId, ref Vector3 position);
+    internal extern static void TransformComponent_GetLocalRotation(uint entityHandle, out Vector3 rotation);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_GetLocalRotation(ulong entityId, out Vector3 rotation);
+    internal extern static void TransformComponent_SetLocalRotation(uint entityHandle, ref Vector3 rotation);
+
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void TransformComponent_GetLocalScale(uint entityHandle, out Vector3 scale);
+
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void TransformComponent_SetLocalScale(uint entityHandle, ref Vector3 scale);
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void TransformComponent_GetPosition(uint entityHandle, out Vector3 position);
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void TransformComponent_GetRotation(uint entityHandle, out Vector3 rotation);
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void TransformComponent_GetScale(uint entityHandle, out Vector3 scale);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_SetLocalRotation(ulong entityId, ref Vector3 rotation);
+    internal extern static void TransformComponent_GetForward(uint entityHandle, out Vector3 forward);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_GetLocalScale(ulong entityId, out Vector3 scale);
+    internal extern static void TransformComponent_GetRight(uint entityHandle, out Vector3 right);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_SetLocalScale(ulong entityId, ref Vector3 scale);
+    internal extern static void TransformComponent_GetUp(uint entityHandle, out Vector3 up);
+
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_GetPosition(ulong entityId, out Vector3 position);
+    internal extern static void TransformComponent_Translate(uint entityHandle, ref Vector3 translation);
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_GetRotation(ulong entityId, out Vector3 rotation);
+    internal extern static void TransformComponent_Rotate(uint entityHandle, float angle, ref Vector3 axis);
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_GetScale(ulong entityId, out Vector3 scale);
+    internal extern static void TransformComponent_LookAt(uint entityHandle, ref Vector3 target);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_GetForward(ulong entityId, out Vector3 forward);
+    internal extern static void TransformComponent_GetLocalPositions(uint[] entityHandles, Vector3[] positions);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_GetRight(ulong entityId, out Vector3 right);
+    internal extern static void TransformComponent_SetLocalPositions(uint[] entityHandles, Vector3[] positions);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_GetUp(ulong entityId, out Vector3 up);
+    internal extern static void TransformComponent_GetLocalRotations(uint[] entityHandles, Vector3[] rotations);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_Translate(ulong entityId, ref Vector3 translation);
+    internal extern static void TransformComponent_SetLocalRotations(uint[] entityHandles, Vector3[] rotations);
+
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_Rotate(ulong entityId, float angle, ref Vector3 axis);
+    internal extern static void TransformComponent_GetLocalScales(uint[] entityHandles, Vector3[] scales);
+
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void TransformComponent_LookAt(ulong entityId, ref Vector3 target);
+    internal extern static void TransformComponent_SetLocalScales(uint[] entityHandles, Vector3[] scales);
 
     #endregion
     #region CameraComponent
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_OrthographicCamera_GetAspectRatio(ulong entityId, out float aspectRatio);
+    internal extern static void CameraComponent_OrthographicCamera_GetAspectRatio(uint entityHandle, out float aspectRatio);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_OrthographicCamera_SetAspectRatio(ulong entityId, ref float aspectRatio);
+    internal extern static void CameraComponent_OrthographicCamera_SetAspectRatio(uint entityHandle, ref float aspectRatio);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_OrthographicCamera_GetZoomLevel(ulong entityId, out float zoomLevel);
+    internal extern static void CameraComponent_OrthographicCamera_GetZoomLevel(uint entityHandle, out float zoomLevel);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_OrthographicCamera_SetZoomLevel(ulong entityId, ref float zoomLevel);
+    internal extern static void CameraComponent_OrthographicCamera_SetZoomLevel(uint entityHandle, ref float zoomLevel);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_OrthographicCamera_GetNearClip(ulong entityId, out float nearClip);
+    internal extern static void CameraComponent_OrthographicCamera_GetNearClip(uint entityHandle, out float nearClip);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_OrthographicCamera_SetNearClip(ulong entityId, ref float nearClip);
+    internal extern static void CameraComponent_OrthographicCamera_SetNearClip(uint entityHandle, ref float nearClip);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_OrthographicCamera_GetFarClip(ulong entityId, out float farClip);
+    internal extern static void CameraComponent_OrthographicCamera_GetFarClip(uint entityHandle, out float farClip);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_OrthographicCamera_SetFarClip(ulong entityId, ref float farClip);
+    internal extern static void CameraComponent_OrthographicCamera_SetFarClip(uint entityHandle, ref float farClip);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_PerspectiveCamera_GetAspectRatio(ulong entityId, out float aspectRatio);
+    internal extern static void CameraComponent_PerspectiveCamera_GetAspectRatio(uint entityHandle, out float aspectRatio);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_PerspectiveCamera_SetAspectRatio(ulong entityId, ref float aspectRatio);
+    internal extern static void CameraComponent_PerspectiveCamera_SetAspectRatio(uint entityHandle, ref float aspectRatio);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_PerspectiveCamera_GetFov(ulong entityId, out float fov);
+    internal extern static void CameraComponent_PerspectiveCamera_GetFov(uint entityHandle, out float fov);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_PerspectiveCamera_SetFov(ulong entityId, ref float fov);
+    internal extern static void CameraComponent_PerspectiveCamera_SetFov(uint entityHandle, ref float fov);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_PerspectiveCamera_GetNearClip(ulong entityId, out float nearClip);
+    internal extern static void CameraComponent_PerspectiveCamera_GetNearClip(uint entityHandle, out float nearClip);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_PerspectiveCamera_SetNearClip(ulong entityId, ref float nearClip);
+    internal extern static void CameraComponent_PerspectiveCamera_SetNearClip(uint entityHandle, ref float nearClip);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_PerspectiveCamera_GetFarClip(ulong entityId, out float farClip);
+    internal extern static void CameraComponent_PerspectiveCamera_GetFarClip(uint entityHandle, out float farClip);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_PerspectiveCamera_SetFarClip(ulong entityId, ref float farClip);
+    internal extern static void CameraComponent_PerspectiveCamera_SetFarClip(uint entityHandle, ref float farClip);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_GetIsOrthographic(ulong entityId, out bool isOrthographic);
+    internal extern static void CameraComponent_GetIsOrthographic(uint entityHandle, out bool isOrthographic);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_SetIsOrthographic(ulong entityId, ref bool isOrthographic);
+    internal extern static void CameraComponent_SetIsOrthographic(uint entityHandle, ref bool isOrthographic);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_GetIsPrimary(ulong entityId, out bool isPrimary);
+    internal extern static void CameraComponent_GetIsPrimary(uint entityHandle, out bool isPrimary);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_SetIsPrimary(ulong entityId, ref bool isPrimary);
+    internal extern static void CameraComponent_SetIsPrimary(uint entityHandle, ref bool isPrimary);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_GetIsFixedAspectRatio(ulong entityId, out bool isFixedAspectRatio);
+    internal extern static void CameraComponent_GetIsFixedAspectRatio(uint entityHandle, out bool isFixedAspectRatio);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void CameraComponent_SetIsFixedAspectRatio(ulong entityId, ref bool isFixedAspectRatio);
+    internal extern static void CameraComponent_SetIsFixedAspectRatio(uint entityHandle, ref bool isFixedAspectRatio);
 
     #endregion
     #region Material
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Material_GetAlbedo(ulong entityId, out Color albedo);
+    internal extern static void Material_GetAlbedo(uint entityHandle, out Color albedo);
+
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void Material_SetAlbedo(uint entityHandle, ref Color albedo);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Material_SetAlbedo(ulong entityId, ref Color albedo);
+    internal extern static void Material_GetAlbedos(uint[] entityHandles, Color[] albedos);
+
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void Material_SetAlbedos(uint[] entityHandles, Color[] albedos);
 
     #endregion
     #region ScriptComponent
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static string ScriptComponent_GetClassName(ulong entityId);
+    internal extern static string ScriptComponent_GetClassName(uint entityHandle);
 
     #endregion
     #region Rigidbody
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_GetVelocity(ulong entityId, out Vector3 velocity);
+    internal extern static void Rigidbody_GetVelocity(uint entityHandle, out Vector3 velocity);
+
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void Rigidbody_SetVelocity(uint entityHandle, ref Vector3 velocity);
+
+    [MethodImplAttribute(MethodImplOptions.InternalCall)]
+    internal extern static void Rigidbody_GetAcceleration(uint entityHandle, out Vector3 acceleration);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_SetVelocity(ulong entityId, ref Vector3 velocity);
+    internal extern static void Rigidbody_SetAcceleration(uint entityHandle, ref Vector3 acceleration);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_GetAcceleration(ulong entityId, out Vector3 acceleration);
+    internal extern static void Rigidbody_GetMass(uint entityHandle, out float mass);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_SetAcceleration(ulong entityId, ref Vector3 acceleration);
+    internal extern static void Rigidbody_SetMass(uint entityHandle, ref float mass);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_GetMass(ulong entityId, out float mass);
+    internal extern static void Rigidbody_GetUseGravity(uint entityHandle, out bool useGravity);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_SetMass(ulong entityId, ref float mass);
+    internal extern static void Rigidbody_SetUseGravity(uint entityHandle, ref bool useGravity);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_GetUseGravity(ulong entityId, out bool useGravity);
+    internal extern static void Rigidbody_GetPositionConstraints(uint entityHandle, out RigidbodyPositionConstraints positionConstraints);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_SetUseGravity(ulong entityId, ref bool useGravity);
+    internal extern static void Rigidbody_SetPositionConstraints(uint entityHandle, ref RigidbodyPositionConstraints positionConstraints);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_GetPositionConstraints(ulong entityId, out RigidbodyPositionConstraints positionConstraints);
+    internal extern static void Rigidbody_GetRotationConstraints(uint entityHandle, out RigidbodyRotationConstraints rotationConstraints);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_SetPositionConstraints(ulong entityId, ref RigidbodyPositionConstraints positionConstraints);
+    internal extern static void Rigidbody_SetRotationConstraints(uint entityHandle, ref RigidbodyRotationConstraints rotationConstraints);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_GetRotationConstraints(ulong entityId, out RigidbodyRotationConstraints rotationConstraints);
+    internal extern static void Rigidbody_GetVelocities(uint[] entityHandles, Vector3[] velocities);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void Rigidbody_SetRotationConstraints(ulong entityId, ref RigidbodyRotationConstraints rotationConstraints);
+    internal extern static void Rigidbody_SetVelocities(uint[] entityHandles, Vector3[] velocities);
 
     #endregion
     #region BoxCollider
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static bool BoxCollider_GetIsTrigger(ulong entityId);
+    internal extern static bool BoxCollider_GetIsTrigger(uint entityHandle);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void BoxCollider_SetIsTrigger(ulong entityId, bool isTrigger);
+    internal extern static void BoxCollider_SetIsTrigger(uint entityHandle, bool isTrigger);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void BoxCollider_GetLocalPosition(ulong entityId, out Vector3 position);
+    internal extern static void BoxCollider_GetLocalPosition(uint entityHandle, out Vector3 position);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void BoxCollider_SetLocalPosition(ulong entityId, ref Vector3 position);
+    internal extern static void BoxCollider_SetLocalPosition(uint entityHandle, ref Vector3 position);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void BoxCollider_GetLocalScale(ulong entityId, out Vector3 scale);
+    internal extern static void BoxCollider_GetLocalScale(uint entityHandle, out Vector3 scale);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void BoxCollider_SetLocalScale(ulong entityId, ref Vector3 scale);
+    internal extern static void BoxCollider_SetLocalScale(uint entityHandle, ref Vector3 scale);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void BoxCollider_GetOnTrigger(ulong entityId, out IntPtr onTriggerDelegate);
+    internal extern static void BoxCollider_GetOnTrigger(uint entityHandle, out IntPtr onTriggerDelegate);
 
     [MethodImplAttribute(MethodImplOptions.InternalCall)]
-    internal extern static void BoxCollider_SetOnTrigger(ulong entityId, IntPtr onTriggerDelegate);
+    internal extern static void BoxCollider_SetOnTrigger(uint entityHandle, IntPtr onTriggerDelegate);
 
     #endregion
     #region SceneManager
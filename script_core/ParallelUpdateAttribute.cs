@@ -0,0 +1,17 @@
+using System;
+
+namespace EveEngine
+{
+  /// <summary>
+  /// Marks an entity script whose <c>OnUpdate</c> could run on worker threads in parallel with other instances.
+  /// </summary>
+  /// <remarks>
+  /// Scripts marked with it must only modify their own entity.
+  /// Structural changes such as instantiating or destroying entities and adding components are deferred
+  /// until every script is updated, so their results are not visible within the same update.
+  /// </remarks>
+  [AttributeUsage(AttributeTargets.Class, Inherited = true, AllowMultiple = false)]
+  public sealed class ParallelUpdateAttribute : Attribute
+  {
+  }
+}